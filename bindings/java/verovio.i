@@ -15,12 +15,15 @@
 %ignore vrv::Toolkit::GetCString( );
 %ignore vrv::Toolkit::GetLogString( );
 %ignore vrv::Toolkit::ParseOptions( const std::string & );
+%ignore vrv::Toolkit::ProcessPages;
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
 
 %module verovio
 %include "std_string.i"
+%include "std_vector.i"
+%template(StringVector) std::vector<std::string>;
 %include "../../include/vrv/toolkit.h"
 %include "../../include/vrv/toolkitdef.h"
 
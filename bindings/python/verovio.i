@@ -15,6 +15,7 @@
 %ignore vrv::Toolkit::GetCString( );
 %ignore vrv::Toolkit::GetLogString( );
 %ignore vrv::Toolkit::GetOptionsObj( );
+%ignore vrv::Toolkit::ProcessPages;
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
@@ -78,6 +79,13 @@ def getElementsAtTime(toolkit, millisec: int) -> dict:
     return json.loads($action(toolkit, millisec))
 %}
 
+// Toolkit::GetElementChangesInTimeRange
+%feature("shadow") vrv::Toolkit::GetElementChangesInTimeRange(int, int) %{
+def getElementChangesInTimeRange(toolkit, start_millisec: int, end_millisec: int) -> list:
+    """Return the changes of the elements being played within a time range."""
+    return json.loads($action(toolkit, start_millisec, end_millisec))
+%}
+
 // Toolkit::GetExpansionIdsForElement
 %feature("shadow") vrv::Toolkit::GetExpansionIdsForElement(const std::string &) %{
 def getExpansionIdsForElement(toolkit, xml_id: str) -> dict:
@@ -85,6 +93,13 @@ def getExpansionIdsForElement(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::GetFunctorProfile
+%feature("shadow") vrv::Toolkit::GetFunctorProfile() const %{
+def getFunctorProfile(toolkit) -> list:
+    """Return the functor profile as a JSON string."""
+    return json.loads($action(toolkit))
+%}
+
 // Toolkit::GetMEI
 %feature("shadow") vrv::Toolkit::GetMEI(const std::string & = "") %{
 def getMEI(toolkit, options: Optional[dict] = None) -> str:
@@ -94,6 +109,13 @@ def getMEI(toolkit, options: Optional[dict] = None) -> str:
     return $action(toolkit, json.dumps(options))
 %}
 
+// Toolkit::GetMemoryReport
+%feature("shadow") vrv::Toolkit::GetMemoryReport() const %{
+def getMemoryReport(toolkit) -> dict:
+    """Return a memory report of the loaded document as a JSON string."""
+    return json.loads($action(toolkit))
+%}
+
 // Toolkit::GetMIDIValuesForElement
 %feature("shadow") vrv::Toolkit::GetMIDIValuesForElement(const std::string &) %{
 def getMIDIValuesForElement(toolkit, xml_id: str) -> dict:
@@ -197,6 +219,8 @@ def validatePAE(toolkit, data: Union[str, dict]) -> dict:
 
 %module(package="verovio") verovio
 %include "std_string.i"
+%include "std_vector.i"
+%template(StringVector) std::vector<std::string>;
 %include "../../include/vrv/toolkit.h"
 %include "../../include/vrv/toolkitdef.h"
 
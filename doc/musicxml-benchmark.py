@@ -0,0 +1,113 @@
+# This script it expected to be run from ./bindings/python
+import argparse
+import os
+import random
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+# Options for loading only - the data is prepared but not laid out with 'breaks': 'none'
+benchmarkOptions = {
+    'breaks': 'none',
+    'logLevel': 'off',
+    'xmlIdSeed': 1
+}
+
+
+def generate_score(nb_parts, nb_measures):
+    # Generate an orchestral score with beams, tuplets, chords, slurs and directions in every part
+    random.seed(1)
+    steps = 'CDEFGAB'
+
+    def note(octave, duration, type, staff, beam=None, tuplet=None, chord=False, notations=''):
+        xml = '<note>' + ('<chord/>' if chord else '')
+        xml += f'<pitch><step>{random.choice(steps)}</step><octave>{octave}</octave></pitch>'
+        xml += f'<duration>{duration}</duration><voice>1</voice><type>{type}</type>'
+        if tuplet:
+            xml += '<time-modification><actual-notes>3</actual-notes><normal-notes>2</normal-notes></time-modification>'
+            notations += f'<tuplet type="{tuplet}"/>' if tuplet != 'continue' else ''
+        xml += f'<staff>{staff}</staff>'
+        if beam:
+            xml += f'<beam number="1">{beam}</beam>'
+        if notations:
+            xml += f'<notations>{notations}</notations>'
+        return xml + '</note>'
+
+    xml = ['<?xml version="1.0" encoding="UTF-8"?>', '<score-partwise version="3.1">', '<part-list>']
+    for p in range(nb_parts):
+        xml.append(f'<score-part id="P{p + 1}"><part-name>Part {p + 1}</part-name></score-part>')
+    xml.append('</part-list>')
+    for p in range(nb_parts):
+        nb_staves = 2 if (p % 5 == 4) else 1
+        octave = 3 + p % 3
+        xml.append(f'<part id="P{p + 1}">')
+        for m in range(nb_measures):
+            xml.append(f'<measure number="{m + 1}">')
+            if m == 0:
+                clefs = '<clef number="1"><sign>G</sign><line>2</line></clef>'
+                if nb_staves == 2:
+                    clefs = '<staves>2</staves>' + clefs + '<clef number="2"><sign>F</sign><line>4</line></clef>'
+                xml.append('<attributes><divisions>6</divisions><key><fifths>0</fifths></key>'
+                           '<time><beats>4</beats><beat-type>4</beat-type></time>' + clefs + '</attributes>')
+            if m % 4 == 0:
+                xml.append('<direction placement="below"><direction-type><dynamics><mf/></dynamics></direction-type></direction>')
+                xml.append('<direction placement="below"><direction-type><wedge type="crescendo"/></direction-type></direction>')
+            elif m % 4 == 1:
+                xml.append('<direction placement="below"><direction-type><wedge type="stop"/></direction-type></direction>')
+            for staff in range(1, nb_staves + 1):
+                if staff > 1:
+                    xml.append('<backup><duration>24</duration></backup>')
+                xml.append(note(octave, 3, 'eighth', staff, beam='begin', notations='<slur type="start" number="1"/>'))
+                xml.append(note(octave, 3, 'eighth', staff, beam='end', notations='<slur type="stop" number="1"/>'))
+                xml.append(note(octave, 2, 'eighth', staff, beam='begin', tuplet='start'))
+                xml.append(note(octave, 2, 'eighth', staff, beam='continue', tuplet='continue'))
+                xml.append(note(octave, 2, 'eighth', staff, beam='end', tuplet='stop'))
+                xml.append(note(octave, 6, 'quarter', staff, notations='<articulations><staccato/></articulations>'))
+                xml.append(note(octave, 6, 'quarter', staff, chord=True))
+                xml.append(note(octave, 3, 'eighth', staff, beam='begin'))
+                xml.append(note(octave, 3, 'eighth', staff, beam='end'))
+            xml.append('</measure>')
+        xml.append('</part>')
+    xml.append('</score-partwise>')
+    return '\n'.join(xml)
+
+
+def benchmark(tk, name, data, repeat):
+    times = []
+    for i in range(repeat):
+        start = time.perf_counter()
+        tk.loadData(data)
+        times.append(time.perf_counter() - start)
+    print(f'{name}: min {min(times) * 1000:.1f} ms, mean {sum(times) / len(times) * 1000:.1f} ms')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Time the loading of MusicXML files')
+    parser.add_argument('input_dir', nargs='?', default='',
+                        help='directory with the MusicXML files to load (a score is generated if not given)')
+    parser.add_argument('--repeat', type=int, default=5, help='number of loads per file')
+    parser.add_argument('--parts', type=int, default=24, help='number of parts of the generated score')
+    parser.add_argument('--measures', type=int, default=300, help='number of measures of the generated score')
+    args = parser.parse_args()
+
+    # version of the toolkit
+    tk = verovio.toolkit(False)
+    print(f'Verovio {tk.getVersion()}')
+
+    tk.setResourcePath('../../data')
+    tk.setOptions(benchmarkOptions)
+
+    if len(args.input_dir) == 0:
+        data = generate_score(args.parts, args.measures)
+        benchmark(tk, f'Generated score ({args.parts} parts, {args.measures} measures)', data, args.repeat)
+    else:
+        path = args.input_dir.replace("\ ", " ")
+        for item in sorted(os.listdir(path)):
+            if not item.endswith(('.xml', '.musicxml')):
+                continue
+            with open(os.path.join(path, item), encoding='utf-8') as f:
+                data = f.read()
+            benchmark(tk, item, data, args.repeat)
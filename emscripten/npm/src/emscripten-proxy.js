@@ -39,9 +39,15 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getElementsAtTime(Toolkit *ic, int time)
     mapping.getElementsAtTime = VerovioModule.cwrap("vrvToolkit_getElementsAtTime", "string", ["number", "number"]);
 
+    // char *getElementChangesInTimeRange(Toolkit *ic, int startTime, int endTime)
+    mapping.getElementChangesInTimeRange = VerovioModule.cwrap("vrvToolkit_getElementChangesInTimeRange", "string", ["number", "number", "number"]);
+
     // char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
     mapping.getExpansionIdsForElement = VerovioModule.cwrap("vrvToolkit_getExpansionIdsForElement", "string", ["number", "string"]);
 
+    // char *getFunctorProfile(Toolkit *ic)
+    mapping.getFunctorProfile = VerovioModule.cwrap("vrvToolkit_getFunctorProfile", "string", ["number"]);
+
     // char *getHumdrum(Toolkit *ic)
     mapping.getHumdrum = VerovioModule.cwrap("vrvToolkit_getHumdrum", "string");
 
@@ -60,6 +66,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getMEI(Toolkit *ic, const char *options)
     mapping.getMEI = VerovioModule.cwrap("vrvToolkit_getMEI", "string", ["number", "string"]);
 
+    // char *getMemoryReport(Toolkit *ic)
+    mapping.getMemoryReport = VerovioModule.cwrap("vrvToolkit_getMemoryReport", "string", ["number"]);
+
     // char *vrvToolkit_getNotatedIdForElement(Toolkit *tk, const char *xmlId);
     mapping.getNotatedIdForElement = VerovioModule.cwrap("vrvToolkit_getNotatedIdForElement", "string", ["number", "string"]);
 
@@ -117,6 +126,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToTimemap(Toolkit *ic)
     mapping.renderToTimemap = VerovioModule.cwrap("vrvToolkit_renderToTimemap", "string", ["number", "string"]);
 
+    // void resetFunctorProfile(Toolkit *ic)
+    mapping.resetFunctorProfile = VerovioModule.cwrap("vrvToolkit_resetFunctorProfile", null, ["number"]);
+
     // void resetOptions(Toolkit *ic)
     mapping.resetOptions = VerovioModule.cwrap("vrvToolkit_resetOptions", null, ["number"]);
 
@@ -6,7 +6,8 @@ import {
     LOG_INFO,
     LOG_DEBUG,
     enableLog,
-    enableLogToBuffer
+    enableLogToBuffer,
+    enableFunctorProfiler
 } from "./verovio-logger.js";
 export {
     VerovioToolkit,
@@ -17,4 +18,5 @@ export {
     LOG_DEBUG,
     enableLog,
     enableLogToBuffer,
+    enableFunctorProfiler,
 };
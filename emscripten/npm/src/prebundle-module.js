@@ -7,7 +7,8 @@ import {
     LOG_INFO,
     LOG_DEBUG,
     enableLog,
-    enableLogToBuffer
+    enableLogToBuffer,
+    enableFunctorProfiler
 } from "./verovio-logger.js";
 
 class VerovioToolkitDefaultModule extends VerovioToolkit {
@@ -24,6 +25,10 @@ function enableLogToBufferDefaultModule(value, VerovioModule = DefaultVerovioMod
     return enableLogToBuffer(value, VerovioModule);
 }
 
+function enableFunctorProfilerDefaultModule(value, VerovioModule = DefaultVerovioModule) {
+    return enableFunctorProfiler(value, VerovioModule);
+}
+
 // Assign Module to window to prevent breaking changes.
 // Deprecated, use verovio.module instead.
 if (typeof window !== "undefined") {
@@ -40,4 +45,5 @@ export default {
     LOG_DEBUG,
     enableLog: enableLogDefaultModule,
     enableLogToBuffer: enableLogToBufferDefaultModule,
+    enableFunctorProfiler: enableFunctorProfilerDefaultModule,
 };
@@ -11,3 +11,7 @@ export function enableLog(level, VerovioModule) {
 export function enableLogToBuffer(value, VerovioModule) {
     return VerovioModule.cwrap("enableLogToBuffer", null, ["number"])(value);
 }
+
+export function enableFunctorProfiler(value, VerovioModule) {
+    return VerovioModule.cwrap("enableFunctorProfiler", null, ["number"])(value);
+}
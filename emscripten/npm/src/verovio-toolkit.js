@@ -46,10 +46,18 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.getElementsAtTime(this.ptr, millisec));
     }
 
+    getElementChangesInTimeRange(startMillisec, endMillisec) {
+        return JSON.parse(this.proxy.getElementChangesInTimeRange(this.ptr, startMillisec, endMillisec));
+    }
+
     getExpansionIdsForElement(xmlId) {
         return JSON.parse(this.proxy.getExpansionIdsForElement(this.ptr, xmlId));
     }
 
+    getFunctorProfile() {
+        return JSON.parse(this.proxy.getFunctorProfile(this.ptr));
+    }
+
     getHumdrum() {
         return this.proxy.getHumdrum(this.ptr);
     }
@@ -74,6 +82,10 @@ export class VerovioToolkit {
         return this.proxy.getMEI(this.ptr, JSON.stringify(options));
     }
 
+    getMemoryReport() {
+        return JSON.parse(this.proxy.getMemoryReport(this.ptr));
+    }
+
     getMIDIValuesForElement(xmlId) {
         return JSON.parse(this.proxy.getMIDIValuesForElement(this.ptr, xmlId));
     }
@@ -170,6 +182,10 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.renderToTimemap(this.ptr, JSON.stringify(options)));
     }
 
+    resetFunctorProfile() {
+        this.proxy.resetFunctorProfile(this.ptr);
+    }
+
     resetOptions() {
         this.proxy.resetOptions(this.ptr);
     }
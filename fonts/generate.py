@@ -3,10 +3,12 @@ import json
 import logging
 import os
 import shutil
+import struct
 import subprocess
 import sys
 import tempfile
 import xml.etree.ElementTree as Et
+import zlib
 from argparse import ArgumentParser, Namespace, RawTextHelpFormatter
 from pathlib import Path
 from typing import Optional
@@ -297,6 +299,71 @@ def generate_woff2(opts: Namespace) -> bool:
     return True
 
 
+def generate_bin(opts: Namespace) -> bool:
+    """
+    Generates the binary glyph table from the bounding-boxes file of a font. The binary glyph
+    table is loaded by Verovio instead of the bounding-boxes file when it exists next to it.
+    The format is described in Verovio's resources.cpp and has to be kept in sync with it.
+
+    :param opts: A set of options from the argument parser sub-command.
+    :return: True if successful, False otherwise.
+    """
+    fontname: str = opts.fontname
+    data_pth: Path = Path(opts.data, "text") if opts.text else Path(opts.data)
+    input_pth: Path = Path(data_pth, f"{fontname}.xml")
+    output_pth: Path = Path(data_pth, f"{fontname}.bin")
+
+    if not os.access(input_pth, os.R_OK):
+        log.error("Could not read %s. Does it exist?", input_pth)
+        return False
+
+    root: Et.Element = Et.parse(str(input_pth)).getroot()
+    units_per_em: Optional[str] = root.get("units-per-em")
+    if not units_per_em:
+        log.error("No units-per-em attribute in %s", input_pth)
+        return False
+
+    glyphs: list[Et.Element] = [g for g in root.findall("g") if g.get("c")]
+
+    def pack_str(value: str) -> bytes:
+        encoded: bytes = value.encode("utf-8")
+        return struct.pack("<B", len(encoded)) + encoded
+
+    # The CRC-32 of the bounding-boxes file lets Verovio detect a binary glyph table that is outdated
+    with open(input_pth, "rb") as xfile:
+        checksum: int = zlib.crc32(xfile.read())
+
+    data: bytearray = bytearray(
+        struct.pack("<4sHHiII", b"VRVG", 2, 0, int(units_per_em), len(glyphs), checksum)
+    )
+    for glyph in glyphs:
+        code: str = glyph.get("c", "")
+        hax: Optional[str] = glyph.get("h-a-x")
+        data += struct.pack(
+            "<I5fB",
+            int(code, 16),
+            float(glyph.get("x", "0")),
+            float(glyph.get("y", "0")),
+            float(glyph.get("w", "0")),
+            float(glyph.get("h", "0")),
+            float(hax) if hax else 0.0,
+            1 if hax else 0,
+        )
+        data += pack_str(code)
+        data += pack_str(glyph.get("n", ""))
+        anchors: list[Et.Element] = [a for a in glyph.findall("a") if a.get("n")]
+        data += struct.pack("<B", len(anchors))
+        for anchor in anchors:
+            data += pack_str(anchor.get("n", ""))
+            data += struct.pack("<2f", float(anchor.get("x", "0")), float(anchor.get("y", "0")))
+
+    log.debug("Writing binary glyph table %s", output_pth.resolve())
+    with open(output_pth, "wb") as bfile:
+        bfile.write(data)
+
+    return True
+
+
 def check(opts: Namespace) -> bool:
     """
     Checks the glyphs of a font against the list of supported glyphs and identifies any glyphs
@@ -713,6 +780,16 @@ if __name__ == "__main__":
     )
     parser_woff2.set_defaults(func=generate_woff2)
 
+    bin_description = """
+    Creates the binary glyph table from the bounding-boxes file of a font. Verovio loads it instead of the
+    bounding-boxes file, which is faster at startup.
+    """
+    parser_bin = subparsers.add_parser("bin", description=bin_description)
+    parser_bin.add_argument("fontname", help="The name of the font (or of the text font with --text)")
+    parser_bin.add_argument("--data", help="Path to the Verovio data directory", default="../data")
+    parser_bin.add_argument("--text", help="Use the text font bounding-boxes file", action="store_true")
+    parser_bin.set_defaults(func=generate_bin)
+
     check_description: str = """
     Checks the supported.xml file against a specified font, and reports on the glyphs that are supported
     by Verovio, but that are not in that font.
@@ -11,22 +11,33 @@ $PYTHON generate.py smufl
 echo "Generating Bravura files ..."
 $PYTHON generate.py extract Bravura
 $PYTHON generate.py css Bravura
+$PYTHON generate.py bin Bravura
 
 echo "Generating Leipzig files ..."
 $PYTHON generate.py check Leipzig
 $PYTHON generate.py extract Leipzig
 $PYTHON generate.py css Leipzig
+$PYTHON generate.py bin Leipzig
 
 echo "Generating Gootville files ..."
 $PYTHON generate.py extract Gootville
 $PYTHON generate.py css Gootville
+$PYTHON generate.py bin Gootville
 
 echo "Generating Petaluma files ..."
 $PYTHON generate.py extract Petaluma
 $PYTHON generate.py css Petaluma
+$PYTHON generate.py bin Petaluma
 
 echo "Generating Leland files ..."
 $PYTHON generate.py extract Leland
 $PYTHON generate.py css Leland
+$PYTHON generate.py bin Leland
+
+echo "Generating text font binary glyph tables ..."
+$PYTHON generate.py bin Times --text
+$PYTHON generate.py bin Times-bold --text
+$PYTHON generate.py bin Times-bold-italic --text
+$PYTHON generate.py bin Times-italic --text
 
 echo "Done!"
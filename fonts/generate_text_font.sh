@@ -17,6 +17,8 @@ echo "Generating metadata for $fontfile font"
 fontforge generate_plain_text.py "$1"
 # generate XML file with bounding boxes for the text font
 python3 extract-bounding-boxes.py "$fontfile".svg "$fontfile".g2n ../data/text/"$fontfile".xml 
+# generate the binary glyph table from the XML file
+python3 generate.py bin "$fontfile" --text
 
 
 echo "Done!"
\ No newline at end of file
@@ -8,6 +8,7 @@
 #ifndef __VRV_ADJUSTFLOATINGPOSITIONERFUNCTOR_H__
 #define __VRV_ADJUSTFLOATINGPOSITIONERFUNCTOR_H__
 
+#include "boundingbox.h"
 #include "functor.h"
 
 namespace vrv {
@@ -53,6 +54,9 @@ private:
     ClassId m_classId;
     // Indicates if we are processing floating objects to be put in between the staff
     bool m_inBetween;
+    // The indexes of the overflowing bounding boxes above and below for each staff alignment of the system
+    std::map<const StaffAlignment *, BoundingBoxIndex> m_overflowAboveIndexes;
+    std::map<const StaffAlignment *, BoundingBoxIndex> m_overflowBelowIndexes;
 };
 
 //----------------------------------------------------------------------------
@@ -391,6 +391,73 @@ private:
     bool m_increasing;
 };
 
+//----------------------------------------------------------------------------
+// BoundingBoxIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class indexes an array of bounding boxes by the horizontal extent of their content.
+ * It is used for finding the boxes that can overlap horizontally with a range without going through the whole
+ * array. Boxes are sorted by their left side and boxes wider than the maximum width are kept apart and always
+ * checked. For floating positioners, the extent includes the drawing extender width.
+ * The boxes must not move horizontally while they are indexed.
+ */
+class BoundingBoxIndex {
+public:
+    /**
+     * @name Constructors, destructors, reset methods
+     */
+    ///@{
+    BoundingBoxIndex(int maxWidth = 0);
+    virtual ~BoundingBoxIndex() = default;
+    void Reset(int maxWidth);
+    ///@}
+
+    /**
+     * Index the boxes added to the array since the last update.
+     * The index is rebuilt when the array has been cleared or changed in the meantime.
+     */
+    void Update(const ArrayOfBoundingBoxes &boxes);
+
+    /**
+     * Fill the positions in the array of the boxes with a content extent overlapping the range (limits included).
+     * The positions are in increasing order, so boxes can be processed in the order of the array. This is a pre-
+     * selection and the exact overlap check remains to be done on the boxes.
+     */
+    void FindOverlapping(int left, int right, std::vector<int> &positions) const;
+
+private:
+    //
+public:
+    //
+private:
+    /**
+     * An indexed box with its content extent and its position in the array
+     */
+    struct Entry {
+        int m_left;
+        int m_right;
+        int m_position;
+    };
+
+    /**
+     * The boxes up to the maximum width sorted by left side, and the wider boxes
+     */
+    std::vector<Entry> m_sorted;
+    std::vector<Entry> m_wide;
+
+    /**
+     * The maximum width of the sorted boxes
+     */
+    int m_maxWidth;
+
+    /**
+     * The number of boxes of the array indexed and the last one for detecting changes
+     */
+    int m_count;
+    const BoundingBox *m_last;
+};
+
 } // namespace vrv
 
 #endif
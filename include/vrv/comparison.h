@@ -41,6 +41,8 @@ public:
         assert(m_supportReverse);
         m_reverse = true;
     }
+    // Return true if the comparison is reversed
+    bool IsReversed() const { return m_reverse; }
 
 protected:
     // This is set to true in contructor of classes that allow it
@@ -14,6 +14,7 @@
 #include "options.h"
 #include "resources.h"
 #include "scoredef.h"
+#include "timemap.h"
 
 namespace smf {
 class MidiFile;
@@ -22,8 +23,10 @@ class MidiFile;
 namespace vrv {
 
 class DocSelection;
+class FeatureExtractor;
 class FontInfo;
 class Glyph;
+class Measure;
 class Pages;
 class Page;
 class Score;
@@ -47,6 +50,7 @@ public:
     ///@{
     Doc();
     virtual ~Doc();
+    std::string GetClassName() const override { return "Doc"; }
     ///@}
 
     /**
@@ -260,6 +264,19 @@ public:
      */
     bool HasTimemap() const;
 
+    /**
+     * Look up the measure and the notes or rests played at the given time in milliseconds.
+     * The lookup is done in the timemap index, which is built with the timemap and again if the tree was changed.
+     * Return NULL if no measure is played at that time.
+     */
+    Measure *FindElementsAtTime(int millisec, ListOfObjects &notesOrRests);
+
+    /**
+     * Return the sorted times in milliseconds after startMillisec and up to endMillisec at which the measure or the
+     * notes or rests played can change.
+     */
+    std::vector<int> GetTimemapChangeTimes(int startMillisec, int endMillisec);
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layers and fill the midi file content.
@@ -279,8 +296,14 @@ public:
 
     /**
      * Extract music features to JSON string.
+     * With compact, the JSON is written on a single line.
+     */
+    bool ExportFeatures(std::string &output, const std::string &options, bool compact = false);
+
+    /**
+     * Extract music features with the given extractor.
      */
-    bool ExportFeatures(std::string &output, const std::string &options);
+    bool ExtractFeatures(FeatureExtractor &extractor);
 
     /**
      * Set the initial scoreDef of each page.
@@ -339,6 +362,42 @@ public:
      */
     void UnCastOffDoc(bool resetCache = true);
 
+    /**
+     * Cast off the systems of the document into pages again, for example for a new page height.
+     * The systems are kept and their position and height stored when casting off are used.
+     * Return false if the pages cannot be cast off again, in which case the document needs to be cast off again.
+     */
+    bool CastOffPagesDoc();
+
+    /**
+     * Mark the system containing the object as edited.
+     * The page containing it will be laid out again entirely when it is drawn.
+     */
+    void MarkLayoutDirty(Object *object);
+
+    /**
+     * Redo the layout of the pages with edited systems without casting off the document again.
+     * Return false if no system was edited or if the size of an edited system changed, in which case the document
+     * needs to be cast off again. A change of width is detected after the horizontal layout of the page.
+     * The pages are laid out entirely; the layout of single measures or systems is not supported.
+     */
+    bool LayOutDirtySystems();
+
+    /**
+     * Return true if a system was edited since the pages were laid out.
+     */
+    bool HasLayoutDirtySystems() const;
+
+    /**
+     * Return true if a page was laid out since the document was cast off.
+     */
+    bool HasLaidOutPages() const;
+
+    /**
+     * Reset the layout of all the pages so they are laid out again when rendered.
+     */
+    void ResetPageLayouts();
+
     /**
      * Cast off of the entire document according to the encoded data (pb and sb).
      * Does not perform any check on the presence and / or validity of such data.
@@ -438,11 +497,49 @@ public:
     bool HasFacsimile() const { return m_facsimile != NULL; }
     ///@}
 
+    /**
+     * @name Getter and increment method for the tree change counter.
+     * The counter is incremented every time an object of the document is attached, detached, deleted or has its id
+     * changed, and when children are reordered. It is used for invalidating the indexes of the document.
+     * See Object::NotifyTreeChange
+     */
+    ///@{
+    uint32_t GetTreeChangeCounter() const { return m_treeChangeCounter.load(std::memory_order_relaxed); }
+    void IncrementTreeChangeCounter() { m_treeChangeCounter.fetch_add(1, std::memory_order_relaxed); }
+    ///@}
+
+    /**
+     * Look up an element by id in the id index of the document.
+     * The index is (re)built lazily when looked up twice without the tree being changed in-between.
+     * Return false when the index cannot be used (not up-to-date or duplicated ids in the document),
+     * in which case the caller has to search the tree. The element is NULL if the id is not found.
+     */
+    bool FindIndexedByID(const std::string &id, const Object *&element) const;
+
+    /**
+     * Look up the descendants of the given type of the document or of one of its pages in the class id index.
+     * The descendants are given in the order of a forward traversal of visible objects.
+     * The index is (re)built lazily in the same way as the id index.
+     * Return NULL when the index cannot be used, in which case the caller has to search the tree.
+     */
+    const ArrayOfConstObjects *FindIndexedByType(const Object *root, ClassId classId) const;
+
+    /**
+     * Return true if the document has a visible descendant of one of the given types.
+     * The class id index is built if it is not up-to-date.
+     */
+    bool HasDescendantOfType(const std::vector<ClassId> &classIds) const;
+
     /**
      * Return true if the document has been cast off already.
      */
     bool IsCastOff() const { return m_isCastOff; }
 
+    /**
+     * Mark a document loaded with the layout of a cast-off document as cast off.
+     */
+    void MarkCastOff() { m_isCastOff = true; }
+
     /**
      * @name Methods for managing a selection.
      */
@@ -489,6 +586,16 @@ private:
      */
     void CollectVisibleScores();
 
+    /**
+     * Build the timemap index from the timemap
+     */
+    void IndexTimemap();
+
+    /**
+     * Build the class id index if it is not up-to-date
+     */
+    void IndexClassIds() const;
+
 public:
     Page *m_selectionPreceding;
     Page *m_selectionFollowing;
@@ -538,6 +645,12 @@ public:
     /** An expansion map that contains  */
     ExpansionMap m_expansionMap;
 
+    /**
+     * The objects for which a drawing group was created when preparing the data (see
+     * FloatingObject::SetDrawingGrpObject). The id of a group is its position in the vector + 1000.
+     */
+    std::vector<void *> m_drawingGrpObjects;
+
 private:
     /**
      * The type of document indicates how to deal with the layout information.
@@ -619,6 +732,18 @@ private:
      */
     double m_timemapTempo;
 
+    /**
+     * @name The timemap index with the measures and with the notes or rests of each measure, and the tree change
+     * counter at the time it was built.
+     * The times of the notes and rests are relative to the measure.
+     */
+    ///@{
+    TimeIntervalIndex m_measureTimeIndex;
+    std::map<const Measure *, TimeIntervalIndex> m_noteOrRestTimeIndexes;
+    bool m_timemapIndexValid;
+    uint32_t m_timemapIndexTreeChangeCounter;
+    ///@}
+
     /**
      * A flag to indicate whereas the document contains analytical markup to be converted.
      * This is currently limited to @fermata and @tie. Other attribute markup (@accid and @artic)
@@ -647,6 +772,33 @@ private:
 
     /** Facsimile information */
     Facsimile *m_facsimile;
+
+    /**
+     * The tree change counter of the document
+     */
+    std::atomic<uint32_t> m_treeChangeCounter;
+
+    /**
+     * @name The id index of the document with the tree change counters at the time it was built and looked up.
+     */
+    ///@{
+    mutable MapOfStrConstObjects m_idIndex;
+    mutable bool m_idIndexValid;
+    mutable bool m_idIndexHasDuplicates;
+    mutable uint32_t m_idIndexTreeChangeCounter;
+    mutable uint32_t m_idLookUpTreeChangeCounter;
+    ///@}
+
+    /**
+     * @name The class id index of the document and of each page with the tree change counters at the time it was
+     * built and looked up.
+     */
+    ///@{
+    mutable std::map<const Object *, MapOfClassIdConstObjects> m_classIdIndex;
+    mutable bool m_classIdIndexValid;
+    mutable uint32_t m_classIdIndexTreeChangeCounter;
+    mutable uint32_t m_classIdLookUpTreeChangeCounter;
+    ///@}
 };
 
 } // namespace vrv
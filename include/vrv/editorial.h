@@ -56,6 +56,15 @@ public:
     bool IsSupportedChild(Object *object) override;
     ///@}
 
+    /**
+     * @name Getter and setter for the visibility.
+     * Changing it notifies the document since it changes the content of visible-only traversals.
+     */
+    ///@{
+    VisibilityType GetVisibility() const { return m_visibility; }
+    void SetVisibility(VisibilityType visibility);
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -73,14 +82,14 @@ public:
 private:
     //
 public:
+    //
+private:
     /**
      * Holds the visibility (hidden or visible) for an editorial element.
      * By default, all editorial elements are visible. However, in an <app>, only one <rdg> is visible at the time. When
      * loading the file, the first <rdg> (or the <lem>) is made visible.
      */
     VisibilityType m_visibility;
-
-private:
 };
 
 } // namespace vrv
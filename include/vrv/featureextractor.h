@@ -8,6 +8,8 @@
 #ifndef __VRV_FEATURE_EXTRACTOR_H__
 #define __VRV_FEATURE_EXTRACTOR_H__
 
+#include <cstdint>
+
 //----------------------------------------------------------------------------
 
 #include "options.h"
@@ -45,8 +47,29 @@ public:
      */
     void ToJson(std::string &output);
 
+    /**
+     * Write the current content of the extractor to a compact JSON string on a single line.
+     * This is used for writing one record per line (NDJSON) when processing batches of inputs.
+     */
+    void ToCompactJson(std::string &output) const;
+
 private:
-    //
+    /**
+     * Append an array of strings (or an array of arrays of strings) to a compact JSON string
+     */
+    ///@{
+    static void AppendCompactArray(std::string &output, const std::vector<std::string> &values);
+    static void AppendCompactArray(std::string &output, const std::vector<std::vector<std::string>> &values);
+    ///@}
+
+    /**
+     * Convert an array of strings (or an array of arrays of strings) to a JSON array
+     */
+    ///@{
+    static jsonxx::Array ToJsonArray(const std::vector<std::string> &values);
+    static jsonxx::Array ToJsonArray(const std::vector<std::vector<std::string>> &values);
+    ///@}
+
 public:
     /**
      * A list of previous notes for interval calculation.
@@ -54,17 +77,133 @@ public:
      */
     std::list<const Note *> m_previousNotes;
 
-    jsonxx::Array m_pitchesChromatic;
-    jsonxx::Array m_pitchesDiatonic;
-    jsonxx::Array m_pitchesIds;
+    std::vector<std::string> m_pitchesChromatic;
+    std::vector<std::string> m_pitchesDiatonic;
+    std::vector<std::vector<std::string>> m_pitchesIds;
+
+    std::vector<std::string> m_intervalsChromatic;
+    std::vector<std::string> m_intervalsDiatonic;
+    std::vector<std::string> m_intervalGrossContour;
+    std::vector<std::string> m_intervalRefinedContour;
+    std::vector<std::vector<std::string>> m_intervalsIds;
+
+private:
+};
+
+//----------------------------------------------------------------------------
+// FeatureIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an n-gram inverted index of the features of a collection of documents.
+ * The index can be written to and read from a binary file (in the native byte order). Queries are sequences of pitch
+ * or interval values and return the IDs of the documents and of the notes they match.
+ */
+class FeatureIndex {
+
+public:
+    /**
+     * @name Constructors, destructors, reset methods
+     */
+    ///@{
+    FeatureIndex();
+    virtual ~FeatureIndex();
+    void Reset();
+    ///@}
+
+    /**
+     * Add the features of a document to the index.
+     * Return false if a feature has more distinct values than the tokens of the n-gram keys can hold.
+     */
+    bool AddDocument(const std::string &docId, const FeatureExtractor &extractor);
+
+    /**
+     * Return the number of documents in the index
+     */
+    int GetDocumentCount() const { return (int)m_documents.size(); }
+
+    /**
+     * Write the index to a file or read it from a file, replacing the current content
+     */
+    ///@{
+    bool Write(const std::string &filename);
+    bool Read(const std::string &filename);
+    ///@}
+
+    /**
+     * Query the index with a JSON object with the feature name, an array of values and an optional limit of documents.
+     * Return a JSON object with the total number of documents matching and, for each returned document, its ID
+     * and the IDs of the notes of each match.
+     */
+    std::string Query(const std::string &jsonQuery);
+
+private:
+    /**
+     * The features indexed, in the order they are stored in the documents and in the file
+     */
+    enum Feature {
+        PITCHES_CHROMATIC = 0,
+        PITCHES_DIATONIC,
+        INTERVALS_CHROMATIC,
+        INTERVALS_DIATONIC,
+        INTERVAL_GROSS_CONTOUR,
+        INTERVAL_REFINED_CONTOUR,
+        FEATURE_COUNT
+    };
 
-    jsonxx::Array m_intervalsChromatic;
-    jsonxx::Array m_intervalsDiatonic;
-    jsonxx::Array m_intervalGrossContour;
-    jsonxx::Array m_intervalRefinedContour;
-    jsonxx::Array m_intervalsIds;
+    /**
+     * The features of a document with the values replaced by token numbers
+     */
+    struct Document {
+        std::string m_id;
+        std::vector<uint32_t> m_sequences[FEATURE_COUNT];
+        std::vector<std::vector<std::string>> m_pitchesIds;
+        std::vector<std::vector<std::string>> m_intervalsIds;
+    };
+
+    /**
+     * The sorted n-gram keys with, for each of them, the range of its (document, position) pairs
+     */
+    struct Postings {
+        std::vector<uint64_t> m_keys;
+        std::vector<uint32_t> m_offsets;
+        std::vector<uint32_t> m_entries;
+    };
 
+    /**
+     * Get the token of a value, adding it to the vocabulary of the feature if necessary.
+     * Return false if the vocabulary is full.
+     */
+    bool GetToken(int feature, const std::string &value, uint32_t &token);
+
+    /**
+     * Pack up to FEATURE_INDEX_NGRAM_LENGTH tokens into a key, with the first token in the highest bits
+     */
+    static uint64_t GetKey(const uint32_t *tokens, int count);
+
+    /**
+     * Rebuild the postings from the documents after documents were added
+     */
+    void Finalize();
+
+    /**
+     * Check that the tokens, keys, offsets and entries read from a file are consistent with each other
+     */
+    bool IsValid() const;
+
+    /**
+     * Append the note IDs of a match to a JSON array
+     */
+    void AppendMatch(jsonxx::Array &matches, const Document &document, int feature, int position, int length) const;
+
+public:
+    //
 private:
+    std::vector<Document> m_documents;
+    std::vector<std::string> m_vocabularies[FEATURE_COUNT];
+    std::map<std::string, uint32_t> m_tokens[FEATURE_COUNT];
+    Postings m_postings[FEATURE_COUNT];
+    bool m_isFinalized;
 };
 
 } // namespace vrv
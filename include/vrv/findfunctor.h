@@ -530,6 +530,145 @@ private:
     ListOfConstObjects *m_flatList;
 };
 
+//----------------------------------------------------------------------------
+// IndexIDsFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills an index of all the elements by id.
+ * In case of duplicated ids, the first element in the traversal is kept.
+ */
+class IndexIDsFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    IndexIDsFunctor(MapOfStrConstObjects *idIndex);
+    virtual ~IndexIDsFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Return true if duplicated ids were found
+     */
+    bool HasDuplicates() const { return m_hasDuplicates; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(const Object *object) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The index of elements by id
+    MapOfStrConstObjects *m_idIndex;
+    // A flag indicating that duplicated ids were found
+    bool m_hasDuplicates;
+};
+
+//----------------------------------------------------------------------------
+// IndexClassIdsFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills an index of the elements by class id for the document and for each page.
+ */
+class IndexClassIdsFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    IndexClassIdsFunctor(const Doc *doc, std::map<const Object *, MapOfClassIdConstObjects> *classIdIndex);
+    virtual ~IndexClassIdsFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return true; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(const Object *object) override;
+    FunctorCode VisitPage(const Page *page) override;
+    FunctorCode VisitPageEnd(const Page *page) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The index of elements by class id for the document and for each page
+    std::map<const Object *, MapOfClassIdConstObjects> *m_classIdIndex;
+    // The index of the document and of the current page
+    MapOfClassIdConstObjects *m_docIndex;
+    MapOfClassIdConstObjects *m_pageIndex;
+};
+
+//----------------------------------------------------------------------------
+// CollectClassIdsFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class collects the class ids of the elements in the tree, with their class name and number of elements.
+ * It is used for the memory report.
+ */
+class CollectClassIdsFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    CollectClassIdsFunctor();
+    virtual ~CollectClassIdsFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Getter for the class name and the number of elements of each class id collected
+     */
+    const std::map<ClassId, std::pair<std::string, int>> &GetClassIds() const { return m_classIds; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(const Object *object) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The class name and the number of elements visited for each class id
+    std::map<ClassId, std::pair<std::string, int>> m_classIds;
+};
+
 } // namespace vrv
 
 #endif // __VRV_FINDFUNCTOR_H__
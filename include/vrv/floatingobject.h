@@ -73,7 +73,7 @@ public:
 
     /**
      * @name Get and set the drawing group for linking floating element horizontally.
-     * When setting it with an object, the corresponding id is returned (found or created)
+     * When setting it with an object, the corresponding id is returned (found or created in the document)
      */
     ///@{
     int GetDrawingGrpId() const { return m_drawingGrpId; }
@@ -91,13 +91,6 @@ public:
     int GetMaxDrawingYRel() const { return m_maxDrawingYRel; };
     ///@}
 
-    /**
-     * @name Get and set the drawing object IDs
-     */
-    ///@{
-    void ResetDrawingObjectIDs();
-    ///@}
-
     /**
      * Check whether current object represents initial element or extender lines
      */
@@ -142,18 +135,6 @@ private:
     int m_drawingGrpId;
 
     int m_maxDrawingYRel;
-
-    //----------------//
-    // Static members //
-    //----------------//
-
-    /**
-     * A vector for storing object / ids mapping.
-     * When a group is created based on an object address, it is stack on the vector.
-     * The ids of the group is then the position in the vector + GRPS_BASE_ID.
-     * Groups coded in MEI have negative ids (-@vgrp value)
-     */
-    static thread_local std::vector<void *> s_drawingObjectIds;
 };
 
 //----------------------------------------------------------------------------
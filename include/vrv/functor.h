@@ -76,6 +76,18 @@ public:
      */
     virtual bool ImplementsEndInterface() const = 0;
 
+    /**
+     * Getters/Setters for the profiling flag and counters, which are updated in Object::Process
+     */
+    ///@{
+    bool IsProfiled() const { return m_isProfiled; }
+    void SetProfiled(bool isProfiled) { m_isProfiled = isProfiled; }
+    long GetNodeCount() const { return m_nodeCount; }
+    void IncrementNodeCount() { ++m_nodeCount; }
+    long GetAcceptCount() const { return m_acceptCount; }
+    void IncrementAcceptCount() { ++m_acceptCount; }
+    ///@}
+
 private:
     //
 public:
@@ -89,6 +101,10 @@ private:
     bool m_visibleOnly = true;
     // Direction
     bool m_direction = FORWARD;
+    // Profiling flag and counters
+    bool m_isProfiled = false;
+    long m_nodeCount = 0;
+    long m_acceptCount = 0;
 };
 
 //----------------------------------------------------------------------------
@@ -209,6 +225,51 @@ private:
     //
 };
 
+//----------------------------------------------------------------------------
+// CompositeFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class groups mutable functors that are processed in a single traversal of the tree.
+ * Each object is visited by the functors in the order in which they were added, which is equivalent to
+ * processing them one after the other only if the functors do not depend on each other.
+ * All functors must have the same direction. Filters, visibility and functor codes apply to each functor separately.
+ * At most COMPOSITE_FUNCTOR_MAX functors can be grouped.
+ */
+class CompositeFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    CompositeFunctor() {}
+    CompositeFunctor(std::initializer_list<Functor *> functors) : m_functors(functors) {}
+    virtual ~CompositeFunctor() = default;
+    ///@}
+
+    /**
+     * Add a functor to the group
+     */
+    void AddFunctor(Functor *functor)
+    {
+        assert(m_functors.size() < COMPOSITE_FUNCTOR_MAX);
+        m_functors.push_back(functor);
+    }
+
+    /**
+     * Getter for the functors
+     */
+    const std::vector<Functor *> &GetFunctors() const { return m_functors; }
+
+private:
+    //
+public:
+    //
+private:
+    // The functors processed together
+    std::vector<Functor *> m_functors;
+};
+
 //----------------------------------------------------------------------------
 // CollectAndProcess
 //----------------------------------------------------------------------------
@@ -376,6 +376,8 @@ protected:
     /**
      * Search if an alignment of the type is already there at the time.
      * If not, return in idx the position where it needs to be inserted (-1 if it is the end)
+     * The alignments are expected to be ordered by time (with the order of AlignmentType for the same time),
+     * which is the case when they are added with the returned idx.
      */
     ///@{
     Alignment *SearchAlignmentAtTime(double time, AlignmentType type, int &idx);
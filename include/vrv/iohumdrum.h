@@ -441,6 +441,7 @@ public:
 
     std::string GetHumdrumString();
     std::string GetMeiString();
+    void MoveHumdrumFiles(hum::HumdrumFileSet &infiles);
 
 protected:
     void clear();
@@ -52,6 +52,7 @@ class Octave;
 class Pedal;
 class Section;
 class Slur;
+class StaffDef;
 class StaffGrp;
 class Tempo;
 class Tie;
@@ -183,6 +184,18 @@ namespace musicxml {
         int m_layerNum = 0;
     };
 
+    struct NoteSiblings {
+        // The next note
+        pugi::xml_node m_nextNote;
+        // The next note ending a beam, starting a tuplet and ending a tuplet, with their positions in the measure
+        pugi::xml_node m_beamEnd;
+        int m_beamEndIndex = 0;
+        pugi::xml_node m_tupletStart;
+        int m_tupletStartIndex = 0;
+        pugi::xml_node m_tupletEnd;
+        int m_tupletEndIndex = 0;
+    };
+
 } // namespace musicxml
 
 #endif // NO_MUSICXML_SUPPORT
@@ -256,6 +269,12 @@ private:
     void ReadMusicXmlTies(const pugi::xml_node &node, Layer *layer, Note *note, const std::string &measureNum);
     ///@}
 
+    /**
+     * Collect for each note of the measure the next notes ending a beam or starting or ending a tuplet.
+     * This is done in a single backward pass over the content of the measure.
+     */
+    void CollectNoteSiblings(const pugi::xml_node &node);
+
     /**
      * Process all clef change queue and add clefs to corresponding places in the score
      */
@@ -562,8 +581,47 @@ private:
     std::vector<std::pair<Arpeg *, musicxml::OpenArpeggio>> m_ArpeggioStack;
     /* a map for the measure counts storing the index of each measure created */
     std::map<Measure *, int> m_measureCounts;
+    /* the measures added to the section by index */
+    std::map<int, Measure *> m_sectionMeasures;
     /* measure rests */
     std::map<int, int> m_multiRests;
+    /* The staffDefs by staff number */
+    std::map<int, StaffDef *> m_staffDefs;
+    /* The next notes of each note of the current measure */
+    std::map<pugi::xml_node, musicxml::NoteSiblings> m_noteSiblings;
+
+    /**
+     * @name XPath queries evaluated for each measure, direction or note, compiled once for the import
+     */
+    ///@{
+    const pugi::xpath_query m_multipleRestQuery{ ".//multiple-rest" };
+    const pugi::xpath_query m_wordsQuery{ "direction-type/words" };
+    const pugi::xpath_query m_dynamicsQuery{ "direction-type/dynamics" };
+    const pugi::xpath_query m_metronomeQuery{ "direction-type/metronome" };
+    const pugi::xpath_query m_wedgeQuery{ "direction-type/wedge" };
+    const pugi::xpath_query m_notationsQuery{ "notations[not(@print-object='no')]" };
+    const pugi::xpath_query m_cueTypeQuery{ "type[@size='cue']" };
+    const pugi::xpath_query m_beamStartQuery{ "beam[@number='1'][text()='begin']" };
+    const pugi::xpath_query m_beamFirstEndQuery{ "beam[@number='1'][text()='end']" };
+    const pugi::xpath_query m_beamEndQuery{ "beam[text()='end']" };
+    const pugi::xpath_query m_tupletStartQuery{ "notations/tuplet[@type='start']" };
+    const pugi::xpath_query m_tupletEndQuery{ "notations/tuplet[@type='stop']" };
+    const pugi::xpath_query m_slurQuery{ "notations/slur" };
+    const pugi::xpath_query m_tremoloQuery{ "ornaments/tremolo" };
+    const pugi::xpath_query m_breathQuery{ "articulations/breath-mark" };
+    const pugi::xpath_query m_caesuraQuery{ "articulations/caesura" };
+    const pugi::xpath_query m_fingeringQuery{ "technical/fingering" };
+    const pugi::xpath_query m_glissandoQuery{ "glissando|slide" };
+    const pugi::xpath_query m_mordentQuery{ "ornaments/*[contains(name(), 'mordent')]" };
+    const pugi::xpath_query m_schleiferQuery{
+        "ornaments/*[contains(name(), 'schleifer') or contains(name(), 'haydn')]"
+    };
+    const pugi::xpath_query m_trillQuery{ "ornaments/trill-mark" };
+    const pugi::xpath_query m_trillLineStartQuery{ "ornaments/wavy-line[@type='start']" };
+    const pugi::xpath_query m_trillLineStopQuery{ "ornaments/wavy-line[@type='stop']" };
+    const pugi::xpath_query m_turnQuery{ "ornaments/*[contains(name(), 'turn')]" };
+    const pugi::xpath_query m_arpeggiateQuery{ "*[contains(name(), 'arpeggiate')]" };
+    ///@}
 
 #endif // NO_MUSICXML_SUPPORT
 };
@@ -631,7 +631,7 @@ private:
      * to the one of the repetition marker (f or i).
      * We also need to clone all objects in the tokens
      */
-    void PrepareInsertion(int position, std::list<pae::Token> &insertion);
+    void PrepareInsertion(int position, std::vector<pae::Token> &insertion);
 
     /**
      * Check that the token list is a valid opening / closing tag successing.
@@ -678,7 +678,7 @@ public:
 
 private:
     /**
-     * The list of tokens representing the incipit
+     * The vector of tokens representing the incipit
      * Each token is a characther that needs to be processed.
      * When processing the tokens, the token can be assigned an Object.
      * When processed, the token::m_char is set to 0.
@@ -688,8 +688,15 @@ private:
      * - closing tags are missing (in non-pendantic modes)
      * - opening tags are not part of the PAE syntax (e.g., a chord)
      * Each token also stores the original position in the PAE string.
+     * The storage is taken from s_tokenBuffer and given back to it when the input is deleted.
      */
-    std::list<pae::Token> m_pae;
+    std::vector<pae::Token> m_pae;
+
+    /**
+     * The token storage kept between the inputs created on the same thread.
+     * It avoids re-allocating the token vector for every incipit when many of them are converted or validated.
+     */
+    static thread_local std::vector<pae::Token> s_tokenBuffer;
 
     /**
      * A flag indicating the incipit is mensural.
@@ -48,6 +48,15 @@ public:
      */
     void MakeVisible();
 
+    /**
+     * @name Getter and setter for the visibility.
+     * Changing it notifies the document since it changes the content of visible-only traversals.
+     */
+    ///@{
+    VisibilityType GetVisibility() const { return m_visibility; }
+    void SetVisibility(VisibilityType visibility);
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -65,15 +74,14 @@ public:
 private:
     //
 public:
+    //
+private:
     /**
      * Holds the visibility (hidden or visible) for an mdiv element.
      * By default, a mdiv elements is hidden, and one <mdiv> branchn has to be made visible.
      * See Mdiv::MakeVisible();
      */
     VisibilityType m_visibility;
-
-private:
-    //
 };
 
 } // namespace vrv
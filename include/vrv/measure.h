@@ -295,6 +295,11 @@ public:
      */
     int EnclosesTime(int time) const;
 
+    /**
+     * Return the real time duration of the measure in milliseconds
+     */
+    double GetRealTimeDurationMilliseconds() const;
+
     /**
      * Read only access to m_scoreTimeOffset
      */
@@ -306,6 +311,7 @@ public:
     ///@{
     double GetLastRealTimeOffset() const { return m_realTimeOffsetMilliseconds.back(); }
     double GetRealTimeOffsetMilliseconds(int repeat) const;
+    const std::vector<double> &GetRealTimeOffsetsMilliseconds() const { return m_realTimeOffsetMilliseconds; }
     ///@}
 
     /**
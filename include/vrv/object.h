@@ -8,10 +8,13 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <atomic>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -29,6 +32,7 @@ class Doc;
 class DurationInterface;
 class EditorialElement;
 class Output;
+class CompositeFunctor;
 class Filters;
 class Functor;
 class FunctorParams;
@@ -50,6 +54,88 @@ class Zone;
 #define FORWARD true
 #define BACKWARD false
 
+//----------------------------------------------------------------------------
+// ClassRegistration
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the MEI att classes and the interfaces registered by an object.
+ * All the objects of a class register the same sequence in their constructors. Each step of a sequence is
+ * therefore stored only once and shared by the objects, which only keep a pointer to the last step reached.
+ * Registrations are never deleted.
+ */
+class ClassRegistration {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    ClassRegistration();
+    virtual ~ClassRegistration();
+    ///@}
+
+    /**
+     * @name Getters for the att classes and interfaces registered
+     */
+    ///@{
+    const std::vector<AttClassId> &GetAttClasses() const { return m_attClasses; }
+    const std::vector<InterfaceId> &GetInterfaces() const { return m_interfaces; }
+    bool HasAttClass(AttClassId attClassId) const
+    {
+        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
+    }
+    bool HasInterface(InterfaceId interfaceId) const
+    {
+        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
+    }
+    ///@}
+
+    /**
+     * Return the registration with an additional att class or interface (with its att classes).
+     * The registration is created the first time it is reached.
+     */
+    ///@{
+    const ClassRegistration *AddAttClass(AttClassId attClassId) const;
+    const ClassRegistration *AddInterface(const std::vector<AttClassId> *attClasses, InterfaceId interfaceId) const;
+    ///@}
+
+    /**
+     * Return the empty registration from which all objects start
+     */
+    static const ClassRegistration *GetEmpty();
+
+    /**
+     * Return the number of registrations created and their size in bytes
+     */
+    static void GetStatistics(int &count, size_t &bytes);
+
+private:
+    /**
+     * Return the registration for the key, with the att classes and the interface added if it is created.
+     * Att classes are stored with their id and interfaces with negative keys.
+     * The registrations already created are looked up without locking.
+     */
+    const ClassRegistration *Extend(
+        int key, const std::vector<AttClassId> &attClasses, const InterfaceId *interfaceId) const;
+
+public:
+    //
+private:
+    // The att classes and interfaces registered
+    std::vector<AttClassId> m_attClasses;
+    std::vector<InterfaceId> m_interfaces;
+    // The key of this registration in the one it extends
+    int m_key;
+    // The registrations reached from this one, as a list that is only prepended to, which owns its next entry
+    mutable std::atomic<ClassRegistration *> m_firstExtension;
+    std::unique_ptr<ClassRegistration> m_nextExtension;
+
+    // The mutex guarding the creation of registrations and the statistics
+    static std::mutex s_mutex;
+    static int s_count;
+    static size_t s_bytes;
+};
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
@@ -114,16 +200,10 @@ public:
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
-    bool HasAttClass(AttClassId attClassId) const
-    {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
-    }
+    void RegisterAttClass(AttClassId attClassId) { m_registration = m_registration->AddAttClass(attClassId); }
+    bool HasAttClass(AttClassId attClassId) const { return m_registration->HasAttClass(attClassId); }
     void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
-    bool HasInterface(InterfaceId interfaceId) const
-    {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
-    }
+    bool HasInterface(InterfaceId interfaceId) const { return m_registration->HasInterface(interfaceId); }
     ///@}
 
     /**
@@ -243,7 +323,7 @@ public:
     virtual void CloneReset();
 
     const std::string &GetID() const { return m_id; }
-    void SetID(const std::string &id) { m_id = id; }
+    void SetID(const std::string &id);
     void SwapID(Object *other);
     void ResetID();
 
@@ -290,6 +370,7 @@ public:
     /**
      * Return a reference to the children that allows modification.
      * This method should be all only in AddChild overrides methods
+     * Callers changing the order of the children have to call NotifyTreeChange
      */
     ArrayOfObjects &GetChildrenForModification() { return m_children; }
 
@@ -355,7 +436,7 @@ public:
      * Reset the parent of the Object.
      * The current parent is not expected to be NULL.
      */
-    void ResetParent() { m_parent = NULL; }
+    void ResetParent();
 
     /**
      * Base method for checking if a child can be added.
@@ -650,6 +731,12 @@ public:
     void Process(ConstFunctor &functor, int deepness = UNLIMITED_DEPTH, bool skipFirst = false) const;
     ///@}
 
+    /**
+     * Process all the functors of the composite functor in a single traversal.
+     * Each functor is processed as with Process(Functor &) but each object is visited only once.
+     */
+    void Process(CompositeFunctor &functor, int deepness = UNLIMITED_DEPTH, bool skipFirst = false);
+
     /**
      * Interface for class functor visitation
      */
@@ -664,8 +751,21 @@ public:
     // Static methods //
     //----------------//
 
+    /**
+     * Seed the IDs of the current thread, randomly with 0.
+     * The first object created in the thread does not seed them again.
+     */
     static void SeedID(uint32_t seed = 0);
 
+    /**
+     * Getter and setter for the ID counter of the current thread.
+     * Used for resuming the IDs of a document after generating IDs for another one.
+     */
+    ///@{
+    static uint32_t GetIDCounter() { return s_xmlIDCounter; }
+    static void SetIDCounter(uint32_t counter);
+    ///@}
+
     static std::string GenerateHashID();
 
     static uint32_t Hash(uint32_t number, bool reverse = false);
@@ -677,6 +777,12 @@ public:
      */
     static bool IsPreOrdered(const Object *left, const Object *right);
 
+    /**
+     * Increment the tree change counter of the document the object belongs to, if any.
+     * See Doc::GetTreeChangeCounter
+     */
+    void NotifyTreeChange();
+
 private:
     /**
      * Method for generating the id.
@@ -688,12 +794,25 @@ private:
      */
     void Init(ClassId classId, const std::string &classIdStr);
 
+    /**
+     * Return true if the object is a descendant of the ancestor that would be reached by a visible-only traversal.
+     */
+    bool IsVisibleDescendantOf(const Object *ancestor) const;
+
+    /**
+     * Return the descendants of the type of the comparison from the class id index of the document.
+     * Return NULL if the comparison does not look for a type or if the index cannot be used.
+     */
+    const ArrayOfConstObjects *GetIndexedDescendants(Comparison *comparison) const;
+
     /**
      * Helper methods for functor processing
      */
     ///@{
     bool SkipChildren(bool visibleOnly) const;
     bool FiltersApply(const Filters *filters, Object *object) const;
+    void ProcessFunctors(
+        const std::vector<Functor *> &functors, uint32_t activeFunctors, bool direction, int deepness, bool skipFirst);
     ///@}
 
 public:
@@ -724,10 +843,11 @@ private:
 
     /**
      * Members for storing / generating ids
+     * Only the first character of the class id string passed to the constructor is used as prefix
      */
     ///@{
     std::string m_id;
-    std::string m_classIdStr;
+    char m_idPrefix;
     ///@}
 
     /**
@@ -755,14 +875,10 @@ private:
     ///@}
 
     /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
+     * The list of AttClassId (MEI att classes) and of InterfaceId (group of MEI att classes) implemented.
+     * It is shared by all the objects of the same class.
      */
-    std::vector<AttClassId> m_attClasses;
-
-    /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
-     */
-    std::vector<InterfaceId> m_interfaces;
+    const ClassRegistration *m_registration;
 
     /**
      * String for storing a comments attached to the object when printing an MEI element.
@@ -978,7 +1094,9 @@ class ObjectFactory {
 
 public:
     /**
-     * A static method returning a static object in order to guarantee initialisation
+     * A static method returning a static object in order to guarantee initialisation.
+     * The instance is shared by all threads. It is filled by the ClassRegistrar static initializers and is
+     * read-only afterwards.
      */
     static ObjectFactory *GetInstance();
 
@@ -988,9 +1106,9 @@ public:
     Object *Create(std::string name);
 
     /**
-     * Add the name / constructor map entry to the static register
+     * Add the name / constructor map entry and the size of the class to the static register
      */
-    void Register(std::string name, ClassId classId, std::function<Object *(void)> function);
+    void Register(std::string name, ClassId classId, size_t size, std::function<Object *(void)> function);
 
     /**
      * Get the ClassId from the MEI element string name by making a lookup in the register
@@ -1002,9 +1120,15 @@ public:
      */
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
-public:
-    static thread_local MapOfStrConstructors s_ctorsRegistry;
-    static thread_local MapOfStrClassIds s_classIdsRegistry;
+    /**
+     * Get the size in bytes of the class registered for the ClassId (0 if none is registered)
+     */
+    size_t GetClassSize(ClassId classId) const;
+
+private:
+    MapOfStrConstructors m_ctorsRegistry;
+    MapOfStrClassIds m_classIdsRegistry;
+    std::map<ClassId, size_t> m_classSizesRegistry;
 };
 
 //----------------------------------------------------------------------------
@@ -1018,7 +1142,7 @@ public:
      */
     ClassRegistrar(std::string name, ClassId classId)
     {
-        ObjectFactory::GetInstance()->Register(name, classId, []() -> Object * { return new T(); });
+        ObjectFactory::GetInstance()->Register(name, classId, sizeof(T), []() -> Object * { return new T(); });
     }
 };
 
@@ -88,6 +88,15 @@ enum option_SMUFLTEXTFONT { SMUFLTEXTFONT_embedded = 0, SMUFLTEXTFONT_linked, SM
 
 enum class OptionsCategory { None, Base, General, Layout, Mensural, Margins, Midi, Selectors, Full };
 
+/**
+ * The earliest stage of the layout invalidated by changing an option.
+ * Stages are ordered from the latest to the earliest, so a later stage is always redone with an earlier one.
+ * Draw: only the drawing (SVG output); Vertical: the layout of the pages done when they are rendered;
+ * CastOffPages: the breaking of the systems into pages; CastOffSystems: the breaking of the measures into systems;
+ * Horizontal: the horizontal layout cached for the cast-off; Prepare: the data prepared when loading it.
+ */
+enum class OptionsStage { None = 0, Draw, Vertical, CastOffPages, CastOffSystems, Horizontal, Prepare };
+
 /**
  * This class is a base class of each styling parameter
  */
@@ -98,6 +107,7 @@ public:
     {
         m_shortOption = 0;
         m_isCmdOnly = false;
+        m_stage = OptionsStage::Horizontal;
     }
     virtual ~Option() {}
     virtual void CopyTo(Option *option) = 0;
@@ -123,6 +133,9 @@ public:
     char GetShortOption() const { return m_shortOption; }
     bool IsCmdOnly() const { return m_isCmdOnly; }
 
+    void SetStage(OptionsStage stage) { m_stage = stage; }
+    OptionsStage GetStage() const { return m_stage; }
+
     /**
      * Return a JSON object for the option
      */
@@ -156,6 +169,8 @@ private:
     char m_shortOption;
     /* a flag indicating that the option is available only on the command line */
     bool m_isCmdOnly;
+    /* the earliest layout stage invalidated when the option changes - horizontal layout by default */
+    OptionsStage m_stage;
 };
 
 //----------------------------------------------------------------------------
@@ -581,9 +596,26 @@ public:
     // post processing of parameters
     void Sync();
 
+    /**
+     * Return the string values of the options by key, used for finding the options changed afterwards.
+     * Only the options invalidating the stage given or an earlier one are returned.
+     */
+    std::map<std::string, std::string> GetStrValues(OptionsStage stage = OptionsStage::None) const;
+
+    /**
+     * Return the earliest layout stage invalidated by the options changed since the values were taken.
+     * Return OptionsStage::None if no option changed.
+     */
+    OptionsStage GetChangedStage(const std::map<std::string, std::string> &values) const;
+
 private:
     void Register(Option *option, const std::string &key, OptionGrp *grp);
 
+    /**
+     * Return the earliest layout stage invalidated by the option with the current values
+     */
+    OptionsStage GetStage(const Option *option) const;
+
 public:
     /**
      * Comments in implementation file options.cpp
@@ -626,6 +658,8 @@ public:
     OptionBool m_incip;
     OptionBool m_justifyVertically;
     OptionBool m_landscape;
+    OptionString m_layoutCache;
+    OptionInt m_layoutThreads;
     OptionDbl m_minLastJustification;
     OptionBool m_mmOutput;
     OptionBool m_moveScoreDefinitionToStaff;
@@ -644,6 +678,7 @@ public:
     OptionInt m_pageWidth;
     OptionIntMap m_pedalStyle;
     OptionBool m_preserveAnalyticalMarkup;
+    OptionBool m_profileFunctors;
     OptionBool m_removeIds;
     OptionBool m_scaleToPageSize;
     OptionBool m_showRuntime;
@@ -83,10 +83,29 @@ public:
     /**
      * Do the layout of the page, which means aligning its content horizontally
      * and vertically, and justify horizontally and vertically if wanted.
-     * This will be done only if m_layoutDone is false or force is true.
+     * This will be done only if m_layoutDone is false, force is true, or systems were edited since the page was
+     * laid out. The horizontal layout carries state from one system to the next, so the entire page is laid out.
      */
     void LayOut(bool force = false);
 
+    /**
+     * Complete the layout of the page after LayOutHorizontally, i.e., justify it and lay it out vertically.
+     */
+    void LayOutAfterHorizontally();
+
+    /**
+     * @name Check if the page has been laid out and mark its layout as to be redone
+     */
+    ///@{
+    bool IsLayoutDone() const { return m_layoutDone; }
+    void ResetLayout() { m_layoutDone = false; }
+    ///@}
+
+    /**
+     * Check if the content of some systems was edited since the page was laid out
+     */
+    bool HasLayoutDirtySystems() const;
+
     /**
      * Do the layout for a transcription page (with layout information).
      * This only calculates positioning or layer element parts using provided layout of parents.
@@ -44,7 +44,6 @@ public:
     ///@{
     FunctorCode VisitDiv(Div *div) override;
     FunctorCode VisitChord(Chord *chord) override;
-    FunctorCode VisitFloatingObject(FloatingObject *floatingObject) override;
     FunctorCode VisitKeySig(KeySig *keySig) override;
     FunctorCode VisitRepeatMark(RepeatMark *repeatMark) override;
     FunctorCode VisitScore(Score *score) override;
@@ -8,6 +8,8 @@
 #ifndef __VRV_RESOURCES_H__
 #define __VRV_RESOURCES_H__
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 //----------------------------------------------------------------------------
@@ -23,6 +25,8 @@ namespace vrv {
 /**
  * This class provides resource values.
  * It manages fonts and glyph tables.
+ * The glyph tables are loaded once per process and shared by all the instances using the same fonts.
+ * They are copied before being modified when another font is selected.
  */
 
 class Resources {
@@ -61,7 +65,7 @@ public:
     bool InitTextFont(const std::string &fontName, const StyleAttributes &style);
     /** Select a particular font */
     bool SetFont(const std::string &fontName);
-    std::string GetCurrentFontName() const { return m_fontName; }
+    std::string GetCurrentFontName() const { return m_fonts->m_fontName; }
     ///@}
 
     /**
@@ -98,22 +102,53 @@ public:
     static char32_t GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar);
 
 private:
-    bool LoadFont(const std::string &fontName, bool withFallback = true);
+    /**
+     * The glyph tables loaded for a sequence of fonts.
+     * They are never modified once they are shared.
+     */
+    struct FontTables {
+        /** The font name of the font that is currently loaded */
+        std::string m_fontName;
+        /** The loaded SMuFL font */
+        GlyphTable m_fontGlyphTable;
+        /** A text font used for bounding box calculations */
+        GlyphTextMap m_textFont;
+        /** A map of glyph name / code */
+        GlyphNameTable m_glyphNameTable;
+    };
+
+    bool LoadFont(FontTables &fonts, const std::string &fontName, bool withFallback = true) const;
+    bool InitTextFont(FontTables &fonts, const std::string &fontName, const StyleAttributes &style) const;
+
+    /**
+     * Load the font or the text font from the binary glyph table next to the XML file.
+     * Return false if there is no glyph table, if it cannot be read, or if it is outdated.
+     */
+    ///@{
+    bool LoadFontGlyphTable(FontTables &fonts, const std::string &fontName, bool withFallback) const;
+    bool InitTextFontGlyphTable(FontTables &fonts, const std::string &fontName, const StyleAttributes &style) const;
+    ///@}
+
+    /**
+     * Look for the glyph tables registered for the key and use them.
+     * Return false if the fonts have not been loaded yet for this key.
+     */
+    bool UseRegisteredFonts(const std::string &key);
+
+    /**
+     * Register the glyph tables for the key and use them.
+     * If another instance has registered them in the meantime, these are used instead.
+     */
+    void RegisterFonts(const std::string &key, std::shared_ptr<const FontTables> fonts);
 
 private:
-    /** The font name of the font that is currently loaded */
-    std::string m_fontName;
     /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
     std::string m_path;
-    /** The loaded SMuFL font */
-    GlyphTable m_fontGlyphTable;
-    /** A text font used for bounding box calculations */
-    GlyphTextMap m_textFont;
+    /** The glyph tables currently used, possibly shared with other instances */
+    std::shared_ptr<const FontTables> m_fonts;
+    /** The key of the glyph tables in the registry, empty if they are not registered */
+    std::string m_fontsKey;
     mutable StyleAttributes m_currentStyle;
-    /**
-     * A map of glyph name / code
-     */
-    GlyphNameTable m_glyphNameTable;
 
     //----------------//
     // Static members //
@@ -122,6 +157,13 @@ private:
     /** The default path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
     static thread_local std::string s_defaultPath;
 
+    /**
+     * The registry of the glyph tables loaded in the process, with the mutex protecting it.
+     * The key is the resource path followed by the sequence of fonts loaded, one per line.
+     */
+    static std::map<std::string, std::shared_ptr<const FontTables>> s_fontRegistry;
+    static std::mutex s_fontRegistryMutex;
+
     /** The default font style */
     static const StyleAttributes k_defaultStyle;
 };
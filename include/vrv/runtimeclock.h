@@ -8,14 +8,23 @@
 #ifndef __VRV_RUNTIMECLOCK_H__
 #define __VRV_RUNTIMECLOCK_H__
 
-#ifndef NO_RUNTIME
-
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
 namespace vrv {
 
+class Functor;
+class FunctorBase;
+
+#ifndef NO_RUNTIME
+
 //----------------------------------------------------------------------------
 // RuntimeClock
 //----------------------------------------------------------------------------
@@ -48,7 +57,76 @@ private:
 
 }; // class RuntimeClock
 
+#endif // NO_RUNTIME
+
+//----------------------------------------------------------------------------
+// FunctorProfiler
+//----------------------------------------------------------------------------
+
+/**
+ * This class records the processing of the functors by Object::Process, aggregated per functor class.
+ * Only the outermost processing of a functor is recorded, which means that the time includes the time
+ * spent in other functors it processes itself.
+ * The profiler is shared by all the toolkits and threads of the process.
+ */
+class FunctorProfiler {
+public:
+    /**
+     * The values recorded for a functor class
+     */
+    struct Entry {
+        /** The number of times the functor was processed */
+        int m_processCount = 0;
+        /** The total wall time in seconds */
+        double m_seconds = 0.0;
+        /** The number of objects visited */
+        long m_nodeCount = 0;
+        /** The number of calls to Accept and AcceptEnd */
+        long m_acceptCount = 0;
+    };
+
+    /**
+     * @name Enable, disable and reset the profiler
+     */
+    ///@{
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+    static void Reset();
+    ///@}
+
+    /**
+     * Return a copy of the values recorded so far by functor class name
+     */
+    static std::map<std::string, Entry> GetEntries();
+
+    /**
+     * Run the processing and record it for the functor or for the functors processed together
+     */
+    ///@{
+    static void Profile(FunctorBase &functor, const std::function<void()> &process);
+    static void Profile(const std::vector<Functor *> &functors, const std::function<void()> &process);
+    ///@}
+
+private:
+    /** Return the class name of the functor without the namespace */
+    static std::string GetName(const FunctorBase &functor);
+
+    /** Add a processing to the entry of the functor class */
+    static void Record(const std::string &name, double seconds, long nodeCount, long acceptCount);
+
+private:
+    //
+public:
+    //
+private:
+    /** The flag enabling the profiler */
+    static std::atomic<bool> s_enabled;
+    /** The values recorded and the mutex protecting them */
+    static std::map<std::string, Entry> s_entries;
+    static std::mutex s_mutex;
+
+}; // class FunctorProfiler
+
 } // namespace vrv
 
-#endif // NO_RUNTIME
 #endif // __VRV_RUNTIMECLOCK_H__
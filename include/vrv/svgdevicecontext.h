@@ -11,6 +11,9 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -73,6 +76,14 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * Save the SVG to the output stream without getting it into a string first.
+     * Unless the systems are flushed (see SetFlushSystems), the SVG document is built entirely in memory before it is
+     * saved.
+     * Add the xml tag if necessary.
+     */
+    void SaveSVG(std::ostream &output, bool xml_declaration = false);
+
     /**
      * @name Drawing methods
      */
@@ -217,6 +228,13 @@ public:
      */
     void SetFormatRaw(bool rawFormat) { m_formatRaw = rawFormat; }
 
+    /**
+     * Serialize the group of each system as soon as it is drawn instead of keeping it in the SVG document.
+     * The output is the same. The systems of a page are not flushed if the group of a time spanning element has to be
+     * resumed when drawing another system.
+     */
+    void SetFlushSystems(bool flushSystems) { m_flushSystems = flushSystems; }
+
     /**
      * Removes the xlink: prefex on href attributes, necessary for some newer browsers.
      */
@@ -279,17 +297,40 @@ private:
     void IncludeTextFont(const std::string &fontname, const Resources *resources);
 
     /**
-     * Flush the data to the internal buffer.
+     * Complete the SVG document before it is written.
      * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs
      */
     void Commit(bool xml_declaration);
 
+    /**
+     * Serialize the group of a system and replace it by a placeholder in the document.
+     * Consecutive systems share the same placeholder.
+     */
+    void FlushSystem(const Object *system, pugi::xml_node node);
+
+    /**
+     * Check if the systems of a page can be flushed.
+     * The group of a time spanning element is resumed when drawing the system of its start.
+     */
+    bool CanFlushSystems(const Object *page) const;
+
+    /**
+     * Save the SVG document to the writer with the flushed systems in place of their placeholder
+     */
+    void SaveDocument(pugi::xml_writer &writer);
+
     void WriteLine(std::string);
 
     std::string GetColor(int color);
 
     pugi::xml_node AddChild(std::string name);
 
+    /**
+     * Return the <defs> content of the glyph, which is loaded from its XML file only once per process.
+     * The document returned is never modified and can be read concurrently.
+     */
+    static const pugi::xml_document *GetGlyphDefs(const Glyph *glyph);
+
     /**
      * Transform pen properties into stroke attributes
      */
@@ -314,11 +355,11 @@ private:
      */
     bool m_vrvTextFontFallback;
 
-    // we use a std::stringstream because we want to prepend the <defs> which will know only when we reach the end of
-    // the page
+    // the document is written only once committed because we want to prepend the <defs> which will know only when we
+    // reach the end of the page
     // some viewer seem to support to have the <defs> at the end, but some do not (pdf2svg, for example)
-    // for this reason, the full svg is finally written a string from the destructor or when Flush() is called
-    std::ostringstream m_outdata;
+    // the output flags are set when committing
+    unsigned int m_outputFlags;
 
     bool m_committed; // did we flushed the file?
     int m_originX, m_originY;
@@ -357,6 +398,23 @@ private:
     std::string m_glyphPostfixId;
     // embedding of the smufl text font
     option_SMUFLTEXTFONT m_smuflTextFont;
+    // serialize the systems as soon as they are drawn
+    bool m_flushSystems;
+    // the systems serialized for each placeholder, in document order
+    std::vector<std::string> m_flushedSystems;
+    // the placeholder comment
+    std::string m_flushPlaceholder;
+    // flags indicating if the page was checked and if its systems can be flushed
+    bool m_flushChecked;
+    bool m_canFlushSystems;
+
+    //----------------//
+    // Static members //
+    //----------------//
+
+    // the glyph <defs> loaded so far, by glyph file path, and the mutex protecting them
+    static std::map<std::string, std::unique_ptr<pugi::xml_document>> s_glyphDefs;
+    static std::mutex s_glyphDefsMutex;
 };
 
 } // namespace vrv
@@ -130,6 +130,15 @@ public:
     void IsDrawingOptimized(bool drawingIsOptimized) { m_drawingIsOptimized = drawingIsOptimized; }
     ///@}
 
+    /**
+     * @name Setter and getter of the flag indicating that the layout of the system needs to be redone.
+     * The flag is set when the content is edited and reset when the page is laid out.
+     */
+    ///@{
+    bool IsLayoutDirty() const { return m_layoutDirty; }
+    void SetLayoutDirty(bool layoutDirty) { m_layoutDirty = layoutDirty; }
+    ///@}
+
     /**
      * Add an object to the drawing list but only if necessary.
      * Check types but also links (dynam, dir) and extensions (trill).
@@ -219,6 +228,15 @@ public:
     int m_castOffTotalWidth;
     int m_castOffJustifiableWidth;
     ///@}
+    /**
+     * @name The cast off vertical position (from the top of the page content) and height of the system.
+     * They are computed during castoff and used for casting off the pages again without laying out the systems.
+     * VRV_UNSET if the system was not cast off into pages.
+     */
+    ///@{
+    int m_castOffYRel;
+    int m_castOffHeight;
+    ///@}
 
 protected:
     /**
@@ -243,6 +261,11 @@ private:
      * This does not mean that a staff is hidden, but only that it can be optimized.
      */
     bool m_drawingIsOptimized;
+
+    /**
+     * A flag indicating that the content of the system was edited since the page was laid out.
+     */
+    bool m_layoutDirty;
 };
 
 } // namespace vrv
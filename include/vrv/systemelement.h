@@ -36,6 +36,15 @@ public:
     void Reset() override;
     ///@}
 
+    /**
+     * @name Getter and setter for the visibility.
+     * Changing it notifies the document since it changes the content of visible-only traversals.
+     */
+    ///@{
+    VisibilityType GetVisibility() const { return m_visibility; }
+    void SetVisibility(VisibilityType visibility);
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -53,14 +62,13 @@ public:
 private:
     //
 public:
+    //
+private:
     /**
      * Holds the visibility (hidden or visible) for an system element.
      * By default, a system element is visible. It can be hidden when expansion are processed.
      */
     VisibilityType m_visibility;
-
-private:
-    //
 };
 
 } // namespace vrv
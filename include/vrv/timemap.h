@@ -76,6 +76,79 @@ private:
 
 }; // class Timemap
 
+//----------------------------------------------------------------------------
+// TimeInterval
+//----------------------------------------------------------------------------
+
+/**
+ * Helper struct to store the time interval of an object
+ * The order is the position of the object in the document and the repeat is the playing repeat time for measures.
+ */
+struct TimeInterval {
+    double onset;
+    double offset;
+    Object *object;
+    int order;
+    int repeat = 0;
+};
+
+//----------------------------------------------------------------------------
+// TimeIntervalIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds time intervals sorted by onset for looking up the ones enclosing a given time.
+ */
+class TimeIntervalIndex {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    TimeIntervalIndex();
+    virtual ~TimeIntervalIndex();
+    ///@}
+
+    /** Resets the index */
+    void Reset();
+
+    /**
+     * Add an interval - Sort() has to be called once all intervals are added
+     */
+    void AddInterval(const TimeInterval &interval);
+
+    /**
+     * Sort the intervals by onset
+     */
+    void Sort();
+
+    /**
+     * Return the intervals enclosing the time (onset <= time <= offset) ordered by order and repeat
+     */
+    std::vector<const TimeInterval *> FindIntervalsAt(double time) const { return this->FindIntervalsBetween(time, time); }
+
+    /**
+     * Return the intervals overlapping the time range (onset <= end and offset >= start) ordered by order and repeat
+     */
+    std::vector<const TimeInterval *> FindIntervalsBetween(double start, double end) const;
+
+    /**
+     * Return the intervals sorted by onset
+     */
+    const std::vector<TimeInterval> &GetIntervals() const { return m_intervals; }
+
+private:
+    //
+public:
+    //
+private:
+    /** The intervals sorted by onset */
+    std::vector<TimeInterval> m_intervals;
+    /** The longest interval, which bounds the intervals to look at before the time */
+    double m_maxDuration;
+
+}; // class TimeIntervalIndex
+
 } // namespace vrv
 
 #endif // __VRV_TIMEMAP_H__
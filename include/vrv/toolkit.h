@@ -8,6 +8,7 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <functional>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -19,15 +20,109 @@
 
 //----------------------------------------------------------------------------
 
+namespace hum {
+class HumdrumFileSet;
+}
+
+namespace jsonxx {
+class Object;
+}
+
 namespace vrv {
 
 class EditorToolkit;
+class FeatureIndex;
+class HumdrumInput;
 class RuntimeClock;
+class SvgDeviceContext;
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
  */
 
+//----------------------------------------------------------------------------
+// LayoutCache
+//----------------------------------------------------------------------------
+
+/**
+ * This abstract class is the interface of the stores in which the toolkit caches the cast-off layouts.
+ * The keys are hashes of the input data and of the options used up to the cast-off. The stores can be shared by
+ * several toolkits and must be thread-safe if the toolkits are used in different threads.
+ */
+class LayoutCache {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    LayoutCache() {}
+    virtual ~LayoutCache() = default;
+    ///@}
+
+    /**
+     * Get the cached data for a key, returning false if there is none
+     */
+    virtual bool Get(const std::string &key, std::string &data) = 0;
+
+    /**
+     * Store the data for a key
+     */
+    virtual void Put(const std::string &key, const std::string &data) = 0;
+};
+
+//----------------------------------------------------------------------------
+// LayoutCacheDir
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the cast-off layouts in a directory with one file per key.
+ * It is used by the toolkit when the layoutCache option is set.
+ * When the directory has more files than the maximum, the oldest ones are removed.
+ */
+class LayoutCacheDir : public LayoutCache {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    LayoutCacheDir() : m_maxFiles(1000) {}
+    virtual ~LayoutCacheDir() = default;
+    ///@}
+
+    /**
+     * Getter/Setter for the directory
+     */
+    ///@{
+    const std::string &GetDir() const { return m_dir; }
+    void SetDir(const std::string &dir) { m_dir = dir; }
+    ///@}
+
+    /**
+     * Getter/Setter for the maximum number of files in the directory (0 for no maximum)
+     */
+    ///@{
+    int GetMaxFiles() const { return m_maxFiles; }
+    void SetMaxFiles(int maxFiles) { m_maxFiles = maxFiles; }
+    ///@}
+
+    bool Get(const std::string &key, std::string &data) override;
+    void Put(const std::string &key, const std::string &data) override;
+
+private:
+    /**
+     * Remove the oldest files until a tenth of the maximum is free
+     */
+    void Evict();
+
+public:
+    //
+private:
+    // The directory of the cache files
+    std::string m_dir;
+    // The maximum number of files in the directory
+    int m_maxFiles;
+};
+
 //----------------------------------------------------------------------------
 // Toolkit
 //----------------------------------------------------------------------------
@@ -357,6 +452,24 @@ public:
      */
     std::string RenderToSVG(int pageNo = 1, bool xmlDeclaration = false);
 
+    /**
+     * Render a range of pages to SVG.
+     *
+     * The pages are laid out and rendered concurrently with the number of threads set by the layoutThreads option.
+     * The IDs of the elements generated while drawing differ between one and several threads. Since drawing a page
+     * changes the document (e.g., the drawing page and the current scoreDefs), each thread draws the pages from its
+     * own copy of the document. All the pages are kept until the end; use ProcessPages with an output function for
+     * passing them on as they are rendered.
+     *
+     * @remark nojs
+     *
+     * @param firstPage The first page to render (1-based)
+     * @param lastPage The last page to render (1-based, 0 for the last page of the document)
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG pages as a vector of strings in page order
+     */
+    std::vector<std::string> RenderToSVGPages(int firstPage = 1, int lastPage = 0, bool xmlDeclaration = false);
+
     /**
      * Render a page to SVG and save it to the file.
      *
@@ -538,6 +651,102 @@ public:
      */
     std::string GetDescriptiveFeatures(const std::string &jsonOptions);
 
+    /**
+     * Return descriptive features for a batch of inputs.
+     *
+     * Each input is loaded by a worker toolkit with the options of this toolkit but without layout, leaving the
+     * document of this toolkit untouched. The number of threads is given by the layoutThreads option. The IDs are
+     * seeded with the xmlIdSeed option before loading each input. With a non-zero seed, the features do not depend on
+     * the batch size or on the number of threads. With a zero seed, the IDs are random for each input.
+     *
+     * @param inputs The data of the inputs as they would be passed to loadData
+     * @param jsonOptions A stringified JSON object with the feature extraction options
+     * @return A single-line stringified JSON object for each input in the order of the inputs, or an empty string for
+     * the inputs that could not be loaded
+     *
+     * @remark nojs
+     */
+    std::vector<std::string> GetDescriptiveFeaturesBatch(
+        const std::vector<std::string> &inputs, const std::string &jsonOptions);
+
+    /**
+     * Add the descriptive features of a batch of inputs to the feature index of the toolkit.
+     *
+     * The inputs are loaded as with getDescriptiveFeaturesBatch. The index can be saved to a file and queried with
+     * queryFeatureIndex.
+     *
+     * @param inputs The data of the inputs as they would be passed to loadData
+     * @param docIds The IDs of the documents returned by the queries, or an empty array for numbering them in the
+     * order they are added
+     * @return True if all the inputs were loaded and added to the index
+     *
+     * @remark nojs
+     */
+    bool AddToFeatureIndex(const std::vector<std::string> &inputs, const std::vector<std::string> &docIds);
+
+    /**
+     * Save the feature index of the toolkit to a file.
+     *
+     * @remark nojs
+     *
+     * @param filename The output filename
+     * @return True if the file was successfully written
+     */
+    bool SaveFeatureIndex(const std::string &filename);
+
+    /**
+     * Load a feature index from a file, replacing the feature index of the toolkit.
+     *
+     * @remark nojs
+     *
+     * @param filename The filename of a feature index saved with saveFeatureIndex
+     * @return True if the file was successfully read
+     */
+    bool LoadFeatureIndex(const std::string &filename);
+
+    /**
+     * Query the feature index of the toolkit.
+     *
+     * The query is a sequence of values of one of the descriptive features, such as
+     * {"feature": "intervalsChromatic", "values": ["2", "-1", "3"], "limit": 100}.
+     * The documents are returned in the order they were added to the index, with the IDs of the notes of each match.
+     *
+     * @remark nojs
+     *
+     * @param jsonQuery A stringified JSON object with the feature, the values and the maximum number of documents
+     * @return A stringified JSON object with the number of documents matching and the documents returned
+     */
+    std::string QueryFeatureIndex(const std::string &jsonQuery);
+
+    /**
+     * Return the functor profile as a JSON string.
+     *
+     * The profiler is global to the process and is enabled with EnableFunctorProfiler. The profile is shared by all
+     * the toolkits of the process. Functors are listed by decreasing processing time.
+     *
+     * @return A stringified JSON array with the number of calls, the time in milliseconds, the
+     * number of nodes visited and the number of accept calls for each functor class
+     */
+    std::string GetFunctorProfile() const;
+
+    /**
+     * Reset the functor profile.
+     */
+    void ResetFunctorProfile();
+
+    /**
+     * Return a memory report of the loaded document as a JSON string.
+     *
+     * The objects of the document are counted by class. The att classes and interfaces registered by the objects
+     * are shared by all the objects of a class and by all the documents of the process. The size of a class is
+     * given only for the classes of MEI elements. It excludes the memory the objects allocate, such as strings.
+     *
+     * @return A stringified JSON object with the number of objects, the size of the base object in bytes, the
+     * total size of the objects of known size, the number, size and total size of the objects of each class, and
+     * the number and size in bytes of the shared registrations
+     */
+    std::string GetMemoryReport() const;
+
     /**
      * Return array of IDs of elements being currently played.
      *
@@ -546,6 +755,18 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * Return the changes of the elements being played within a time range.
+     *
+     * The first entry gives the elements being played at the start time and each following entry
+     * the elements being played from the time at which they change.
+     *
+     * @param startMillisec The start time in milliseconds
+     * @param endMillisec The end time in milliseconds
+     * @return A stringified JSON array with the time, page and notes being played for each change
+     */
+    std::string GetElementChangesInTimeRange(int startMillisec, int endMillisec);
+
     /**
      * Return the page on which the element is the ID (\@xml:id) is rendered
      *
@@ -625,9 +846,10 @@ public:
      *
      * This can be called once the rendering option were changed, for example with a new page (sceen) height or a new
      * zoom level.
+     * Only the layout stages invalidated by the options changed since the last layout are redone.
      *
      * @param jsonOptions A stringified JSON object with the action options
-     * resetCache: true or false; true by default;
+     * resetCache: true or false; true by default, unless only options not affecting the horizontal layout changed;
      */
     void RedoLayout(const std::string &jsonOptions = "");
 
@@ -661,6 +883,52 @@ public:
      */
     bool RenderToDeviceContext(int pageNo, DeviceContext *deviceContext);
 
+    /**
+     * Set the SVG options on the SvgDeviceContext and render the page to it.
+     *
+     * Page number is 1-based.
+     *
+     * @ingroup nodoc
+     */
+    void RenderToSvgDeviceContext(int pageNo, SvgDeviceContext *svg);
+
+    /**
+     * Process a list of pages with a pool of worker toolkits.
+     *
+     * The number of threads is given by the layoutThreads option. This toolkit processes pages in the calling thread
+     * while each additional worker loads a page-based MEI copy of the document and takes the next pages once loaded.
+     * The workers get the IDs of the document, and the IDs generated for a page are taken from a range given by the
+     * page number, so the output is the same with any number of workers. The process function is called from the
+     * worker threads and must only use the toolkit passed to it without changing the structure of its document. The
+     * pages are all processed by this toolkit as before with one thread or when the document cannot be copied (e.g.,
+     * with a selection), in which case the IDs generated are not changed.
+     *
+     * The optional output function is called for each page in the order of the list as soon as the page and the ones
+     * before it are processed, by one thread at a time. The processing stops when it returns false.
+     *
+     * Page numbers are 1-based.
+     *
+     * @return True if the process function returned true for all pages and the processing was not stopped
+     *
+     * @ingroup nodoc
+     */
+    bool ProcessPages(const std::vector<int> &pageNos, const std::function<bool(Toolkit &, int)> &process,
+        const std::function<bool(int)> &output = nullptr);
+
+    /**
+     * Set a store for caching the cast-off layouts.
+     *
+     * Loading data that was already cast off with the same options then loads the cached page-based MEI instead.
+     * This skips the import of the input format and the cast-off, but the page-based MEI is still imported and
+     * prepared. The layout is stored only when the same data is loaded a second time, the first load storing a
+     * small marker. The store is not owned by the toolkit and replaces the directory given by the layoutCache
+     * option.
+     * NULL resets it.
+     *
+     * @ingroup nodoc
+     */
+    void SetLayoutCache(LayoutCache *layoutCache) { m_layoutCache = layoutCache; }
+
     /**
      * Return the Options object of the Toolkit instance.
      *
@@ -707,6 +975,13 @@ public:
      */
     const char *GetHumdrumBuffer();
 
+    /**
+     * Keep the Humdrum files parsed by the input for serializing them only when requested.
+     *
+     * @ingroup nodoc
+     */
+    void SetHumdrumFiles(HumdrumInput *input);
+
     /**
      * Clear the Humdrum buffer of any contents.
      *
@@ -771,6 +1046,67 @@ private:
     bool LoadZipData(const std::vector<unsigned char> &bytes);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
+    /**
+     * Fill the JSON object with the measure, page and notes, chords and rests being played
+     */
+    void ElementsAtTimeToJson(Measure *measure, const ListOfObjects &notesOrRests, jsonxx::Object &o) const;
+
+    /**
+     * Check if the document can be passed to worker toolkits and copy the resources and the options to the worker.
+     * The worker has to be set up before this toolkit draws anything since drawing changes the resources.
+     */
+    ///@{
+    bool CanUseLayoutWorkers() const;
+    void InitLayoutWorker(Toolkit &worker) const;
+    ///@}
+
+    /**
+     * Append the class, the number of children and the ID of the object and of its descendants in pre-order,
+     * including the ones returned by GetDrawnMembers.
+     * Set the IDs of the object and of its descendants from them, failing if the structure does not match.
+     */
+    ///@{
+    static void GetObjectIDs(const Object *object, ArrayOfObjectIDTuples &objectIDs);
+    static bool SetObjectIDs(Object *object, const ArrayOfObjectIDTuples &objectIDs, int &index);
+    ///@}
+
+    /**
+     * Return the objects owned by the object that are not children but drawn with their IDs (e.g., the barlines
+     * of a measure or the scoreDef drawn at the beginning of a system).
+     */
+    static ArrayOfConstObjects GetDrawnMembers(const Object *object);
+
+    /**
+     * Load a page-based MEI document with the cast-off system widths it was written with.
+     * The options applied before the cast-off (e.g., transposition or expansion) are not applied again.
+     * With isCastOff, the scoreDefs are optimized as at the end of the cast-off and the document is marked as cast off.
+     */
+    bool LoadCastOffMEI(
+        const std::string &pageBasedMEI, const std::vector<std::pair<int, int>> &castOffWidths, bool isCastOff);
+
+    /**
+     * Return the store for caching the cast-off layouts, or NULL if there is none.
+     * Also return the key of the data and the current options in the store.
+     */
+    LayoutCache *GetLayoutCache(const std::string &data, FileFormat inputFormat, std::string &key);
+
+    /**
+     * Return the cast-off document serialized for the layout cache, or load it.
+     */
+    ///@{
+    std::string GetLayoutCacheData();
+    bool LoadLayoutCacheData(const std::string &cacheData);
+    ///@}
+
+    /**
+     * Process a list of inputs with a pool of worker toolkits set up by InitInputWorker.
+     * The process function is called with the worker and the index of the input it has to load.
+     */
+    ///@{
+    bool ProcessInputs(const std::vector<std::string> &inputs, const std::function<bool(Toolkit &, int)> &process);
+    void InitInputWorker(Toolkit &worker) const;
+    ///@}
+
     /**
      * Return a dictionary of all the options
      *
@@ -795,18 +1131,46 @@ private:
      */
     char *m_cString;
 
+    /**
+     * The Humdrum buffer string.
+     */
+    char *m_humdrumBuffer;
+
+    /**
+     * The Humdrum files kept from the import, serialized into the buffer on demand.
+     */
+    hum::HumdrumFileSet *m_humdrumFiles;
+
+    /**
+     * Set for the worker toolkits created by ProcessPages and ProcessInputs.
+     * Also set while ProcessPages runs workers so that the pages processed do not clear the log buffer.
+     */
+    bool m_isWorker;
+
+    /**
+     * The option values with which the document was last cast off.
+     * Edited systems are laid out again without cast-off only if they did not change.
+     * Otherwise only the layout stages invalidated by the changed options are redone.
+     */
+    std::map<std::string, std::string> m_castOffOptions;
+
     EditorToolkit *m_editorToolkit;
 
+    /**
+     * The feature index built or loaded by the toolkit, created when first used.
+     */
+    FeatureIndex *m_featureIndex;
+
+    /**
+     * The store set with SetLayoutCache and the directory store used with the layoutCache option
+     */
+    LayoutCache *m_layoutCache;
+    LayoutCacheDir m_layoutCacheDir;
+
 #ifndef NO_RUNTIME
     /** Measuring runtime */
     RuntimeClock *m_runtimeClock;
 #endif
-
-    //----------------//
-    // Static members //
-    //----------------//
-
-    static char *m_humdrumBuffer;
 };
 
 } // namespace vrv
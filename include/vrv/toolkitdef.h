@@ -27,7 +27,8 @@ enum FileFormat {
     ESAC,
     MIDI,
     TIMEMAP,
-    EXPANSIONMAP
+    EXPANSIONMAP,
+    FEATURES
 };
 
 enum { LOG_OFF = 0, LOG_ERROR, LOG_WARNING, LOG_INFO, LOG_DEBUG };
@@ -50,6 +51,7 @@ void SetDefaultResourcePath(const std::string &path);
 
 void EnableLog(LogLevel level);
 void EnableLogToBuffer(bool value);
+void EnableFunctorProfiler(bool value);
 
 } // namespace vrv
 
@@ -692,17 +692,6 @@ protected:
      * modified appropriately when going through the page.
      */
     ScoreDef m_drawingScoreDef;
-
-private:
-    //----------------//
-    // Static members //
-    //----------------//
-
-    /** @name Internal values for storing temporary values for ligatures */
-    ///@{
-    static thread_local int s_drawingLigX[2], s_drawingLigY[2];
-    static thread_local bool s_drawingLigObliqua;
-    ///@}
 };
 
 } // namespace vrv
@@ -12,6 +12,7 @@
 #include <cstdio>
 #include <cstring>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -41,8 +42,10 @@ void LogWarning(const char *fmt, ...);
 
 /**
  * Member and functions specific to logging that uses a vector of string to buffer the logs.
+ * The buffer is shared by all threads and has to be accessed with the logBufferMutex locked.
  */
 extern std::vector<std::string> logBuffer;
+extern std::mutex logBufferMutex;
 bool LogBufferContains(const std::string &s);
 void LogString(std::string message, LogLevel level);
 
@@ -14,6 +14,7 @@
 #include <map>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -347,6 +348,8 @@ typedef std::vector<std::tuple<Alignment *, Alignment *, int>> ArrayOfAdjustment
 
 typedef std::vector<std::tuple<Alignment *, Arpeg *, int, bool>> ArrayOfAlignmentArpegTuples;
 
+typedef std::vector<std::tuple<ClassId, int, std::string>> ArrayOfObjectIDTuples;
+
 typedef std::vector<BeamElementCoord *> ArrayOfBeamElementCoords;
 
 typedef std::vector<std::pair<int, int>> ArrayOfIntPairs;
@@ -393,6 +396,10 @@ typedef std::map<std::string, std::function<Object *(void)>> MapOfStrConstructor
 
 typedef std::map<std::string, ClassId> MapOfStrClassIds;
 
+typedef std::unordered_map<std::string, const Object *> MapOfStrConstObjects;
+
+typedef std::map<ClassId, ArrayOfConstObjects> MapOfClassIdConstObjects;
+
 typedef std::vector<std::pair<LayerElement *, LayerElement *>> MeasureTieEndpoints;
 
 typedef bool (*NotePredicate)(const Note *);
@@ -684,6 +691,15 @@ enum GraphicID { PRIMARY = 0, SPANNING, SYMBOLREF };
 #define SUPER_SCRIPT_POSITION -0.20 // lowered down from the midline
 #define SUB_SCRIPT_POSITION -0.17 // lowered down from the baseline
 
+// in drawing units - wider overflow boxes are not sorted in the BoundingBoxIndex
+#define BBOX_INDEX_MAX_WIDTH 20
+
+// the length of the n-grams in the FeatureIndex - queries shorter than this are looked up by prefix
+#define FEATURE_INDEX_NGRAM_LENGTH 3
+
+// the maximum number of functors in a CompositeFunctor - the functors processed for each object are kept as bits
+#define COMPOSITE_FUNCTOR_MAX 32
+
 //----------------------------------------------------------------------------
 // Neume notation note size to staff size ratio defines
 //----------------------------------------------------------------------------
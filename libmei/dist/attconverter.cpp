@@ -65,29 +65,14 @@ std::string AttConverterBase::AccidentalGesturalToStr(data_ACCIDENTAL_GESTURAL d
 
 data_ACCIDENTAL_GESTURAL AttConverterBase::StrToAccidentalGestural(const std::string &value, bool logWarning) const
 {
-    if (value == "s") return ACCIDENTAL_GESTURAL_s;
-    if (value == "f") return ACCIDENTAL_GESTURAL_f;
-    if (value == "ss") return ACCIDENTAL_GESTURAL_ss;
-    if (value == "ff") return ACCIDENTAL_GESTURAL_ff;
-    if (value == "ts") return ACCIDENTAL_GESTURAL_ts;
-    if (value == "tf") return ACCIDENTAL_GESTURAL_tf;
-    if (value == "n") return ACCIDENTAL_GESTURAL_n;
-    if (value == "su") return ACCIDENTAL_GESTURAL_su;
-    if (value == "sd") return ACCIDENTAL_GESTURAL_sd;
-    if (value == "fu") return ACCIDENTAL_GESTURAL_fu;
-    if (value == "fd") return ACCIDENTAL_GESTURAL_fd;
-    if (value == "xu") return ACCIDENTAL_GESTURAL_xu;
-    if (value == "ffd") return ACCIDENTAL_GESTURAL_ffd;
-    if (value == "bms") return ACCIDENTAL_GESTURAL_bms;
-    if (value == "kms") return ACCIDENTAL_GESTURAL_kms;
-    if (value == "bs") return ACCIDENTAL_GESTURAL_bs;
-    if (value == "ks") return ACCIDENTAL_GESTURAL_ks;
-    if (value == "kf") return ACCIDENTAL_GESTURAL_kf;
-    if (value == "bf") return ACCIDENTAL_GESTURAL_bf;
-    if (value == "kmf") return ACCIDENTAL_GESTURAL_kmf;
-    if (value == "bmf") return ACCIDENTAL_GESTURAL_bmf;
-    if (value == "koron") return ACCIDENTAL_GESTURAL_koron;
-    if (value == "sori") return ACCIDENTAL_GESTURAL_sori;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 2, 0, 8, 18, 0, 9, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 11, 0, 0, 10, 17, 0, 13,
+        1, 7, 0, 0, 0, 3, 16, 0, 0, 0, 0, 0, 21, 20, 0, 0, 0, 0, 0, 4, 0, 0, 0, 19, 22, 0, 0, 0, 15, 14, 12, 0, 0, 0,
+        23, 0, 0, 6, 0 };
+    static const char *const values[23] = { "s", "f", "ss", "ff", "ts", "tf", "n", "su", "sd", "fu", "fd", "xu", "ffd",
+        "bms", "kms", "bs", "ks", "kf", "bf", "kmf", "bmf", "koron", "sori" };
+    const uint8_t slot = slots[HashValue(value, 21) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_ACCIDENTAL_GESTURAL>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.ACCIDENTAL.GESTURAL", value.c_str());
     return ACCIDENTAL_GESTURAL_NONE;
@@ -207,42 +192,16 @@ std::string AttConverterBase::AccidentalWrittenToStr(data_ACCIDENTAL_WRITTEN dat
 
 data_ACCIDENTAL_WRITTEN AttConverterBase::StrToAccidentalWritten(const std::string &value, bool logWarning) const
 {
-    if (value == "s") return ACCIDENTAL_WRITTEN_s;
-    if (value == "f") return ACCIDENTAL_WRITTEN_f;
-    if (value == "ss") return ACCIDENTAL_WRITTEN_ss;
-    if (value == "x") return ACCIDENTAL_WRITTEN_x;
-    if (value == "ff") return ACCIDENTAL_WRITTEN_ff;
-    if (value == "xs") return ACCIDENTAL_WRITTEN_xs;
-    if (value == "sx") return ACCIDENTAL_WRITTEN_sx;
-    if (value == "ts") return ACCIDENTAL_WRITTEN_ts;
-    if (value == "tf") return ACCIDENTAL_WRITTEN_tf;
-    if (value == "n") return ACCIDENTAL_WRITTEN_n;
-    if (value == "nf") return ACCIDENTAL_WRITTEN_nf;
-    if (value == "ns") return ACCIDENTAL_WRITTEN_ns;
-    if (value == "su") return ACCIDENTAL_WRITTEN_su;
-    if (value == "sd") return ACCIDENTAL_WRITTEN_sd;
-    if (value == "fu") return ACCIDENTAL_WRITTEN_fu;
-    if (value == "fd") return ACCIDENTAL_WRITTEN_fd;
-    if (value == "nu") return ACCIDENTAL_WRITTEN_nu;
-    if (value == "nd") return ACCIDENTAL_WRITTEN_nd;
-    if (value == "xu") return ACCIDENTAL_WRITTEN_xu;
-    if (value == "xd") return ACCIDENTAL_WRITTEN_xd;
-    if (value == "ffu") return ACCIDENTAL_WRITTEN_ffu;
-    if (value == "ffd") return ACCIDENTAL_WRITTEN_ffd;
-    if (value == "1qf") return ACCIDENTAL_WRITTEN_1qf;
-    if (value == "3qf") return ACCIDENTAL_WRITTEN_3qf;
-    if (value == "1qs") return ACCIDENTAL_WRITTEN_1qs;
-    if (value == "3qs") return ACCIDENTAL_WRITTEN_3qs;
-    if (value == "bms") return ACCIDENTAL_WRITTEN_bms;
-    if (value == "kms") return ACCIDENTAL_WRITTEN_kms;
-    if (value == "bs") return ACCIDENTAL_WRITTEN_bs;
-    if (value == "ks") return ACCIDENTAL_WRITTEN_ks;
-    if (value == "kf") return ACCIDENTAL_WRITTEN_kf;
-    if (value == "bf") return ACCIDENTAL_WRITTEN_bf;
-    if (value == "kmf") return ACCIDENTAL_WRITTEN_kmf;
-    if (value == "bmf") return ACCIDENTAL_WRITTEN_bmf;
-    if (value == "koron") return ACCIDENTAL_WRITTEN_koron;
-    if (value == "sori") return ACCIDENTAL_WRITTEN_sori;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[128] = { 0, 0, 0, 0, 23, 35, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 14, 0, 6, 16, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 3, 19, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 24, 0, 13, 0, 0, 0, 0, 0, 2, 36, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 34, 0, 0, 4, 0, 0, 0, 0, 28, 27, 0, 0, 0, 10, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 21,
+        20, 17, 0, 29, 0, 1, 0, 0, 0, 8, 0, 0, 32, 0, 0, 0, 5, 0, 9, 0, 0, 0, 0, 0, 11, 15, 30, 25, 22, 0, 0, 0 };
+    static const char *const values[36] = { "s", "f", "ss", "x", "ff", "xs", "sx", "ts", "tf", "n", "nf", "ns", "su",
+        "sd", "fu", "fd", "nu", "nd", "xu", "xd", "ffu", "ffd", "1qf", "3qf", "1qs", "3qs", "bms", "kms", "bs", "ks",
+        "kf", "bf", "kmf", "bmf", "koron", "sori" };
+    const uint8_t slot = slots[HashValue(value, 17) & 127];
+    if (slot && value == values[slot - 1]) return static_cast<data_ACCIDENTAL_WRITTEN>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN", value.c_str());
     return ACCIDENTAL_WRITTEN_NONE;
@@ -274,18 +233,12 @@ std::string AttConverterBase::AccidentalWrittenBasicToStr(data_ACCIDENTAL_WRITTE
 
 data_ACCIDENTAL_WRITTEN_basic AttConverterBase::StrToAccidentalWrittenBasic(const std::string &value, bool logWarning) const
 {
-    if (value == "s") return ACCIDENTAL_WRITTEN_basic_s;
-    if (value == "f") return ACCIDENTAL_WRITTEN_basic_f;
-    if (value == "ss") return ACCIDENTAL_WRITTEN_basic_ss;
-    if (value == "x") return ACCIDENTAL_WRITTEN_basic_x;
-    if (value == "ff") return ACCIDENTAL_WRITTEN_basic_ff;
-    if (value == "xs") return ACCIDENTAL_WRITTEN_basic_xs;
-    if (value == "sx") return ACCIDENTAL_WRITTEN_basic_sx;
-    if (value == "ts") return ACCIDENTAL_WRITTEN_basic_ts;
-    if (value == "tf") return ACCIDENTAL_WRITTEN_basic_tf;
-    if (value == "n") return ACCIDENTAL_WRITTEN_basic_n;
-    if (value == "nf") return ACCIDENTAL_WRITTEN_basic_nf;
-    if (value == "ns") return ACCIDENTAL_WRITTEN_basic_ns;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 0, 0, 1, 3, 0, 0, 12, 4, 0, 0, 0, 0, 0, 5, 7, 0, 8, 10, 0, 0, 0, 11, 0, 0, 0, 2,
+        0, 0, 6, 0, 0, 9 };
+    static const char *const values[12] = { "s", "f", "ss", "x", "ff", "xs", "sx", "ts", "tf", "n", "nf", "ns" };
+    const uint8_t slot = slots[HashValue(value, 0) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_ACCIDENTAL_WRITTEN_basic>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN.basic", value.c_str());
     return ACCIDENTAL_WRITTEN_basic_NONE;
@@ -319,20 +272,13 @@ std::string AttConverterBase::AccidentalWrittenExtendedToStr(data_ACCIDENTAL_WRI
 
 data_ACCIDENTAL_WRITTEN_extended AttConverterBase::StrToAccidentalWrittenExtended(const std::string &value, bool logWarning) const
 {
-    if (value == "su") return ACCIDENTAL_WRITTEN_extended_su;
-    if (value == "sd") return ACCIDENTAL_WRITTEN_extended_sd;
-    if (value == "fu") return ACCIDENTAL_WRITTEN_extended_fu;
-    if (value == "fd") return ACCIDENTAL_WRITTEN_extended_fd;
-    if (value == "nu") return ACCIDENTAL_WRITTEN_extended_nu;
-    if (value == "nd") return ACCIDENTAL_WRITTEN_extended_nd;
-    if (value == "xu") return ACCIDENTAL_WRITTEN_extended_xu;
-    if (value == "xd") return ACCIDENTAL_WRITTEN_extended_xd;
-    if (value == "ffu") return ACCIDENTAL_WRITTEN_extended_ffu;
-    if (value == "ffd") return ACCIDENTAL_WRITTEN_extended_ffd;
-    if (value == "1qf") return ACCIDENTAL_WRITTEN_extended_1qf;
-    if (value == "3qf") return ACCIDENTAL_WRITTEN_extended_3qf;
-    if (value == "1qs") return ACCIDENTAL_WRITTEN_extended_1qs;
-    if (value == "3qs") return ACCIDENTAL_WRITTEN_extended_3qs;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 1, 0, 0, 2, 0, 0, 4, 0, 0, 3, 0, 13, 10, 14, 6, 9, 8, 5, 0, 7, 11, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 12, 0 };
+    static const char *const values[14] = { "su", "sd", "fu", "fd", "nu", "nd", "xu", "xd", "ffu", "ffd", "1qf", "3qf",
+        "1qs", "3qs" };
+    const uint8_t slot = slots[HashValue(value, 1) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_ACCIDENTAL_WRITTEN_extended>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN.extended", value.c_str());
     return ACCIDENTAL_WRITTEN_extended_NONE;
@@ -448,44 +394,18 @@ std::string AttConverterBase::ArticulationToStr(data_ARTICULATION data) const
 
 data_ARTICULATION AttConverterBase::StrToArticulation(const std::string &value, bool logWarning) const
 {
-    if (value == "acc") return ARTICULATION_acc;
-    if (value == "acc-inv") return ARTICULATION_acc_inv;
-    if (value == "acc-long") return ARTICULATION_acc_long;
-    if (value == "acc-soft") return ARTICULATION_acc_soft;
-    if (value == "stacc") return ARTICULATION_stacc;
-    if (value == "ten") return ARTICULATION_ten;
-    if (value == "stacciss") return ARTICULATION_stacciss;
-    if (value == "marc") return ARTICULATION_marc;
-    if (value == "spicc") return ARTICULATION_spicc;
-    if (value == "stress") return ARTICULATION_stress;
-    if (value == "unstress") return ARTICULATION_unstress;
-    if (value == "doit") return ARTICULATION_doit;
-    if (value == "scoop") return ARTICULATION_scoop;
-    if (value == "rip") return ARTICULATION_rip;
-    if (value == "plop") return ARTICULATION_plop;
-    if (value == "fall") return ARTICULATION_fall;
-    if (value == "longfall") return ARTICULATION_longfall;
-    if (value == "bend") return ARTICULATION_bend;
-    if (value == "flip") return ARTICULATION_flip;
-    if (value == "smear") return ARTICULATION_smear;
-    if (value == "shake") return ARTICULATION_shake;
-    if (value == "dnbow") return ARTICULATION_dnbow;
-    if (value == "upbow") return ARTICULATION_upbow;
-    if (value == "harm") return ARTICULATION_harm;
-    if (value == "snap") return ARTICULATION_snap;
-    if (value == "fingernail") return ARTICULATION_fingernail;
-    if (value == "damp") return ARTICULATION_damp;
-    if (value == "dampall") return ARTICULATION_dampall;
-    if (value == "open") return ARTICULATION_open;
-    if (value == "stop") return ARTICULATION_stop;
-    if (value == "dbltongue") return ARTICULATION_dbltongue;
-    if (value == "trpltongue") return ARTICULATION_trpltongue;
-    if (value == "heel") return ARTICULATION_heel;
-    if (value == "toe") return ARTICULATION_toe;
-    if (value == "tap") return ARTICULATION_tap;
-    if (value == "lhpizz") return ARTICULATION_lhpizz;
-    if (value == "dot") return ARTICULATION_dot;
-    if (value == "stroke") return ARTICULATION_stroke;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[128] = { 29, 26, 27, 0, 0, 0, 0, 2, 5, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 6, 0, 0, 31, 0, 0, 0, 0, 37, 0, 0, 0, 0, 4, 0, 0, 0, 0, 28, 0, 0,
+        34, 0, 0, 14, 0, 16, 0, 11, 10, 0, 0, 0, 0, 7, 0, 18, 0, 0, 0, 0, 0, 8, 22, 19, 38, 0, 33, 36, 0, 0, 0, 15, 9,
+        35, 32, 0, 30, 0, 3, 0, 13, 0, 0, 0, 0, 0, 24, 0, 0, 0, 21, 0, 0, 1, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0
+        };
+    static const char *const values[38] = { "acc", "acc-inv", "acc-long", "acc-soft", "stacc", "ten", "stacciss",
+        "marc", "spicc", "stress", "unstress", "doit", "scoop", "rip", "plop", "fall", "longfall", "bend", "flip",
+        "smear", "shake", "dnbow", "upbow", "harm", "snap", "fingernail", "damp", "dampall", "open", "stop",
+        "dbltongue", "trpltongue", "heel", "toe", "tap", "lhpizz", "dot", "stroke" };
+    const uint8_t slot = slots[HashValue(value, 29) & 127];
+    if (slot && value == values[slot - 1]) return static_cast<data_ARTICULATION>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.ARTICULATION", value.c_str());
     return ARTICULATION_NONE;
@@ -545,21 +465,14 @@ std::string AttConverterBase::BarrenditionToStr(data_BARRENDITION data) const
 
 data_BARRENDITION AttConverterBase::StrToBarrendition(const std::string &value, bool logWarning) const
 {
-    if (value == "dashed") return BARRENDITION_dashed;
-    if (value == "dotted") return BARRENDITION_dotted;
-    if (value == "dbl") return BARRENDITION_dbl;
-    if (value == "dbldashed") return BARRENDITION_dbldashed;
-    if (value == "dbldotted") return BARRENDITION_dbldotted;
-    if (value == "dblheavy") return BARRENDITION_dblheavy;
-    if (value == "dblsegno") return BARRENDITION_dblsegno;
-    if (value == "end") return BARRENDITION_end;
-    if (value == "heavy") return BARRENDITION_heavy;
-    if (value == "invis") return BARRENDITION_invis;
-    if (value == "rptstart") return BARRENDITION_rptstart;
-    if (value == "rptboth") return BARRENDITION_rptboth;
-    if (value == "rptend") return BARRENDITION_rptend;
-    if (value == "segno") return BARRENDITION_segno;
-    if (value == "single") return BARRENDITION_single;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 5, 13, 0, 0, 0, 0, 7, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 9, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 11, 4, 0, 0, 0, 10, 0, 12, 0, 0, 0, 0, 0, 0, 2, 6, 0, 0, 0, 8, 0, 0, 0, 0,
+        3, 0 };
+    static const char *const values[15] = { "dashed", "dotted", "dbl", "dbldashed", "dbldotted", "dblheavy", "dblsegno",
+        "end", "heavy", "invis", "rptstart", "rptboth", "rptend", "segno", "single" };
+    const uint8_t slot = slots[HashValue(value, 1) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_BARRENDITION>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.BARRENDITION", value.c_str());
     return BARRENDITION_NONE;
@@ -617,19 +530,13 @@ std::string AttConverterBase::BetypeToStr(data_BETYPE data) const
 
 data_BETYPE AttConverterBase::StrToBetype(const std::string &value, bool logWarning) const
 {
-    if (value == "byte") return BETYPE_byte;
-    if (value == "smil") return BETYPE_smil;
-    if (value == "midi") return BETYPE_midi;
-    if (value == "mmc") return BETYPE_mmc;
-    if (value == "mtc") return BETYPE_mtc;
-    if (value == "smpte-25") return BETYPE_smpte_25;
-    if (value == "smpte-24") return BETYPE_smpte_24;
-    if (value == "smpte-df30") return BETYPE_smpte_df30;
-    if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
-    if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
-    if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
-    if (value == "tcf") return BETYPE_tcf;
-    if (value == "time") return BETYPE_time;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 0, 11, 0, 12, 1, 8, 7, 13, 0, 0, 0, 0, 0, 4, 0, 3, 0, 0, 0, 10, 0, 0, 0, 0, 0, 6,
+        0, 2, 5, 0, 0, 9 };
+    static const char *const values[13] = { "byte", "smil", "midi", "mmc", "mtc", "smpte-25", "smpte-24", "smpte-df30",
+        "smpte-ndf30", "smpte-df29.97", "smpte-ndf29.97", "tcf", "time" };
+    const uint8_t slot = slots[HashValue(value, 11) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_BETYPE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.BETYPE", value.c_str());
     return BETYPE_NONE;
@@ -930,154 +837,85 @@ std::string AttConverterBase::ColornamesToStr(data_COLORNAMES data) const
 
 data_COLORNAMES AttConverterBase::StrToColornames(const std::string &value, bool logWarning) const
 {
-    if (value == "aliceblue") return COLORNAMES_aliceblue;
-    if (value == "antiquewhite") return COLORNAMES_antiquewhite;
-    if (value == "aqua") return COLORNAMES_aqua;
-    if (value == "aquamarine") return COLORNAMES_aquamarine;
-    if (value == "azure") return COLORNAMES_azure;
-    if (value == "beige") return COLORNAMES_beige;
-    if (value == "bisque") return COLORNAMES_bisque;
-    if (value == "black") return COLORNAMES_black;
-    if (value == "blanchedalmond") return COLORNAMES_blanchedalmond;
-    if (value == "blue") return COLORNAMES_blue;
-    if (value == "blueviolet") return COLORNAMES_blueviolet;
-    if (value == "brown") return COLORNAMES_brown;
-    if (value == "burlywood") return COLORNAMES_burlywood;
-    if (value == "cadetblue") return COLORNAMES_cadetblue;
-    if (value == "chartreuse") return COLORNAMES_chartreuse;
-    if (value == "chocolate") return COLORNAMES_chocolate;
-    if (value == "coral") return COLORNAMES_coral;
-    if (value == "cornflowerblue") return COLORNAMES_cornflowerblue;
-    if (value == "cornsilk") return COLORNAMES_cornsilk;
-    if (value == "crimson") return COLORNAMES_crimson;
-    if (value == "cyan") return COLORNAMES_cyan;
-    if (value == "darkblue") return COLORNAMES_darkblue;
-    if (value == "darkcyan") return COLORNAMES_darkcyan;
-    if (value == "darkgoldenrod") return COLORNAMES_darkgoldenrod;
-    if (value == "darkgray") return COLORNAMES_darkgray;
-    if (value == "darkgreen") return COLORNAMES_darkgreen;
-    if (value == "darkgrey") return COLORNAMES_darkgrey;
-    if (value == "darkkhaki") return COLORNAMES_darkkhaki;
-    if (value == "darkmagenta") return COLORNAMES_darkmagenta;
-    if (value == "darkolivegreen") return COLORNAMES_darkolivegreen;
-    if (value == "darkorange") return COLORNAMES_darkorange;
-    if (value == "darkorchid") return COLORNAMES_darkorchid;
-    if (value == "darkred") return COLORNAMES_darkred;
-    if (value == "darksalmon") return COLORNAMES_darksalmon;
-    if (value == "darkseagreen") return COLORNAMES_darkseagreen;
-    if (value == "darkslateblue") return COLORNAMES_darkslateblue;
-    if (value == "darkslategray") return COLORNAMES_darkslategray;
-    if (value == "darkslategrey") return COLORNAMES_darkslategrey;
-    if (value == "darkturquoise") return COLORNAMES_darkturquoise;
-    if (value == "darkviolet") return COLORNAMES_darkviolet;
-    if (value == "deeppink") return COLORNAMES_deeppink;
-    if (value == "deepskyblue") return COLORNAMES_deepskyblue;
-    if (value == "dimgray") return COLORNAMES_dimgray;
-    if (value == "dimgrey") return COLORNAMES_dimgrey;
-    if (value == "dodgerblue") return COLORNAMES_dodgerblue;
-    if (value == "firebrick") return COLORNAMES_firebrick;
-    if (value == "floralwhite") return COLORNAMES_floralwhite;
-    if (value == "forestgreen") return COLORNAMES_forestgreen;
-    if (value == "fuchsia") return COLORNAMES_fuchsia;
-    if (value == "gainsboro") return COLORNAMES_gainsboro;
-    if (value == "ghostwhite") return COLORNAMES_ghostwhite;
-    if (value == "gold") return COLORNAMES_gold;
-    if (value == "goldenrod") return COLORNAMES_goldenrod;
-    if (value == "gray") return COLORNAMES_gray;
-    if (value == "green") return COLORNAMES_green;
-    if (value == "greenyellow") return COLORNAMES_greenyellow;
-    if (value == "grey") return COLORNAMES_grey;
-    if (value == "honeydew") return COLORNAMES_honeydew;
-    if (value == "hotpink") return COLORNAMES_hotpink;
-    if (value == "indianred") return COLORNAMES_indianred;
-    if (value == "indigo") return COLORNAMES_indigo;
-    if (value == "ivory") return COLORNAMES_ivory;
-    if (value == "khaki") return COLORNAMES_khaki;
-    if (value == "lavender") return COLORNAMES_lavender;
-    if (value == "lavenderblush") return COLORNAMES_lavenderblush;
-    if (value == "lawngreen") return COLORNAMES_lawngreen;
-    if (value == "lemonchiffon") return COLORNAMES_lemonchiffon;
-    if (value == "lightblue") return COLORNAMES_lightblue;
-    if (value == "lightcoral") return COLORNAMES_lightcoral;
-    if (value == "lightcyan") return COLORNAMES_lightcyan;
-    if (value == "lightgoldenrodyellow") return COLORNAMES_lightgoldenrodyellow;
-    if (value == "lightgray") return COLORNAMES_lightgray;
-    if (value == "lightgreen") return COLORNAMES_lightgreen;
-    if (value == "lightgrey") return COLORNAMES_lightgrey;
-    if (value == "lightpink") return COLORNAMES_lightpink;
-    if (value == "lightsalmon") return COLORNAMES_lightsalmon;
-    if (value == "lightseagreen") return COLORNAMES_lightseagreen;
-    if (value == "lightskyblue") return COLORNAMES_lightskyblue;
-    if (value == "lightslategray") return COLORNAMES_lightslategray;
-    if (value == "lightslategrey") return COLORNAMES_lightslategrey;
-    if (value == "lightsteelblue") return COLORNAMES_lightsteelblue;
-    if (value == "lightyellow") return COLORNAMES_lightyellow;
-    if (value == "lime") return COLORNAMES_lime;
-    if (value == "limegreen") return COLORNAMES_limegreen;
-    if (value == "linen") return COLORNAMES_linen;
-    if (value == "magenta") return COLORNAMES_magenta;
-    if (value == "maroon") return COLORNAMES_maroon;
-    if (value == "mediumaquamarine") return COLORNAMES_mediumaquamarine;
-    if (value == "mediumblue") return COLORNAMES_mediumblue;
-    if (value == "mediumorchid") return COLORNAMES_mediumorchid;
-    if (value == "mediumpurple") return COLORNAMES_mediumpurple;
-    if (value == "mediumseagreen") return COLORNAMES_mediumseagreen;
-    if (value == "mediumslateblue") return COLORNAMES_mediumslateblue;
-    if (value == "mediumspringgreen") return COLORNAMES_mediumspringgreen;
-    if (value == "mediumturquoise") return COLORNAMES_mediumturquoise;
-    if (value == "mediumvioletred") return COLORNAMES_mediumvioletred;
-    if (value == "midnightblue") return COLORNAMES_midnightblue;
-    if (value == "mintcream") return COLORNAMES_mintcream;
-    if (value == "mistyrose") return COLORNAMES_mistyrose;
-    if (value == "moccasin") return COLORNAMES_moccasin;
-    if (value == "navajowhite") return COLORNAMES_navajowhite;
-    if (value == "navy") return COLORNAMES_navy;
-    if (value == "oldlace") return COLORNAMES_oldlace;
-    if (value == "olive") return COLORNAMES_olive;
-    if (value == "olivedrab") return COLORNAMES_olivedrab;
-    if (value == "orange") return COLORNAMES_orange;
-    if (value == "orangered") return COLORNAMES_orangered;
-    if (value == "orchid") return COLORNAMES_orchid;
-    if (value == "palegoldenrod") return COLORNAMES_palegoldenrod;
-    if (value == "palegreen") return COLORNAMES_palegreen;
-    if (value == "paleturquoise") return COLORNAMES_paleturquoise;
-    if (value == "palevioletred") return COLORNAMES_palevioletred;
-    if (value == "papayawhip") return COLORNAMES_papayawhip;
-    if (value == "peachpuff") return COLORNAMES_peachpuff;
-    if (value == "peru") return COLORNAMES_peru;
-    if (value == "pink") return COLORNAMES_pink;
-    if (value == "plum") return COLORNAMES_plum;
-    if (value == "powderblue") return COLORNAMES_powderblue;
-    if (value == "purple") return COLORNAMES_purple;
-    if (value == "rebeccapurple") return COLORNAMES_rebeccapurple;
-    if (value == "red") return COLORNAMES_red;
-    if (value == "rosybrown") return COLORNAMES_rosybrown;
-    if (value == "royalblue") return COLORNAMES_royalblue;
-    if (value == "saddlebrown") return COLORNAMES_saddlebrown;
-    if (value == "salmon") return COLORNAMES_salmon;
-    if (value == "sandybrown") return COLORNAMES_sandybrown;
-    if (value == "seagreen") return COLORNAMES_seagreen;
-    if (value == "seashell") return COLORNAMES_seashell;
-    if (value == "sienna") return COLORNAMES_sienna;
-    if (value == "silver") return COLORNAMES_silver;
-    if (value == "skyblue") return COLORNAMES_skyblue;
-    if (value == "slateblue") return COLORNAMES_slateblue;
-    if (value == "slategray") return COLORNAMES_slategray;
-    if (value == "slategrey") return COLORNAMES_slategrey;
-    if (value == "snow") return COLORNAMES_snow;
-    if (value == "springgreen") return COLORNAMES_springgreen;
-    if (value == "steelblue") return COLORNAMES_steelblue;
-    if (value == "tan") return COLORNAMES_tan;
-    if (value == "teal") return COLORNAMES_teal;
-    if (value == "thistle") return COLORNAMES_thistle;
-    if (value == "tomato") return COLORNAMES_tomato;
-    if (value == "turquoise") return COLORNAMES_turquoise;
-    if (value == "violet") return COLORNAMES_violet;
-    if (value == "wheat") return COLORNAMES_wheat;
-    if (value == "white") return COLORNAMES_white;
-    if (value == "whitesmoke") return COLORNAMES_whitesmoke;
-    if (value == "yellow") return COLORNAMES_yellow;
-    if (value == "yellowgreen") return COLORNAMES_yellowgreen;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[2048] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0, 51, 0, 0, 0,
+        109, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 0, 0, 94, 6, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 113, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 65, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 127, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0,
+        0, 0, 0, 85, 0, 0, 0, 0, 137, 0, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 88, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 39, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 84, 0, 0, 11, 0, 0, 0, 0, 0, 78, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        80, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 55, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        29, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0,
+        0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+        0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 92, 0, 0, 0, 0, 0, 0, 0, 26, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 22, 81, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 145, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 139, 0, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 110, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 132, 0, 0, 112, 0, 0, 0, 0, 0, 35, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0,
+        43, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 105, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0,
+        37, 0, 0, 130, 16, 0, 0, 0, 0, 0, 0, 13, 0, 21, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143,
+        0, 0, 0, 0, 0, 0, 0, 40, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0,
+        0, 0, 0, 0, 0, 0, 7, 141, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 71, 0, 0, 0, 115, 0, 0, 0, 0, 58, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 147, 0, 0, 8, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    static const char *const values[148] = { "aliceblue", "antiquewhite", "aqua", "aquamarine", "azure", "beige",
+        "bisque", "black", "blanchedalmond", "blue", "blueviolet", "brown", "burlywood", "cadetblue", "chartreuse",
+        "chocolate", "coral", "cornflowerblue", "cornsilk", "crimson", "cyan", "darkblue", "darkcyan", "darkgoldenrod",
+        "darkgray", "darkgreen", "darkgrey", "darkkhaki", "darkmagenta", "darkolivegreen", "darkorange", "darkorchid",
+        "darkred", "darksalmon", "darkseagreen", "darkslateblue", "darkslategray", "darkslategrey", "darkturquoise",
+        "darkviolet", "deeppink", "deepskyblue", "dimgray", "dimgrey", "dodgerblue", "firebrick", "floralwhite",
+        "forestgreen", "fuchsia", "gainsboro", "ghostwhite", "gold", "goldenrod", "gray", "green", "greenyellow",
+        "grey", "honeydew", "hotpink", "indianred", "indigo", "ivory", "khaki", "lavender", "lavenderblush",
+        "lawngreen", "lemonchiffon", "lightblue", "lightcoral", "lightcyan", "lightgoldenrodyellow", "lightgray",
+        "lightgreen", "lightgrey", "lightpink", "lightsalmon", "lightseagreen", "lightskyblue", "lightslategray",
+        "lightslategrey", "lightsteelblue", "lightyellow", "lime", "limegreen", "linen", "magenta", "maroon",
+        "mediumaquamarine", "mediumblue", "mediumorchid", "mediumpurple", "mediumseagreen", "mediumslateblue",
+        "mediumspringgreen", "mediumturquoise", "mediumvioletred", "midnightblue", "mintcream", "mistyrose", "moccasin",
+        "navajowhite", "navy", "oldlace", "olive", "olivedrab", "orange", "orangered", "orchid", "palegoldenrod",
+        "palegreen", "paleturquoise", "palevioletred", "papayawhip", "peachpuff", "peru", "pink", "plum", "powderblue",
+        "purple", "rebeccapurple", "red", "rosybrown", "royalblue", "saddlebrown", "salmon", "sandybrown", "seagreen",
+        "seashell", "sienna", "silver", "skyblue", "slateblue", "slategray", "slategrey", "snow", "springgreen",
+        "steelblue", "tan", "teal", "thistle", "tomato", "turquoise", "violet", "wheat", "white", "whitesmoke",
+        "yellow", "yellowgreen" };
+    const uint8_t slot = slots[HashValue(value, 108) & 2047];
+    if (slot && value == values[slot - 1]) return static_cast<data_COLORNAMES>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.COLORNAMES", value.c_str());
     return COLORNAMES_NONE;
@@ -1264,16 +1102,13 @@ std::string AttConverterBase::DurationrestsMensuralToStr(data_DURATIONRESTS_mens
 
 data_DURATIONRESTS_mensural AttConverterBase::StrToDurationrestsMensural(const std::string &value, bool logWarning) const
 {
-    if (value == "2B") return DURATIONRESTS_mensural_2B;
-    if (value == "3B") return DURATIONRESTS_mensural_3B;
-    if (value == "maxima") return DURATIONRESTS_mensural_maxima;
-    if (value == "longa") return DURATIONRESTS_mensural_longa;
-    if (value == "brevis") return DURATIONRESTS_mensural_brevis;
-    if (value == "semibrevis") return DURATIONRESTS_mensural_semibrevis;
-    if (value == "minima") return DURATIONRESTS_mensural_minima;
-    if (value == "semiminima") return DURATIONRESTS_mensural_semiminima;
-    if (value == "fusa") return DURATIONRESTS_mensural_fusa;
-    if (value == "semifusa") return DURATIONRESTS_mensural_semifusa;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 1, 0, 0, 10, 0, 6, 0, 0, 0, 4, 0, 8, 0, 0, 0, 5, 0, 7, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+        0, 0, 9, 0, 3 };
+    static const char *const values[10] = { "2B", "3B", "maxima", "longa", "brevis", "semibrevis", "minima",
+        "semiminima", "fusa", "semifusa" };
+    const uint8_t slot = slots[HashValue(value, 1) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_DURATIONRESTS_mensural>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.DURATIONRESTS.mensural", value.c_str());
     return DURATIONRESTS_mensural_NONE;
@@ -1536,15 +1371,13 @@ std::string AttConverterBase::FontsizetermToStr(data_FONTSIZETERM data) const
 
 data_FONTSIZETERM AttConverterBase::StrToFontsizeterm(const std::string &value, bool logWarning) const
 {
-    if (value == "xx-small") return FONTSIZETERM_xx_small;
-    if (value == "x-small") return FONTSIZETERM_x_small;
-    if (value == "small") return FONTSIZETERM_small;
-    if (value == "normal") return FONTSIZETERM_normal;
-    if (value == "large") return FONTSIZETERM_large;
-    if (value == "x-large") return FONTSIZETERM_x_large;
-    if (value == "xx-large") return FONTSIZETERM_xx_large;
-    if (value == "smaller") return FONTSIZETERM_smaller;
-    if (value == "larger") return FONTSIZETERM_larger;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 7, 5, 0, 0, 6, 3, 0, 0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0, 0, 0,
+        0, 2, 0, 0, 0 };
+    static const char *const values[9] = { "xx-small", "x-small", "small", "normal", "large", "x-large", "xx-large",
+        "smaller", "larger" };
+    const uint8_t slot = slots[HashValue(value, 3) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_FONTSIZETERM>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value.c_str());
     return FONTSIZETERM_NONE;
@@ -1648,42 +1481,24 @@ std::string AttConverterBase::FrbrrelationshipToStr(data_FRBRRELATIONSHIP data)
 
 data_FRBRRELATIONSHIP AttConverterBase::StrToFrbrrelationship(const std::string &value, bool logWarning) const
 {
-    if (value == "hasAbridgement") return FRBRRELATIONSHIP_hasAbridgement;
-    if (value == "isAbridgementOf") return FRBRRELATIONSHIP_isAbridgementOf;
-    if (value == "hasAdaptation") return FRBRRELATIONSHIP_hasAdaptation;
-    if (value == "isAdaptationOf") return FRBRRELATIONSHIP_isAdaptationOf;
-    if (value == "hasAlternate") return FRBRRELATIONSHIP_hasAlternate;
-    if (value == "isAlternateOf") return FRBRRELATIONSHIP_isAlternateOf;
-    if (value == "hasArrangement") return FRBRRELATIONSHIP_hasArrangement;
-    if (value == "isArrangementOf") return FRBRRELATIONSHIP_isArrangementOf;
-    if (value == "hasComplement") return FRBRRELATIONSHIP_hasComplement;
-    if (value == "isComplementOf") return FRBRRELATIONSHIP_isComplementOf;
-    if (value == "hasEmbodiment") return FRBRRELATIONSHIP_hasEmbodiment;
-    if (value == "isEmbodimentOf") return FRBRRELATIONSHIP_isEmbodimentOf;
-    if (value == "hasExemplar") return FRBRRELATIONSHIP_hasExemplar;
-    if (value == "isExemplarOf") return FRBRRELATIONSHIP_isExemplarOf;
-    if (value == "hasImitation") return FRBRRELATIONSHIP_hasImitation;
-    if (value == "isImitationOf") return FRBRRELATIONSHIP_isImitationOf;
-    if (value == "hasPart") return FRBRRELATIONSHIP_hasPart;
-    if (value == "isPartOf") return FRBRRELATIONSHIP_isPartOf;
-    if (value == "hasRealization") return FRBRRELATIONSHIP_hasRealization;
-    if (value == "isRealizationOf") return FRBRRELATIONSHIP_isRealizationOf;
-    if (value == "hasReconfiguration") return FRBRRELATIONSHIP_hasReconfiguration;
-    if (value == "isReconfigurationOf") return FRBRRELATIONSHIP_isReconfigurationOf;
-    if (value == "hasReproduction") return FRBRRELATIONSHIP_hasReproduction;
-    if (value == "isReproductionOf") return FRBRRELATIONSHIP_isReproductionOf;
-    if (value == "hasRevision") return FRBRRELATIONSHIP_hasRevision;
-    if (value == "isRevisionOf") return FRBRRELATIONSHIP_isRevisionOf;
-    if (value == "hasSuccessor") return FRBRRELATIONSHIP_hasSuccessor;
-    if (value == "isSuccessorOf") return FRBRRELATIONSHIP_isSuccessorOf;
-    if (value == "hasSummarization") return FRBRRELATIONSHIP_hasSummarization;
-    if (value == "isSummarizationOf") return FRBRRELATIONSHIP_isSummarizationOf;
-    if (value == "hasSupplement") return FRBRRELATIONSHIP_hasSupplement;
-    if (value == "isSupplementOf") return FRBRRELATIONSHIP_isSupplementOf;
-    if (value == "hasTransformation") return FRBRRELATIONSHIP_hasTransformation;
-    if (value == "isTransformationOf") return FRBRRELATIONSHIP_isTransformationOf;
-    if (value == "hasTranslation") return FRBRRELATIONSHIP_hasTranslation;
-    if (value == "isTranslationOf") return FRBRRELATIONSHIP_isTranslationOf;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[256] = { 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 31, 0, 16, 27, 0, 0, 0, 0,
+        0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 35, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 15, 0,
+        32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 12, 0, 0, 0, 3, 0, 0, 0, 0, 0, 6, 26, 0, 0, 14, 0, 0, 0, 10, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 24, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 34, 0, 1, 0, 23, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    static const char *const values[36] = { "hasAbridgement", "isAbridgementOf", "hasAdaptation", "isAdaptationOf",
+        "hasAlternate", "isAlternateOf", "hasArrangement", "isArrangementOf", "hasComplement", "isComplementOf",
+        "hasEmbodiment", "isEmbodimentOf", "hasExemplar", "isExemplarOf", "hasImitation", "isImitationOf", "hasPart",
+        "isPartOf", "hasRealization", "isRealizationOf", "hasReconfiguration", "isReconfigurationOf", "hasReproduction",
+        "isReproductionOf", "hasRevision", "isRevisionOf", "hasSuccessor", "isSuccessorOf", "hasSummarization",
+        "isSummarizationOf", "hasSupplement", "isSupplementOf", "hasTransformation", "isTransformationOf",
+        "hasTranslation", "isTranslationOf" };
+    const uint8_t slot = slots[HashValue(value, 14) & 255];
+    if (slot && value == values[slot - 1]) return static_cast<data_FRBRRELATIONSHIP>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.FRBRRELATIONSHIP", value.c_str());
     return FRBRRELATIONSHIP_NONE;
@@ -1769,22 +1584,14 @@ std::string AttConverterBase::HeadshapeToStr(data_HEADSHAPE data) const
 
 data_HEADSHAPE AttConverterBase::StrToHeadshape(const std::string &value, bool logWarning) const
 {
-    if (value == "quarter") return HEADSHAPE_quarter;
-    if (value == "half") return HEADSHAPE_half;
-    if (value == "whole") return HEADSHAPE_whole;
-    if (value == "backslash") return HEADSHAPE_backslash;
-    if (value == "circle") return HEADSHAPE_circle;
-    if (value == "+") return HEADSHAPE_plus;
-    if (value == "diamond") return HEADSHAPE_diamond;
-    if (value == "isotriangle") return HEADSHAPE_isotriangle;
-    if (value == "oval") return HEADSHAPE_oval;
-    if (value == "piewedge") return HEADSHAPE_piewedge;
-    if (value == "rectangle") return HEADSHAPE_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_semicircle;
-    if (value == "slash") return HEADSHAPE_slash;
-    if (value == "square") return HEADSHAPE_square;
-    if (value == "x") return HEADSHAPE_x;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 0, 0, 0, 8, 0, 0, 0, 2, 0, 0, 7, 0, 13, 0, 0, 0, 10, 0, 1, 0, 0, 0, 0, 0,
+        0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 5, 11, 12, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 9, 0, 0, 0, 0, 14, 0, 0, 4, 0,
+        0, 15 };
+    static const char *const values[16] = { "quarter", "half", "whole", "backslash", "circle", "+", "diamond",
+        "isotriangle", "oval", "piewedge", "rectangle", "rtriangle", "semicircle", "slash", "square", "x" };
+    const uint8_t slot = slots[HashValue(value, 5) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_HEADSHAPE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.HEADSHAPE", value.c_str());
     return HEADSHAPE_NONE;
@@ -1820,22 +1627,14 @@ std::string AttConverterBase::HeadshapeListToStr(data_HEADSHAPE_list data) const
 
 data_HEADSHAPE_list AttConverterBase::StrToHeadshapeList(const std::string &value, bool logWarning) const
 {
-    if (value == "quarter") return HEADSHAPE_list_quarter;
-    if (value == "half") return HEADSHAPE_list_half;
-    if (value == "whole") return HEADSHAPE_list_whole;
-    if (value == "backslash") return HEADSHAPE_list_backslash;
-    if (value == "circle") return HEADSHAPE_list_circle;
-    if (value == "+") return HEADSHAPE_list_plus;
-    if (value == "diamond") return HEADSHAPE_list_diamond;
-    if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
-    if (value == "oval") return HEADSHAPE_list_oval;
-    if (value == "piewedge") return HEADSHAPE_list_piewedge;
-    if (value == "rectangle") return HEADSHAPE_list_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_list_semicircle;
-    if (value == "slash") return HEADSHAPE_list_slash;
-    if (value == "square") return HEADSHAPE_list_square;
-    if (value == "x") return HEADSHAPE_list_x;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 0, 0, 0, 8, 0, 0, 0, 2, 0, 0, 7, 0, 13, 0, 0, 0, 10, 0, 1, 0, 0, 0, 0, 0,
+        0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 5, 11, 12, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 9, 0, 0, 0, 0, 14, 0, 0, 4, 0,
+        0, 15 };
+    static const char *const values[16] = { "quarter", "half", "whole", "backslash", "circle", "+", "diamond",
+        "isotriangle", "oval", "piewedge", "rectangle", "rtriangle", "semicircle", "slash", "square", "x" };
+    const uint8_t slot = slots[HashValue(value, 5) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_HEADSHAPE_list>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value.c_str());
     return HEADSHAPE_list_NONE;
@@ -1981,26 +1780,15 @@ std::string AttConverterBase::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL da
 
 data_LINESTARTENDSYMBOL AttConverterBase::StrToLinestartendsymbol(const std::string &value, bool logWarning) const
 {
-    if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
-    if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
-    if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
-    if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
-    if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
-    if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
-    if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
-    if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
-    if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
-    if (value == "H") return LINESTARTENDSYMBOL_H;
-    if (value == "N") return LINESTARTENDSYMBOL_N;
-    if (value == "Th") return LINESTARTENDSYMBOL_Th;
-    if (value == "ThRetro") return LINESTARTENDSYMBOL_ThRetro;
-    if (value == "ThRetroInv") return LINESTARTENDSYMBOL_ThRetroInv;
-    if (value == "ThInv") return LINESTARTENDSYMBOL_ThInv;
-    if (value == "T") return LINESTARTENDSYMBOL_T;
-    if (value == "TInv") return LINESTARTENDSYMBOL_TInv;
-    if (value == "CH") return LINESTARTENDSYMBOL_CH;
-    if (value == "RH") return LINESTARTENDSYMBOL_RH;
-    if (value == "none") return LINESTARTENDSYMBOL_none;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 18, 0, 0, 11, 0, 13, 0, 0, 0, 0, 0, 0, 17, 20, 1, 0, 5, 10, 0, 0, 0, 0, 0,
+        0, 6, 0, 0, 12, 0, 7, 15, 0, 0, 0, 0, 4, 0, 16, 0, 2, 0, 19, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+        8, 3, 0 };
+    static const char *const values[20] = { "angledown", "angleup", "angleright", "angleleft", "arrow", "arrowopen",
+        "arrowwhite", "harpoonleft", "harpoonright", "H", "N", "Th", "ThRetro", "ThRetroInv", "ThInv", "T", "TInv",
+        "CH", "RH", "none" };
+    const uint8_t slot = slots[HashValue(value, 12) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_LINESTARTENDSYMBOL>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value.c_str());
     return LINESTARTENDSYMBOL_NONE;
@@ -2073,34 +1861,20 @@ std::string AttConverterBase::MelodicfunctionToStr(data_MELODICFUNCTION data) co
 
 data_MELODICFUNCTION AttConverterBase::StrToMelodicfunction(const std::string &value, bool logWarning) const
 {
-    if (value == "aln") return MELODICFUNCTION_aln;
-    if (value == "ant") return MELODICFUNCTION_ant;
-    if (value == "app") return MELODICFUNCTION_app;
-    if (value == "apt") return MELODICFUNCTION_apt;
-    if (value == "arp") return MELODICFUNCTION_arp;
-    if (value == "arp7") return MELODICFUNCTION_arp7;
-    if (value == "aun") return MELODICFUNCTION_aun;
-    if (value == "chg") return MELODICFUNCTION_chg;
-    if (value == "cln") return MELODICFUNCTION_cln;
-    if (value == "ct") return MELODICFUNCTION_ct;
-    if (value == "ct7") return MELODICFUNCTION_ct7;
-    if (value == "cun") return MELODICFUNCTION_cun;
-    if (value == "cup") return MELODICFUNCTION_cup;
-    if (value == "et") return MELODICFUNCTION_et;
-    if (value == "ln") return MELODICFUNCTION_ln;
-    if (value == "ped") return MELODICFUNCTION_ped;
-    if (value == "rep") return MELODICFUNCTION_rep;
-    if (value == "ret") return MELODICFUNCTION_ret;
-    if (value == "23ret") return MELODICFUNCTION_23ret;
-    if (value == "78ret") return MELODICFUNCTION_78ret;
-    if (value == "sus") return MELODICFUNCTION_sus;
-    if (value == "43sus") return MELODICFUNCTION_43sus;
-    if (value == "98sus") return MELODICFUNCTION_98sus;
-    if (value == "76sus") return MELODICFUNCTION_76sus;
-    if (value == "un") return MELODICFUNCTION_un;
-    if (value == "un7") return MELODICFUNCTION_un7;
-    if (value == "upt") return MELODICFUNCTION_upt;
-    if (value == "upt7") return MELODICFUNCTION_upt7;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[256] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 25, 7, 0, 0, 10, 0, 0,
+        0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 2, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 12, 0, 11, 0,
+        0, 0, 28, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 1, 0, 17, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+        0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    static const char *const values[28] = { "aln", "ant", "app", "apt", "arp", "arp7", "aun", "chg", "cln", "ct", "ct7",
+        "cun", "cup", "et", "ln", "ped", "rep", "ret", "23ret", "78ret", "sus", "43sus", "98sus", "76sus", "un", "un7",
+        "upt", "upt7" };
+    const uint8_t slot = slots[HashValue(value, 5) & 255];
+    if (slot && value == values[slot - 1]) return static_cast<data_MELODICFUNCTION>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value.c_str());
     return MELODICFUNCTION_NONE;
@@ -2135,21 +1909,13 @@ std::string AttConverterBase::MensurationsignToStr(data_MENSURATIONSIGN data) co
 
 data_MENSURATIONSIGN AttConverterBase::StrToMensurationsign(const std::string &value, bool logWarning) const
 {
-    if (value == "C") return MENSURATIONSIGN_C;
-    if (value == "O") return MENSURATIONSIGN_O;
-    if (value == "t") return MENSURATIONSIGN_t;
-    if (value == "q") return MENSURATIONSIGN_q;
-    if (value == "si") return MENSURATIONSIGN_si;
-    if (value == "i") return MENSURATIONSIGN_i;
-    if (value == "sg") return MENSURATIONSIGN_sg;
-    if (value == "g") return MENSURATIONSIGN_g;
-    if (value == "sp") return MENSURATIONSIGN_sp;
-    if (value == "p") return MENSURATIONSIGN_p;
-    if (value == "sy") return MENSURATIONSIGN_sy;
-    if (value == "y") return MENSURATIONSIGN_y;
-    if (value == "n") return MENSURATIONSIGN_n;
-    if (value == "oc") return MENSURATIONSIGN_oc;
-    if (value == "d") return MENSURATIONSIGN_d;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 2, 3, 12, 0, 1, 0, 0, 5, 0, 7, 0, 0, 9, 10, 0, 0, 0, 15, 6, 13, 0, 0, 0, 11, 8,
+        14, 4, 0, 0, 0, 0, 0 };
+    static const char *const values[15] = { "C", "O", "t", "q", "si", "i", "sg", "g", "sp", "p", "sy", "y", "n", "oc",
+        "d" };
+    const uint8_t slot = slots[HashValue(value, 10) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_MENSURATIONSIGN>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value.c_str());
     return MENSURATIONSIGN_NONE;
@@ -2396,181 +2162,148 @@ std::string AttConverterBase::MidinamesToStr(data_MIDINAMES data) const
 
 data_MIDINAMES AttConverterBase::StrToMidinames(const std::string &value, bool logWarning) const
 {
-    if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
-    if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
-    if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
-    if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
-    if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
-    if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
-    if (value == "Harpsichord") return MIDINAMES_Harpsichord;
-    if (value == "Clavi") return MIDINAMES_Clavi;
-    if (value == "Celesta") return MIDINAMES_Celesta;
-    if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
-    if (value == "Music_Box") return MIDINAMES_Music_Box;
-    if (value == "Vibraphone") return MIDINAMES_Vibraphone;
-    if (value == "Marimba") return MIDINAMES_Marimba;
-    if (value == "Xylophone") return MIDINAMES_Xylophone;
-    if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
-    if (value == "Dulcimer") return MIDINAMES_Dulcimer;
-    if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
-    if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
-    if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
-    if (value == "Church_Organ") return MIDINAMES_Church_Organ;
-    if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
-    if (value == "Accordion") return MIDINAMES_Accordion;
-    if (value == "Harmonica") return MIDINAMES_Harmonica;
-    if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
-    if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
-    if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
-    if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
-    if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
-    if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
-    if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
-    if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
-    if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
-    if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
-    if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
-    if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
-    if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
-    if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
-    if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
-    if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
-    if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
-    if (value == "Violin") return MIDINAMES_Violin;
-    if (value == "Viola") return MIDINAMES_Viola;
-    if (value == "Cello") return MIDINAMES_Cello;
-    if (value == "Contrabass") return MIDINAMES_Contrabass;
-    if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
-    if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
-    if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
-    if (value == "Timpani") return MIDINAMES_Timpani;
-    if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
-    if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
-    if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
-    if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
-    if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
-    if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
-    if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
-    if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
-    if (value == "Trumpet") return MIDINAMES_Trumpet;
-    if (value == "Trombone") return MIDINAMES_Trombone;
-    if (value == "Tuba") return MIDINAMES_Tuba;
-    if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
-    if (value == "French_Horn") return MIDINAMES_French_Horn;
-    if (value == "Brass_Section") return MIDINAMES_Brass_Section;
-    if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
-    if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
-    if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
-    if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
-    if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
-    if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
-    if (value == "Oboe") return MIDINAMES_Oboe;
-    if (value == "English_Horn") return MIDINAMES_English_Horn;
-    if (value == "Bassoon") return MIDINAMES_Bassoon;
-    if (value == "Clarinet") return MIDINAMES_Clarinet;
-    if (value == "Piccolo") return MIDINAMES_Piccolo;
-    if (value == "Flute") return MIDINAMES_Flute;
-    if (value == "Recorder") return MIDINAMES_Recorder;
-    if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
-    if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
-    if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
-    if (value == "Whistle") return MIDINAMES_Whistle;
-    if (value == "Ocarina") return MIDINAMES_Ocarina;
-    if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
-    if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
-    if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
-    if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
-    if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
-    if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
-    if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
-    if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
-    if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
-    if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
-    if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
-    if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
-    if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
-    if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
-    if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
-    if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
-    if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
-    if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
-    if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
-    if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
-    if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
-    if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
-    if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
-    if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
-    if (value == "Sitar") return MIDINAMES_Sitar;
-    if (value == "Banjo") return MIDINAMES_Banjo;
-    if (value == "Shamisen") return MIDINAMES_Shamisen;
-    if (value == "Koto") return MIDINAMES_Koto;
-    if (value == "Kalimba") return MIDINAMES_Kalimba;
-    if (value == "Bag_pipe") return MIDINAMES_Bag_pipe;
-    if (value == "Fiddle") return MIDINAMES_Fiddle;
-    if (value == "Shanai") return MIDINAMES_Shanai;
-    if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
-    if (value == "Agogo") return MIDINAMES_Agogo;
-    if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
-    if (value == "Woodblock") return MIDINAMES_Woodblock;
-    if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
-    if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
-    if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
-    if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
-    if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
-    if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
-    if (value == "Seashore") return MIDINAMES_Seashore;
-    if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
-    if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
-    if (value == "Helicopter") return MIDINAMES_Helicopter;
-    if (value == "Applause") return MIDINAMES_Applause;
-    if (value == "Gunshot") return MIDINAMES_Gunshot;
-    if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
-    if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
-    if (value == "Side_Stick") return MIDINAMES_Side_Stick;
-    if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
-    if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
-    if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
-    if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
-    if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
-    if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
-    if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
-    if (value == "Low_Tom") return MIDINAMES_Low_Tom;
-    if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
-    if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
-    if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
-    if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
-    if (value == "High_Tom") return MIDINAMES_High_Tom;
-    if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
-    if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
-    if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
-    if (value == "Tambourine") return MIDINAMES_Tambourine;
-    if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
-    if (value == "Cowbell") return MIDINAMES_Cowbell;
-    if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
-    if (value == "Vibraslap") return MIDINAMES_Vibraslap;
-    if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
-    if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
-    if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
-    if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
-    if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
-    if (value == "Low_Conga") return MIDINAMES_Low_Conga;
-    if (value == "High_Timbale") return MIDINAMES_High_Timbale;
-    if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
-    if (value == "High_Agogo") return MIDINAMES_High_Agogo;
-    if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
-    if (value == "Cabasa") return MIDINAMES_Cabasa;
-    if (value == "Maracas") return MIDINAMES_Maracas;
-    if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
-    if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
-    if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
-    if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
-    if (value == "Claves") return MIDINAMES_Claves;
-    if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
-    if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
-    if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
-    if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
-    if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
-    if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[4096] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 30, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 140, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+        67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 56, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 13, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 54, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 145, 0, 0, 0, 0, 0, 0, 0, 159, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 72, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 80, 101, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 25, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57,
+        0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 74, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 168, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 29, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4, 0, 137, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0, 117, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        141, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 7, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116,
+        113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+        0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0,
+        0, 0, 23, 0, 0, 0, 0, 167, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 31,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0,
+        89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 115,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 32, 0, 139, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 10, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0 };
+    static const char *const values[175] = { "Acoustic_Grand_Piano", "Bright_Acoustic_Piano", "Electric_Grand_Piano",
+        "Honky-tonk_Piano", "Electric_Piano_1", "Electric_Piano_2", "Harpsichord", "Clavi", "Celesta", "Glockenspiel",
+        "Music_Box", "Vibraphone", "Marimba", "Xylophone", "Tubular_Bells", "Dulcimer", "Drawbar_Organ",
+        "Percussive_Organ", "Rock_Organ", "Church_Organ", "Reed_Organ", "Accordion", "Harmonica", "Tango_Accordion",
+        "Acoustic_Guitar_nylon", "Acoustic_Guitar_steel", "Electric_Guitar_jazz", "Electric_Guitar_clean",
+        "Electric_Guitar_muted", "Overdriven_Guitar", "Distortion_Guitar", "Guitar_harmonics", "Acoustic_Bass",
+        "Electric_Bass_finger", "Electric_Bass_pick", "Fretless_Bass", "Slap_Bass_1", "Slap_Bass_2", "Synth_Bass_1",
+        "Synth_Bass_2", "Violin", "Viola", "Cello", "Contrabass", "Tremolo_Strings", "Pizzicato_Strings",
+        "Orchestral_Harp", "Timpani", "String_Ensemble_1", "String_Ensemble_2", "SynthStrings_1", "SynthStrings_2",
+        "Choir_Aahs", "Voice_Oohs", "Synth_Voice", "Orchestra_Hit", "Trumpet", "Trombone", "Tuba", "Muted_Trumpet",
+        "French_Horn", "Brass_Section", "SynthBrass_1", "SynthBrass_2", "Soprano_Sax", "Alto_Sax", "Tenor_Sax",
+        "Baritone_Sax", "Oboe", "English_Horn", "Bassoon", "Clarinet", "Piccolo", "Flute", "Recorder", "Pan_Flute",
+        "Blown_Bottle", "Shakuhachi", "Whistle", "Ocarina", "Lead_1_square", "Lead_2_sawtooth", "Lead_3_calliope",
+        "Lead_4_chiff", "Lead_5_charang", "Lead_6_voice", "Lead_7_fifths", "Lead_8_bass_and_lead", "Pad_1_new_age",
+        "Pad_2_warm", "Pad_3_polysynth", "Pad_4_choir", "Pad_5_bowed", "Pad_6_metallic", "Pad_7_halo", "Pad_8_sweep",
+        "FX_1_rain", "FX_2_soundtrack", "FX_3_crystal", "FX_4_atmosphere", "FX_5_brightness", "FX_6_goblins",
+        "FX_7_echoes", "FX_8_sci-fi", "Sitar", "Banjo", "Shamisen", "Koto", "Kalimba", "Bag_pipe", "Fiddle", "Shanai",
+        "Tinkle_Bell", "Agogo", "Steel_Drums", "Woodblock", "Taiko_Drum", "Melodic_Tom", "Synth_Drum", "Reverse_Cymbal",
+        "Guitar_Fret_Noise", "Breath_Noise", "Seashore", "Bird_Tweet", "Telephone_Ring", "Helicopter", "Applause",
+        "Gunshot", "Acoustic_Bass_Drum", "Bass_Drum_1", "Side_Stick", "Acoustic_Snare", "Hand_Clap", "Electric_Snare",
+        "Low_Floor_Tom", "Closed_Hi_Hat", "High_Floor_Tom", "Pedal_Hi-Hat", "Low_Tom", "Open_Hi-Hat", "Low-Mid_Tom",
+        "Hi-Mid_Tom", "Crash_Cymbal_1", "High_Tom", "Ride_Cymbal_1", "Chinese_Cymbal", "Ride_Bell", "Tambourine",
+        "Splash_Cymbal", "Cowbell", "Crash_Cymbal_2", "Vibraslap", "Ride_Cymbal_2", "Hi_Bongo", "Low_Bongo",
+        "Mute_Hi_Conga", "Open_Hi_Conga", "Low_Conga", "High_Timbale", "Low_Timbale", "High_Agogo", "Low_Agogo",
+        "Cabasa", "Maracas", "Short_Whistle", "Long_Whistle", "Short_Guiro", "Long_Guiro", "Claves", "Hi_Wood_Block",
+        "Low_Wood_Block", "Mute_Cuica", "Open_Cuica", "Mute_Triangle", "Open_Triangle" };
+    const uint8_t slot = slots[HashValue(value, 32) & 4095];
+    if (slot && value == values[slot - 1]) return static_cast<data_MIDINAMES>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.MIDINAMES", value.c_str());
     return MIDINAMES_NONE;
@@ -2607,23 +2340,15 @@ std::string AttConverterBase::ModeToStr(data_MODE data) const
 
 data_MODE AttConverterBase::StrToMode(const std::string &value, bool logWarning) const
 {
-    if (value == "major") return MODE_major;
-    if (value == "minor") return MODE_minor;
-    if (value == "dorian") return MODE_dorian;
-    if (value == "hypodorian") return MODE_hypodorian;
-    if (value == "phrygian") return MODE_phrygian;
-    if (value == "hypophrygian") return MODE_hypophrygian;
-    if (value == "lydian") return MODE_lydian;
-    if (value == "hypolydian") return MODE_hypolydian;
-    if (value == "mixolydian") return MODE_mixolydian;
-    if (value == "hypomixolydian") return MODE_hypomixolydian;
-    if (value == "peregrinus") return MODE_peregrinus;
-    if (value == "ionian") return MODE_ionian;
-    if (value == "hypoionian") return MODE_hypoionian;
-    if (value == "aeolian") return MODE_aeolian;
-    if (value == "hypoaeolian") return MODE_hypoaeolian;
-    if (value == "locrian") return MODE_locrian;
-    if (value == "hypolocrian") return MODE_hypolocrian;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 15, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 13, 0, 0, 0, 6, 0, 10, 4, 0, 0, 0, 0, 0,
+        0, 12, 0, 17, 0, 0, 0, 0, 1, 0, 0, 9, 0, 0, 8, 0, 3, 16, 0, 0, 2, 0, 14, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+        7, 0 };
+    static const char *const values[17] = { "major", "minor", "dorian", "hypodorian", "phrygian", "hypophrygian",
+        "lydian", "hypolydian", "mixolydian", "hypomixolydian", "peregrinus", "ionian", "hypoionian", "aeolian",
+        "hypoaeolian", "locrian", "hypolocrian" };
+    const uint8_t slot = slots[HashValue(value, 0) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_MODE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.MODE", value.c_str());
     return MODE_NONE;
@@ -2706,15 +2431,13 @@ std::string AttConverterBase::ModeGregorianToStr(data_MODE_gregorian data) const
 
 data_MODE_gregorian AttConverterBase::StrToModeGregorian(const std::string &value, bool logWarning) const
 {
-    if (value == "dorian") return MODE_gregorian_dorian;
-    if (value == "hypodorian") return MODE_gregorian_hypodorian;
-    if (value == "phrygian") return MODE_gregorian_phrygian;
-    if (value == "hypophrygian") return MODE_gregorian_hypophrygian;
-    if (value == "lydian") return MODE_gregorian_lydian;
-    if (value == "hypolydian") return MODE_gregorian_hypolydian;
-    if (value == "mixolydian") return MODE_gregorian_mixolydian;
-    if (value == "hypomixolydian") return MODE_gregorian_hypomixolydian;
-    if (value == "peregrinus") return MODE_gregorian_peregrinus;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 0, 0, 0, 0, 0, 7, 0, 0, 6, 9, 1, 0, 0, 0, 0, 0, 0, 4, 0, 8, 2, 0, 0, 3, 0, 0, 0,
+        0, 0, 0, 5, 0 };
+    static const char *const values[9] = { "dorian", "hypodorian", "phrygian", "hypophrygian", "lydian", "hypolydian",
+        "mixolydian", "hypomixolydian", "peregrinus" };
+    const uint8_t slot = slots[HashValue(value, 0) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_MODE_gregorian>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.MODE.gregorian", value.c_str());
     return MODE_gregorian_NONE;
@@ -2743,15 +2466,13 @@ std::string AttConverterBase::ModsrelationshipToStr(data_MODSRELATIONSHIP data)
 
 data_MODSRELATIONSHIP AttConverterBase::StrToModsrelationship(const std::string &value, bool logWarning) const
 {
-    if (value == "preceding") return MODSRELATIONSHIP_preceding;
-    if (value == "succeeding") return MODSRELATIONSHIP_succeeding;
-    if (value == "original") return MODSRELATIONSHIP_original;
-    if (value == "host") return MODSRELATIONSHIP_host;
-    if (value == "constituent") return MODSRELATIONSHIP_constituent;
-    if (value == "otherVersion") return MODSRELATIONSHIP_otherVersion;
-    if (value == "otherFormat") return MODSRELATIONSHIP_otherFormat;
-    if (value == "isReferencedBy") return MODSRELATIONSHIP_isReferencedBy;
-    if (value == "references") return MODSRELATIONSHIP_references;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 2, 0, 5, 3, 0, 0, 0, 0, 0, 0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 7, 4, 0, 0, 0, 8,
+        0, 0, 0, 9, 0 };
+    static const char *const values[9] = { "preceding", "succeeding", "original", "host", "constituent", "otherVersion",
+        "otherFormat", "isReferencedBy", "references" };
+    const uint8_t slot = slots[HashValue(value, 1) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_MODSRELATIONSHIP>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.MODSRELATIONSHIP", value.c_str());
     return MODSRELATIONSHIP_NONE;
@@ -2830,19 +2551,14 @@ std::string AttConverterBase::NonstaffplaceToStr(data_NONSTAFFPLACE data) const
 
 data_NONSTAFFPLACE AttConverterBase::StrToNonstaffplace(const std::string &value, bool logWarning) const
 {
-    if (value == "botmar") return NONSTAFFPLACE_botmar;
-    if (value == "topmar") return NONSTAFFPLACE_topmar;
-    if (value == "leftmar") return NONSTAFFPLACE_leftmar;
-    if (value == "rightmar") return NONSTAFFPLACE_rightmar;
-    if (value == "facing") return NONSTAFFPLACE_facing;
-    if (value == "overleaf") return NONSTAFFPLACE_overleaf;
-    if (value == "end") return NONSTAFFPLACE_end;
-    if (value == "inter") return NONSTAFFPLACE_inter;
-    if (value == "intra") return NONSTAFFPLACE_intra;
-    if (value == "super") return NONSTAFFPLACE_super;
-    if (value == "sub") return NONSTAFFPLACE_sub;
-    if (value == "inspace") return NONSTAFFPLACE_inspace;
-    if (value == "superimposed") return NONSTAFFPLACE_superimposed;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 3, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 6, 0, 0, 0, 5, 0, 0, 0, 0, 10, 11, 0, 0, 0, 0,
+        0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9 };
+    static const char *const values[13] = { "botmar", "topmar", "leftmar", "rightmar", "facing", "overleaf", "end",
+        "inter", "intra", "super", "sub", "inspace", "superimposed" };
+    const uint8_t slot = slots[HashValue(value, 0) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_NONSTAFFPLACE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.NONSTAFFPLACE", value.c_str());
     return NONSTAFFPLACE_NONE;
@@ -2872,16 +2588,13 @@ std::string AttConverterBase::NotationtypeToStr(data_NOTATIONTYPE data) const
 
 data_NOTATIONTYPE AttConverterBase::StrToNotationtype(const std::string &value, bool logWarning) const
 {
-    if (value == "cmn") return NOTATIONTYPE_cmn;
-    if (value == "mensural") return NOTATIONTYPE_mensural;
-    if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
-    if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
-    if (value == "tab.lute.french") return NOTATIONTYPE_tab_lute_french;
-    if (value == "tab.lute.italian") return NOTATIONTYPE_tab_lute_italian;
-    if (value == "tab.lute.german") return NOTATIONTYPE_tab_lute_german;
-    if (value == "tab.guitar") return NOTATIONTYPE_tab_guitar;
-    if (value == "neume") return NOTATIONTYPE_neume;
-    if (value == "tab") return NOTATIONTYPE_tab;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 0, 0, 0, 8, 3, 5, 4, 0, 1, 2, 0, 6, 9, 0, 0, 0, 0, 0, 0, 7, 0, 10, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0 };
+    static const char *const values[10] = { "cmn", "mensural", "mensural.black", "mensural.white", "tab.lute.french",
+        "tab.lute.italian", "tab.lute.german", "tab.guitar", "neume", "tab" };
+    const uint8_t slot = slots[HashValue(value, 3) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_NOTATIONTYPE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value.c_str());
     return NOTATIONTYPE_NONE;
@@ -2911,16 +2624,13 @@ std::string AttConverterBase::NoteheadmodifierToStr(data_NOTEHEADMODIFIER data)
 
 data_NOTEHEADMODIFIER AttConverterBase::StrToNoteheadmodifier(const std::string &value, bool logWarning) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_brack;
-    if (value == "box") return NOTEHEADMODIFIER_box;
-    if (value == "circle") return NOTEHEADMODIFIER_circle;
-    if (value == "fences") return NOTEHEADMODIFIER_fences;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 2, 7, 10, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 8, 0, 0, 6, 0, 0, 0, 0, 0, 4, 0, 9, 0, 0,
+        0, 3, 1, 0, 0 };
+    static const char *const values[10] = { "slash", "backslash", "vline", "hline", "centerdot", "paren", "brack",
+        "box", "circle", "fences" };
+    const uint8_t slot = slots[HashValue(value, 1) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_NOTEHEADMODIFIER>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER", value.c_str());
     return NOTEHEADMODIFIER_NONE;
@@ -2950,16 +2660,13 @@ std::string AttConverterBase::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_li
 
 data_NOTEHEADMODIFIER_list AttConverterBase::StrToNoteheadmodifierList(const std::string &value, bool logWarning) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_list_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_list_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_list_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_list_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_list_brack;
-    if (value == "box") return NOTEHEADMODIFIER_list_box;
-    if (value == "circle") return NOTEHEADMODIFIER_list_circle;
-    if (value == "fences") return NOTEHEADMODIFIER_list_fences;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 2, 7, 10, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 8, 0, 0, 6, 0, 0, 0, 0, 0, 4, 0, 9, 0, 0,
+        0, 3, 1, 0, 0 };
+    static const char *const values[10] = { "slash", "backslash", "vline", "hline", "centerdot", "paren", "brack",
+        "box", "circle", "fences" };
+    const uint8_t slot = slots[HashValue(value, 1) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_NOTEHEADMODIFIER_list>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value.c_str());
     return NOTEHEADMODIFIER_list_NONE;
@@ -3080,51 +2787,32 @@ std::string AttConverterBase::RelationshipToStr(data_RELATIONSHIP data) const
 
 data_RELATIONSHIP AttConverterBase::StrToRelationship(const std::string &value, bool logWarning) const
 {
-    if (value == "hasAbridgement") return RELATIONSHIP_hasAbridgement;
-    if (value == "isAbridgementOf") return RELATIONSHIP_isAbridgementOf;
-    if (value == "hasAdaptation") return RELATIONSHIP_hasAdaptation;
-    if (value == "isAdaptationOf") return RELATIONSHIP_isAdaptationOf;
-    if (value == "hasAlternate") return RELATIONSHIP_hasAlternate;
-    if (value == "isAlternateOf") return RELATIONSHIP_isAlternateOf;
-    if (value == "hasArrangement") return RELATIONSHIP_hasArrangement;
-    if (value == "isArrangementOf") return RELATIONSHIP_isArrangementOf;
-    if (value == "hasComplement") return RELATIONSHIP_hasComplement;
-    if (value == "isComplementOf") return RELATIONSHIP_isComplementOf;
-    if (value == "hasEmbodiment") return RELATIONSHIP_hasEmbodiment;
-    if (value == "isEmbodimentOf") return RELATIONSHIP_isEmbodimentOf;
-    if (value == "hasExemplar") return RELATIONSHIP_hasExemplar;
-    if (value == "isExemplarOf") return RELATIONSHIP_isExemplarOf;
-    if (value == "hasImitation") return RELATIONSHIP_hasImitation;
-    if (value == "isImitationOf") return RELATIONSHIP_isImitationOf;
-    if (value == "hasPart") return RELATIONSHIP_hasPart;
-    if (value == "isPartOf") return RELATIONSHIP_isPartOf;
-    if (value == "hasRealization") return RELATIONSHIP_hasRealization;
-    if (value == "isRealizationOf") return RELATIONSHIP_isRealizationOf;
-    if (value == "hasReconfiguration") return RELATIONSHIP_hasReconfiguration;
-    if (value == "isReconfigurationOf") return RELATIONSHIP_isReconfigurationOf;
-    if (value == "hasReproduction") return RELATIONSHIP_hasReproduction;
-    if (value == "isReproductionOf") return RELATIONSHIP_isReproductionOf;
-    if (value == "hasRevision") return RELATIONSHIP_hasRevision;
-    if (value == "isRevisionOf") return RELATIONSHIP_isRevisionOf;
-    if (value == "hasSuccessor") return RELATIONSHIP_hasSuccessor;
-    if (value == "isSuccessorOf") return RELATIONSHIP_isSuccessorOf;
-    if (value == "hasSummarization") return RELATIONSHIP_hasSummarization;
-    if (value == "isSummarizationOf") return RELATIONSHIP_isSummarizationOf;
-    if (value == "hasSupplement") return RELATIONSHIP_hasSupplement;
-    if (value == "isSupplementOf") return RELATIONSHIP_isSupplementOf;
-    if (value == "hasTransformation") return RELATIONSHIP_hasTransformation;
-    if (value == "isTransformationOf") return RELATIONSHIP_isTransformationOf;
-    if (value == "hasTranslation") return RELATIONSHIP_hasTranslation;
-    if (value == "isTranslationOf") return RELATIONSHIP_isTranslationOf;
-    if (value == "preceding") return RELATIONSHIP_preceding;
-    if (value == "succeeding") return RELATIONSHIP_succeeding;
-    if (value == "original") return RELATIONSHIP_original;
-    if (value == "host") return RELATIONSHIP_host;
-    if (value == "constituent") return RELATIONSHIP_constituent;
-    if (value == "otherVersion") return RELATIONSHIP_otherVersion;
-    if (value == "otherFormat") return RELATIONSHIP_otherFormat;
-    if (value == "isReferencedBy") return RELATIONSHIP_isReferencedBy;
-    if (value == "references") return RELATIONSHIP_references;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[512] = { 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+        0, 0, 0, 0, 0, 0, 44, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 10, 0, 3, 0, 0,
+        0, 0, 32, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 5, 2, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 39, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 28, 0, 33, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 45, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 30, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0 };
+    static const char *const values[45] = { "hasAbridgement", "isAbridgementOf", "hasAdaptation", "isAdaptationOf",
+        "hasAlternate", "isAlternateOf", "hasArrangement", "isArrangementOf", "hasComplement", "isComplementOf",
+        "hasEmbodiment", "isEmbodimentOf", "hasExemplar", "isExemplarOf", "hasImitation", "isImitationOf", "hasPart",
+        "isPartOf", "hasRealization", "isRealizationOf", "hasReconfiguration", "isReconfigurationOf", "hasReproduction",
+        "isReproductionOf", "hasRevision", "isRevisionOf", "hasSuccessor", "isSuccessorOf", "hasSummarization",
+        "isSummarizationOf", "hasSupplement", "isSupplementOf", "hasTransformation", "isTransformationOf",
+        "hasTranslation", "isTranslationOf", "preceding", "succeeding", "original", "host", "constituent",
+        "otherVersion", "otherFormat", "isReferencedBy", "references" };
+    const uint8_t slot = slots[HashValue(value, 2) & 511];
+    if (slot && value == values[slot - 1]) return static_cast<data_RELATIONSHIP>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.RELATIONSHIP", value.c_str());
     return RELATIONSHIP_NONE;
@@ -3239,35 +2927,20 @@ std::string AttConverterBase::StaffitemToStr(data_STAFFITEM data) const
 
 data_STAFFITEM AttConverterBase::StrToStaffitem(const std::string &value, bool logWarning) const
 {
-    if (value == "accid") return STAFFITEM_accid;
-    if (value == "annot") return STAFFITEM_annot;
-    if (value == "artic") return STAFFITEM_artic;
-    if (value == "dir") return STAFFITEM_dir;
-    if (value == "dynam") return STAFFITEM_dynam;
-    if (value == "harm") return STAFFITEM_harm;
-    if (value == "ornam") return STAFFITEM_ornam;
-    if (value == "sp") return STAFFITEM_sp;
-    if (value == "stageDir") return STAFFITEM_stageDir;
-    if (value == "tempo") return STAFFITEM_tempo;
-    if (value == "beam") return STAFFITEM_beam;
-    if (value == "bend") return STAFFITEM_bend;
-    if (value == "bracketSpan") return STAFFITEM_bracketSpan;
-    if (value == "breath") return STAFFITEM_breath;
-    if (value == "cpMark") return STAFFITEM_cpMark;
-    if (value == "fermata") return STAFFITEM_fermata;
-    if (value == "fing") return STAFFITEM_fing;
-    if (value == "hairpin") return STAFFITEM_hairpin;
-    if (value == "harpPedal") return STAFFITEM_harpPedal;
-    if (value == "lv") return STAFFITEM_lv;
-    if (value == "mordent") return STAFFITEM_mordent;
-    if (value == "octave") return STAFFITEM_octave;
-    if (value == "pedal") return STAFFITEM_pedal;
-    if (value == "reh") return STAFFITEM_reh;
-    if (value == "tie") return STAFFITEM_tie;
-    if (value == "trill") return STAFFITEM_trill;
-    if (value == "tuplet") return STAFFITEM_tuplet;
-    if (value == "turn") return STAFFITEM_turn;
-    if (value == "ligature") return STAFFITEM_ligature;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[256] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 25, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 7, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 15, 4, 0, 0, 0, 12, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 23, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 29, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0,
+        0, 0, 0, 0, 13, 0, 0, 0, 0, 26, 0, 8 };
+    static const char *const values[29] = { "accid", "annot", "artic", "dir", "dynam", "harm", "ornam", "sp",
+        "stageDir", "tempo", "beam", "bend", "bracketSpan", "breath", "cpMark", "fermata", "fing", "hairpin",
+        "harpPedal", "lv", "mordent", "octave", "pedal", "reh", "tie", "trill", "tuplet", "turn", "ligature" };
+    const uint8_t slot = slots[HashValue(value, 1) & 255];
+    if (slot && value == values[slot - 1]) return static_cast<data_STAFFITEM>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.STAFFITEM", value.c_str());
     return STAFFITEM_NONE;
@@ -3297,16 +2970,13 @@ std::string AttConverterBase::StaffitemBasicToStr(data_STAFFITEM_basic data) con
 
 data_STAFFITEM_basic AttConverterBase::StrToStaffitemBasic(const std::string &value, bool logWarning) const
 {
-    if (value == "accid") return STAFFITEM_basic_accid;
-    if (value == "annot") return STAFFITEM_basic_annot;
-    if (value == "artic") return STAFFITEM_basic_artic;
-    if (value == "dir") return STAFFITEM_basic_dir;
-    if (value == "dynam") return STAFFITEM_basic_dynam;
-    if (value == "harm") return STAFFITEM_basic_harm;
-    if (value == "ornam") return STAFFITEM_basic_ornam;
-    if (value == "sp") return STAFFITEM_basic_sp;
-    if (value == "stageDir") return STAFFITEM_basic_stageDir;
-    if (value == "tempo") return STAFFITEM_basic_tempo;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 7, 0, 0, 0, 0, 0, 0, 6, 0, 0, 5, 0, 0, 0, 3, 0, 0, 0, 0, 2, 4, 0, 8, 1, 10, 0, 0,
+        0, 9, 0, 0, 0 };
+    static const char *const values[10] = { "accid", "annot", "artic", "dir", "dynam", "harm", "ornam", "sp",
+        "stageDir", "tempo" };
+    const uint8_t slot = slots[HashValue(value, 0) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_STAFFITEM_basic>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.STAFFITEM.basic", value.c_str());
     return STAFFITEM_basic_NONE;
@@ -3344,24 +3014,14 @@ std::string AttConverterBase::StaffitemCmnToStr(data_STAFFITEM_cmn data) const
 
 data_STAFFITEM_cmn AttConverterBase::StrToStaffitemCmn(const std::string &value, bool logWarning) const
 {
-    if (value == "beam") return STAFFITEM_cmn_beam;
-    if (value == "bend") return STAFFITEM_cmn_bend;
-    if (value == "bracketSpan") return STAFFITEM_cmn_bracketSpan;
-    if (value == "breath") return STAFFITEM_cmn_breath;
-    if (value == "cpMark") return STAFFITEM_cmn_cpMark;
-    if (value == "fermata") return STAFFITEM_cmn_fermata;
-    if (value == "fing") return STAFFITEM_cmn_fing;
-    if (value == "hairpin") return STAFFITEM_cmn_hairpin;
-    if (value == "harpPedal") return STAFFITEM_cmn_harpPedal;
-    if (value == "lv") return STAFFITEM_cmn_lv;
-    if (value == "mordent") return STAFFITEM_cmn_mordent;
-    if (value == "octave") return STAFFITEM_cmn_octave;
-    if (value == "pedal") return STAFFITEM_cmn_pedal;
-    if (value == "reh") return STAFFITEM_cmn_reh;
-    if (value == "tie") return STAFFITEM_cmn_tie;
-    if (value == "trill") return STAFFITEM_cmn_trill;
-    if (value == "tuplet") return STAFFITEM_cmn_tuplet;
-    if (value == "turn") return STAFFITEM_cmn_turn;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 9, 0, 16, 4, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 3, 0, 0, 0, 13, 14, 0, 0, 5,
+        0, 0, 0, 0, 0, 0, 18, 7, 0, 0, 0, 6, 11, 12, 0, 10, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 8, 0, 0, 0,
+        0, 0 };
+    static const char *const values[18] = { "beam", "bend", "bracketSpan", "breath", "cpMark", "fermata", "fing",
+        "hairpin", "harpPedal", "lv", "mordent", "octave", "pedal", "reh", "tie", "trill", "tuplet", "turn" };
+    const uint8_t slot = slots[HashValue(value, 14) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<data_STAFFITEM_cmn>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.STAFFITEM.cmn", value.c_str());
     return STAFFITEM_cmn_NONE;
@@ -3600,15 +3260,13 @@ std::string AttConverterBase::StemmodifierToStr(data_STEMMODIFIER data) const
 
 data_STEMMODIFIER AttConverterBase::StrToStemmodifier(const std::string &value, bool logWarning) const
 {
-    if (value == "none") return STEMMODIFIER_none;
-    if (value == "1slash") return STEMMODIFIER_1slash;
-    if (value == "2slash") return STEMMODIFIER_2slash;
-    if (value == "3slash") return STEMMODIFIER_3slash;
-    if (value == "4slash") return STEMMODIFIER_4slash;
-    if (value == "5slash") return STEMMODIFIER_5slash;
-    if (value == "6slash") return STEMMODIFIER_6slash;
-    if (value == "sprech") return STEMMODIFIER_sprech;
-    if (value == "z") return STEMMODIFIER_z;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 0, 0, 0, 0, 0, 2, 0, 0, 0, 6, 0, 0, 0, 9, 0, 0, 8, 0, 0, 0, 5, 0, 0, 4, 0, 0, 3,
+        1, 0, 0, 7, 0 };
+    static const char *const values[9] = { "none", "1slash", "2slash", "3slash", "4slash", "5slash", "6slash", "sprech",
+        "z" };
+    const uint8_t slot = slots[HashValue(value, 0) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<data_STEMMODIFIER>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value.c_str());
     return STEMMODIFIER_NONE;
@@ -3708,34 +3366,20 @@ std::string AttConverterBase::TextrenditionToStr(data_TEXTRENDITION data) const
 
 data_TEXTRENDITION AttConverterBase::StrToTextrendition(const std::string &value, bool logWarning) const
 {
-    if (value == "quote") return TEXTRENDITION_quote;
-    if (value == "quotedbl") return TEXTRENDITION_quotedbl;
-    if (value == "italic") return TEXTRENDITION_italic;
-    if (value == "oblique") return TEXTRENDITION_oblique;
-    if (value == "smcaps") return TEXTRENDITION_smcaps;
-    if (value == "bold") return TEXTRENDITION_bold;
-    if (value == "bolder") return TEXTRENDITION_bolder;
-    if (value == "lighter") return TEXTRENDITION_lighter;
-    if (value == "box") return TEXTRENDITION_box;
-    if (value == "circle") return TEXTRENDITION_circle;
-    if (value == "dbox") return TEXTRENDITION_dbox;
-    if (value == "tbox") return TEXTRENDITION_tbox;
-    if (value == "bslash") return TEXTRENDITION_bslash;
-    if (value == "fslash") return TEXTRENDITION_fslash;
-    if (value == "line-through") return TEXTRENDITION_line_through;
-    if (value == "none") return TEXTRENDITION_none;
-    if (value == "overline") return TEXTRENDITION_overline;
-    if (value == "overstrike") return TEXTRENDITION_overstrike;
-    if (value == "strike") return TEXTRENDITION_strike;
-    if (value == "sub") return TEXTRENDITION_sub;
-    if (value == "sup") return TEXTRENDITION_sup;
-    if (value == "superimpose") return TEXTRENDITION_superimpose;
-    if (value == "underline") return TEXTRENDITION_underline;
-    if (value == "x-through") return TEXTRENDITION_x_through;
-    if (value == "ltr") return TEXTRENDITION_ltr;
-    if (value == "rtl") return TEXTRENDITION_rtl;
-    if (value == "lro") return TEXTRENDITION_lro;
-    if (value == "rlo") return TEXTRENDITION_rlo;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[256] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 13, 0, 0, 0, 0, 0, 0, 25, 0,
+        23, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 26, 9, 0, 8, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 12, 7, 0, 24,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 20, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 5, 0 };
+    static const char *const values[28] = { "quote", "quotedbl", "italic", "oblique", "smcaps", "bold", "bolder",
+        "lighter", "box", "circle", "dbox", "tbox", "bslash", "fslash", "line-through", "none", "overline",
+        "overstrike", "strike", "sub", "sup", "superimpose", "underline", "x-through", "ltr", "rtl", "lro", "rlo" };
+    const uint8_t slot = slots[HashValue(value, 2) & 255];
+    if (slot && value == values[slot - 1]) return static_cast<data_TEXTRENDITION>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.TEXTRENDITION", value.c_str());
     return TEXTRENDITION_NONE;
@@ -3783,34 +3427,20 @@ std::string AttConverterBase::TextrenditionlistToStr(data_TEXTRENDITIONLIST data
 
 data_TEXTRENDITIONLIST AttConverterBase::StrToTextrenditionlist(const std::string &value, bool logWarning) const
 {
-    if (value == "quote") return TEXTRENDITIONLIST_quote;
-    if (value == "quotedbl") return TEXTRENDITIONLIST_quotedbl;
-    if (value == "italic") return TEXTRENDITIONLIST_italic;
-    if (value == "oblique") return TEXTRENDITIONLIST_oblique;
-    if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
-    if (value == "bold") return TEXTRENDITIONLIST_bold;
-    if (value == "bolder") return TEXTRENDITIONLIST_bolder;
-    if (value == "lighter") return TEXTRENDITIONLIST_lighter;
-    if (value == "box") return TEXTRENDITIONLIST_box;
-    if (value == "circle") return TEXTRENDITIONLIST_circle;
-    if (value == "dbox") return TEXTRENDITIONLIST_dbox;
-    if (value == "tbox") return TEXTRENDITIONLIST_tbox;
-    if (value == "bslash") return TEXTRENDITIONLIST_bslash;
-    if (value == "fslash") return TEXTRENDITIONLIST_fslash;
-    if (value == "line-through") return TEXTRENDITIONLIST_line_through;
-    if (value == "none") return TEXTRENDITIONLIST_none;
-    if (value == "overline") return TEXTRENDITIONLIST_overline;
-    if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
-    if (value == "strike") return TEXTRENDITIONLIST_strike;
-    if (value == "sub") return TEXTRENDITIONLIST_sub;
-    if (value == "sup") return TEXTRENDITIONLIST_sup;
-    if (value == "superimpose") return TEXTRENDITIONLIST_superimpose;
-    if (value == "underline") return TEXTRENDITIONLIST_underline;
-    if (value == "x-through") return TEXTRENDITIONLIST_x_through;
-    if (value == "ltr") return TEXTRENDITIONLIST_ltr;
-    if (value == "rtl") return TEXTRENDITIONLIST_rtl;
-    if (value == "lro") return TEXTRENDITIONLIST_lro;
-    if (value == "rlo") return TEXTRENDITIONLIST_rlo;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[256] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 13, 0, 0, 0, 0, 0, 0, 25, 0,
+        23, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 26, 9, 0, 8, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 12, 7, 0, 24,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 20, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 5, 0 };
+    static const char *const values[28] = { "quote", "quotedbl", "italic", "oblique", "smcaps", "bold", "bolder",
+        "lighter", "box", "circle", "dbox", "tbox", "bslash", "fslash", "line-through", "none", "overline",
+        "overstrike", "strike", "sub", "sup", "superimpose", "underline", "x-through", "ltr", "rtl", "lro", "rlo" };
+    const uint8_t slot = slots[HashValue(value, 2) & 255];
+    if (slot && value == values[slot - 1]) return static_cast<data_TEXTRENDITIONLIST>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value.c_str());
     return TEXTRENDITIONLIST_NONE;
@@ -4673,23 +4303,14 @@ std::string AttConverterBase::MeasurementUnitToStr(measurement_UNIT data) const
 
 measurement_UNIT AttConverterBase::StrToMeasurementUnit(const std::string &value, bool logWarning) const
 {
-    if (value == "byte") return measurement_UNIT_byte;
-    if (value == "char") return measurement_UNIT_char;
-    if (value == "cm") return measurement_UNIT_cm;
-    if (value == "deg") return measurement_UNIT_deg;
-    if (value == "in") return measurement_UNIT_in;
-    if (value == "issue") return measurement_UNIT_issue;
-    if (value == "ft") return measurement_UNIT_ft;
-    if (value == "m") return measurement_UNIT_m;
-    if (value == "mm") return measurement_UNIT_mm;
-    if (value == "page") return measurement_UNIT_page;
-    if (value == "pc") return measurement_UNIT_pc;
-    if (value == "pt") return measurement_UNIT_pt;
-    if (value == "px") return measurement_UNIT_px;
-    if (value == "rad") return measurement_UNIT_rad;
-    if (value == "record") return measurement_UNIT_record;
-    if (value == "vol") return measurement_UNIT_vol;
-    if (value == "vu") return measurement_UNIT_vu;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 8, 0, 0, 1, 0, 0, 0, 9, 0, 0, 16, 0, 0, 3, 0,
+        0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 13, 11, 0, 0, 2, 15, 0, 0, 0, 0, 7, 6, 12, 17, 0, 5, 0,
+        0, 0, 0 };
+    static const char *const values[17] = { "byte", "char", "cm", "deg", "in", "issue", "ft", "m", "mm", "page", "pc",
+        "pt", "px", "rad", "record", "vol", "vu" };
+    const uint8_t slot = slots[HashValue(value, 1) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<measurement_UNIT>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for att.measurement@unit", value.c_str());
     return measurement_UNIT_NONE;
@@ -4718,15 +4339,13 @@ std::string AttConverterBase::MeiVersionMeiversionToStr(meiVersion_MEIVERSION da
 
 meiVersion_MEIVERSION AttConverterBase::StrToMeiVersionMeiversion(const std::string &value, bool logWarning) const
 {
-    if (value == "2013") return meiVersion_MEIVERSION_2013;
-    if (value == "3.0.0") return meiVersion_MEIVERSION_3_0_0;
-    if (value == "4.0.0") return meiVersion_MEIVERSION_4_0_0;
-    if (value == "4.0.1") return meiVersion_MEIVERSION_4_0_1;
-    if (value == "5.0") return meiVersion_MEIVERSION_5_0;
-    if (value == "5.0+basic") return meiVersion_MEIVERSION_5_0plusbasic;
-    if (value == "5.0+CMN") return meiVersion_MEIVERSION_5_0plusCMN;
-    if (value == "5.0+Mensural") return meiVersion_MEIVERSION_5_0plusMensural;
-    if (value == "5.0+Neumes") return meiVersion_MEIVERSION_5_0plusNeumes;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 4, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 9, 0, 0, 0, 8, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 5, 7 };
+    static const char *const values[9] = { "2013", "3.0.0", "4.0.0", "4.0.1", "5.0", "5.0+basic", "5.0+CMN",
+        "5.0+Mensural", "5.0+Neumes" };
+    const uint8_t slot = slots[HashValue(value, 0) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<meiVersion_MEIVERSION>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for att.meiVersion@meiversion", value.c_str());
     return meiVersion_MEIVERSION_NONE;
@@ -4935,26 +4554,15 @@ std::string AttConverterBase::NeumeTypeTypeToStr(neumeType_TYPE data) const
 
 neumeType_TYPE AttConverterBase::StrToNeumeTypeType(const std::string &value, bool logWarning) const
 {
-    if (value == "apostropha") return neumeType_TYPE_apostropha;
-    if (value == "bistropha") return neumeType_TYPE_bistropha;
-    if (value == "climacus") return neumeType_TYPE_climacus;
-    if (value == "clivis") return neumeType_TYPE_clivis;
-    if (value == "oriscus") return neumeType_TYPE_oriscus;
-    if (value == "pes") return neumeType_TYPE_pes;
-    if (value == "pessubpunctis") return neumeType_TYPE_pessubpunctis;
-    if (value == "porrectus") return neumeType_TYPE_porrectus;
-    if (value == "porrectusflexus") return neumeType_TYPE_porrectusflexus;
-    if (value == "pressusmaior") return neumeType_TYPE_pressusmaior;
-    if (value == "pressusminor") return neumeType_TYPE_pressusminor;
-    if (value == "punctum") return neumeType_TYPE_punctum;
-    if (value == "quilisma") return neumeType_TYPE_quilisma;
-    if (value == "scandicus") return neumeType_TYPE_scandicus;
-    if (value == "strophicus") return neumeType_TYPE_strophicus;
-    if (value == "torculus") return neumeType_TYPE_torculus;
-    if (value == "torculusresupinus") return neumeType_TYPE_torculusresupinus;
-    if (value == "tristropha") return neumeType_TYPE_tristropha;
-    if (value == "virga") return neumeType_TYPE_virga;
-    if (value == "virgastrata") return neumeType_TYPE_virgastrata;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[64] = { 0, 16, 4, 10, 0, 0, 0, 3, 12, 0, 15, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 14, 0, 17, 0, 0, 0, 0, 0, 0, 6, 1, 7, 8, 2, 19, 5, 0, 11, 0, 0, 0, 20, 0, 0,
+        0, 0, 13 };
+    static const char *const values[20] = { "apostropha", "bistropha", "climacus", "clivis", "oriscus", "pes",
+        "pessubpunctis", "porrectus", "porrectusflexus", "pressusmaior", "pressusminor", "punctum", "quilisma",
+        "scandicus", "strophicus", "torculus", "torculusresupinus", "tristropha", "virga", "virgastrata" };
+    const uint8_t slot = slots[HashValue(value, 7) & 63];
+    if (slot && value == values[slot - 1]) return static_cast<neumeType_TYPE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for att.neumeType@type", value.c_str());
     return neumeType_TYPE_NONE;
@@ -5186,20 +4794,12 @@ std::string AttConverterBase::RecordTypeRecordtypeToStr(recordType_RECORDTYPE da
 
 recordType_RECORDTYPE AttConverterBase::StrToRecordTypeRecordtype(const std::string &value, bool logWarning) const
 {
-    if (value == "a") return recordType_RECORDTYPE_a;
-    if (value == "c") return recordType_RECORDTYPE_c;
-    if (value == "d") return recordType_RECORDTYPE_d;
-    if (value == "e") return recordType_RECORDTYPE_e;
-    if (value == "f") return recordType_RECORDTYPE_f;
-    if (value == "g") return recordType_RECORDTYPE_g;
-    if (value == "i") return recordType_RECORDTYPE_i;
-    if (value == "j") return recordType_RECORDTYPE_j;
-    if (value == "k") return recordType_RECORDTYPE_k;
-    if (value == "m") return recordType_RECORDTYPE_m;
-    if (value == "o") return recordType_RECORDTYPE_o;
-    if (value == "p") return recordType_RECORDTYPE_p;
-    if (value == "r") return recordType_RECORDTYPE_r;
-    if (value == "t") return recordType_RECORDTYPE_t;
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+    static const uint8_t slots[32] = { 4, 0, 0, 14, 7, 0, 6, 0, 0, 0, 9, 0, 1, 0, 0, 12, 0, 0, 2, 3, 0, 13, 0, 0, 10, 5,
+        0, 0, 0, 8, 11, 0 };
+    static const char *const values[14] = { "a", "c", "d", "e", "f", "g", "i", "j", "k", "m", "o", "p", "r", "t" };
+    const uint8_t slot = slots[HashValue(value, 0) & 31];
+    if (slot && value == values[slot - 1]) return static_cast<recordType_RECORDTYPE>(slot);
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for att.recordType@recordtype", value.c_str());
     return recordType_RECORDTYPE_NONE;
@@ -15,6 +15,7 @@
 #ifndef __LIBMEI_ATT_CONVERTER_H__
 #define __LIBMEI_ATT_CONVERTER_H__
 
+#include <cstdint>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -32,6 +33,19 @@ protected:
     AttConverterBase() = default;
     ~AttConverterBase() = default;
 
+    /**
+     * Hash function (32-bit FNV-1a) used for looking up values in the perfect hash tables of the converters.
+     * The seed is chosen by libmei when generating the tables so that all the values of a type have distinct slots.
+     */
+    static uint32_t HashValue(const std::string &value, uint32_t seed)
+    {
+        uint32_t hash = 2166136261u ^ seed;
+        for (const unsigned char c : value) {
+            hash = (hash ^ c) * 16777619u;
+        }
+        return hash;
+    }
+
 public:
     std::string AccidentalGesturalToStr(data_ACCIDENTAL_GESTURAL data) const;
     data_ACCIDENTAL_GESTURAL StrToAccidentalGestural(const std::string &value, bool logWarning = true) const;
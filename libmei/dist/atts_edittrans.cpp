@@ -39,9 +39,9 @@ void AttAgentIdent::ResetAgentIdent()
 bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        if (removeAttr) element.remove_attribute("agent");
+    if (pugi::xml_attribute attr = element.attribute("agent")) {
+        this->SetAgent(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +79,9 @@ void AttReasonIdent::ResetReasonIdent()
 bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        if (removeAttr) element.remove_attribute("reason");
+    if (pugi::xml_attribute attr = element.attribute("reason")) {
+        this->SetReason(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,9 @@ void AttFacsimile::ResetFacsimile()
 bool AttFacsimile::ReadFacsimile(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("facs")) {
-        this->SetFacs(StrToStr(element.attribute("facs").value()));
-        if (removeAttr) element.remove_attribute("facs");
+    if (pugi::xml_attribute attr = element.attribute("facs")) {
+        this->SetFacs(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -40,14 +40,14 @@ void AttTabular::ResetTabular()
 bool AttTabular::ReadTabular(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colspan")) {
-        this->SetColspan(StrToInt(element.attribute("colspan").value()));
-        if (removeAttr) element.remove_attribute("colspan");
+    if (pugi::xml_attribute attr = element.attribute("colspan")) {
+        this->SetColspan(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rowspan")) {
-        this->SetRowspan(StrToInt(element.attribute("rowspan").value()));
-        if (removeAttr) element.remove_attribute("rowspan");
+    if (pugi::xml_attribute attr = element.attribute("rowspan")) {
+        this->SetRowspan(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
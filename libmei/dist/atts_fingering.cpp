@@ -39,9 +39,9 @@ void AttFingGrpLog::ResetFingGrpLog()
 bool AttFingGrpLog::ReadFingGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFingGrpLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToFingGrpLogForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,9 @@ void AttCourseLog::ResetCourseLog()
 bool AttCourseLog::ReadCourseLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuning.standard")) {
-        this->SetTuningStandard(StrToCoursetuning(element.attribute("tuning.standard").value()));
-        if (removeAttr) element.remove_attribute("tuning.standard");
+    if (pugi::xml_attribute attr = element.attribute("tuning.standard")) {
+        this->SetTuningStandard(StrToCoursetuning(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -80,14 +80,14 @@ void AttNoteGesTab::ResetNoteGesTab()
 bool AttNoteGesTab::ReadNoteGesTab(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.course")) {
-        this->SetTabCourse(StrToInt(element.attribute("tab.course").value()));
-        if (removeAttr) element.remove_attribute("tab.course");
+    if (pugi::xml_attribute attr = element.attribute("tab.course")) {
+        this->SetTabCourse(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.fret")) {
-        this->SetTabFret(StrToInt(element.attribute("tab.fret").value()));
-        if (removeAttr) element.remove_attribute("tab.fret");
+    if (pugi::xml_attribute attr = element.attribute("tab.fret")) {
+        this->SetTabFret(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,9 @@ void AttAccidentalGes::ResetAccidentalGes()
 bool AttAccidentalGes::ReadAccidentalGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalGestural(element.attribute("accid.ges").value()));
-        if (removeAttr) element.remove_attribute("accid.ges");
+    if (pugi::xml_attribute attr = element.attribute("accid.ges")) {
+        this->SetAccidGes(StrToAccidentalGestural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +79,9 @@ void AttArticulationGes::ResetArticulationGes()
 bool AttArticulationGes::ReadArticulationGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulationList(element.attribute("artic.ges").value()));
-        if (removeAttr) element.remove_attribute("artic.ges");
+    if (pugi::xml_attribute attr = element.attribute("artic.ges")) {
+        this->SetArticGes(StrToArticulationList(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -119,9 +119,9 @@ void AttAttacking::ResetAttacking()
 bool AttAttacking::ReadAttacking(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attacca")) {
-        this->SetAttacca(StrToBoolean(element.attribute("attacca").value()));
-        if (removeAttr) element.remove_attribute("attacca");
+    if (pugi::xml_attribute attr = element.attribute("attacca")) {
+        this->SetAttacca(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -159,9 +159,9 @@ void AttBendGes::ResetBendGes()
 bool AttBendGes::ReadBendGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        if (removeAttr) element.remove_attribute("amount");
+    if (pugi::xml_attribute attr = element.attribute("amount")) {
+        this->SetAmount(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -204,34 +204,34 @@ void AttDurationGes::ResetDurationGes()
 bool AttDurationGes::ReadDurationGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        if (removeAttr) element.remove_attribute("dur.ges");
+    if (pugi::xml_attribute attr = element.attribute("dur.ges")) {
+        this->SetDurGes(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dots.ges")) {
-        this->SetDotsGes(StrToInt(element.attribute("dots.ges").value()));
-        if (removeAttr) element.remove_attribute("dots.ges");
+    if (pugi::xml_attribute attr = element.attribute("dots.ges")) {
+        this->SetDotsGes(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dur.metrical")) {
-        this->SetDurMetrical(StrToDbl(element.attribute("dur.metrical").value()));
-        if (removeAttr) element.remove_attribute("dur.metrical");
+    if (pugi::xml_attribute attr = element.attribute("dur.metrical")) {
+        this->SetDurMetrical(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dur.ppq")) {
-        this->SetDurPpq(StrToInt(element.attribute("dur.ppq").value()));
-        if (removeAttr) element.remove_attribute("dur.ppq");
+    if (pugi::xml_attribute attr = element.attribute("dur.ppq")) {
+        this->SetDurPpq(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dur.real")) {
-        this->SetDurReal(StrToDbl(element.attribute("dur.real").value()));
-        if (removeAttr) element.remove_attribute("dur.real");
+    if (pugi::xml_attribute attr = element.attribute("dur.real")) {
+        this->SetDurReal(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dur.recip")) {
-        this->SetDurRecip(StrToStr(element.attribute("dur.recip").value()));
-        if (removeAttr) element.remove_attribute("dur.recip");
+    if (pugi::xml_attribute attr = element.attribute("dur.recip")) {
+        this->SetDurRecip(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -314,9 +314,9 @@ void AttNoteGes::ResetNoteGes()
 bool AttNoteGes::ReadNoteGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extremis")) {
-        this->SetExtremis(StrToNoteGesExtremis(element.attribute("extremis").value()));
-        if (removeAttr) element.remove_attribute("extremis");
+    if (pugi::xml_attribute attr = element.attribute("extremis")) {
+        this->SetExtremis(StrToNoteGesExtremis(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -355,14 +355,14 @@ void AttOrnamentAccidGes::ResetOrnamentAccidGes()
 bool AttOrnamentAccidGes::ReadOrnamentAccidGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper.ges")) {
-        this->SetAccidupperGes(StrToAccidentalGestural(element.attribute("accidupper.ges").value()));
-        if (removeAttr) element.remove_attribute("accidupper.ges");
+    if (pugi::xml_attribute attr = element.attribute("accidupper.ges")) {
+        this->SetAccidupperGes(StrToAccidentalGestural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("accidlower.ges")) {
-        this->SetAccidlowerGes(StrToAccidentalGestural(element.attribute("accidlower.ges").value()));
-        if (removeAttr) element.remove_attribute("accidlower.ges");
+    if (pugi::xml_attribute attr = element.attribute("accidlower.ges")) {
+        this->SetAccidlowerGes(StrToAccidentalGestural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -411,19 +411,19 @@ void AttPitchGes::ResetPitchGes()
 bool AttPitchGes::ReadPitchGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        if (removeAttr) element.remove_attribute("oct.ges");
+    if (pugi::xml_attribute attr = element.attribute("oct.ges")) {
+        this->SetOctGes(StrToOctave(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        if (removeAttr) element.remove_attribute("pname.ges");
+    if (pugi::xml_attribute attr = element.attribute("pname.ges")) {
+        this->SetPnameGes(StrToPitchname(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        if (removeAttr) element.remove_attribute("pnum");
+    if (pugi::xml_attribute attr = element.attribute("pnum")) {
+        this->SetPnum(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -480,14 +480,14 @@ void AttSoundLocation::ResetSoundLocation()
 bool AttSoundLocation::ReadSoundLocation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("azimuth")) {
-        this->SetAzimuth(StrToDbl(element.attribute("azimuth").value()));
-        if (removeAttr) element.remove_attribute("azimuth");
+    if (pugi::xml_attribute attr = element.attribute("azimuth")) {
+        this->SetAzimuth(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("elevation")) {
-        this->SetElevation(StrToDbl(element.attribute("elevation").value()));
-        if (removeAttr) element.remove_attribute("elevation");
+    if (pugi::xml_attribute attr = element.attribute("elevation")) {
+        this->SetElevation(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -535,14 +535,14 @@ void AttTimestampGes::ResetTimestampGes()
 bool AttTimestampGes::ReadTimestampGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDbl(element.attribute("tstamp.ges").value()));
-        if (removeAttr) element.remove_attribute("tstamp.ges");
+    if (pugi::xml_attribute attr = element.attribute("tstamp.ges")) {
+        this->SetTstampGes(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        if (removeAttr) element.remove_attribute("tstamp.real");
+    if (pugi::xml_attribute attr = element.attribute("tstamp.real")) {
+        this->SetTstampReal(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -590,14 +590,14 @@ void AttTimestamp2Ges::ResetTimestamp2Ges()
 bool AttTimestamp2Ges::ReadTimestamp2Ges(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2.ges")) {
-        this->SetTstamp2Ges(StrToMeasurebeat(element.attribute("tstamp2.ges").value()));
-        if (removeAttr) element.remove_attribute("tstamp2.ges");
+    if (pugi::xml_attribute attr = element.attribute("tstamp2.ges")) {
+        this->SetTstamp2Ges(StrToMeasurebeat(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tstamp2.real")) {
-        this->SetTstamp2Real(StrToStr(element.attribute("tstamp2.real").value()));
-        if (removeAttr) element.remove_attribute("tstamp2.real");
+    if (pugi::xml_attribute attr = element.attribute("tstamp2.real")) {
+        this->SetTstamp2Real(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
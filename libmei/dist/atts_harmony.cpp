@@ -39,9 +39,9 @@ void AttHarmLog::ResetHarmLog()
 bool AttHarmLog::ReadHarmLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("chordref")) {
-        this->SetChordref(StrToStr(element.attribute("chordref").value()));
-        if (removeAttr) element.remove_attribute("chordref");
+    if (pugi::xml_attribute attr = element.attribute("chordref")) {
+        this->SetChordref(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
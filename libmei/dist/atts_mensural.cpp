@@ -39,9 +39,9 @@ void AttDurationQuality::ResetDurationQuality()
 bool AttDurationQuality::ReadDurationQuality(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.quality")) {
-        this->SetDurQuality(StrToDurqualityMensural(element.attribute("dur.quality").value()));
-        if (removeAttr) element.remove_attribute("dur.quality");
+    if (pugi::xml_attribute attr = element.attribute("dur.quality")) {
+        this->SetDurQuality(StrToDurqualityMensural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -80,14 +80,14 @@ void AttMensuralLog::ResetMensuralLog()
 bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        if (removeAttr) element.remove_attribute("proport.num");
+    if (pugi::xml_attribute attr = element.attribute("proport.num")) {
+        this->SetProportNum(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        if (removeAttr) element.remove_attribute("proport.numbase");
+    if (pugi::xml_attribute attr = element.attribute("proport.numbase")) {
+        this->SetProportNumbase(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,29 +138,29 @@ void AttMensuralShared::ResetMensuralShared()
 bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        if (removeAttr) element.remove_attribute("modusmaior");
+    if (pugi::xml_attribute attr = element.attribute("modusmaior")) {
+        this->SetModusmaior(StrToModusmaior(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        if (removeAttr) element.remove_attribute("modusminor");
+    if (pugi::xml_attribute attr = element.attribute("modusminor")) {
+        this->SetModusminor(StrToModusminor(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        if (removeAttr) element.remove_attribute("prolatio");
+    if (pugi::xml_attribute attr = element.attribute("prolatio")) {
+        this->SetProlatio(StrToProlatio(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        if (removeAttr) element.remove_attribute("tempus");
+    if (pugi::xml_attribute attr = element.attribute("tempus")) {
+        this->SetTempus(StrToTempus(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("divisio")) {
-        this->SetDivisio(StrToDivisio(element.attribute("divisio").value()));
-        if (removeAttr) element.remove_attribute("divisio");
+    if (pugi::xml_attribute attr = element.attribute("divisio")) {
+        this->SetDivisio(StrToDivisio(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -234,9 +234,9 @@ void AttNoteVisMensural::ResetNoteVisMensural()
 bool AttNoteVisMensural::ReadNoteVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToLigatureform(element.attribute("lig").value()));
-        if (removeAttr) element.remove_attribute("lig");
+    if (pugi::xml_attribute attr = element.attribute("lig")) {
+        this->SetLig(StrToLigatureform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -274,9 +274,9 @@ void AttRestVisMensural::ResetRestVisMensural()
 bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        if (removeAttr) element.remove_attribute("spaces");
+    if (pugi::xml_attribute attr = element.attribute("spaces")) {
+        this->SetSpaces(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -314,9 +314,9 @@ void AttStemsMensural::ResetStemsMensural()
 bool AttStemsMensural::ReadStemsMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.form")) {
-        this->SetStemForm(StrToStemformMensural(element.attribute("stem.form").value()));
-        if (removeAttr) element.remove_attribute("stem.form");
+    if (pugi::xml_attribute attr = element.attribute("stem.form")) {
+        this->SetStemForm(StrToStemformMensural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,9 @@ void AttAlignment::ResetAlignment()
 bool AttAlignment::ReadAlignment(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("when")) {
-        this->SetWhen(StrToStr(element.attribute("when").value()));
-        if (removeAttr) element.remove_attribute("when");
+    if (pugi::xml_attribute attr = element.attribute("when")) {
+        this->SetWhen(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,9 @@ void AttAccidLog::ResetAccidLog()
 bool AttAccidLog::ReadAccidLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToAccidLogFunc(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +79,9 @@ void AttAccidental::ResetAccidental()
 bool AttAccidental::ReadAccidental(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalWritten(element.attribute("accid").value()));
-        if (removeAttr) element.remove_attribute("accid");
+    if (pugi::xml_attribute attr = element.attribute("accid")) {
+        this->SetAccid(StrToAccidentalWritten(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -119,9 +119,9 @@ void AttArticulation::ResetArticulation()
 bool AttArticulation::ReadArticulation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        if (removeAttr) element.remove_attribute("artic");
+    if (pugi::xml_attribute attr = element.attribute("artic")) {
+        this->SetArtic(StrToArticulationList(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -159,9 +159,9 @@ void AttAttaccaLog::ResetAttaccaLog()
 bool AttAttaccaLog::ReadAttaccaLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
+    if (pugi::xml_attribute attr = element.attribute("target")) {
+        this->SetTarget(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -199,9 +199,9 @@ void AttAudience::ResetAudience()
 bool AttAudience::ReadAudience(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("audience")) {
-        this->SetAudience(StrToAudienceAudience(element.attribute("audience").value()));
-        if (removeAttr) element.remove_attribute("audience");
+    if (pugi::xml_attribute attr = element.attribute("audience")) {
+        this->SetAudience(StrToAudienceAudience(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -239,9 +239,9 @@ void AttAugmentDots::ResetAugmentDots()
 bool AttAugmentDots::ReadAugmentDots(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        if (removeAttr) element.remove_attribute("dots");
+    if (pugi::xml_attribute attr = element.attribute("dots")) {
+        this->SetDots(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -280,14 +280,14 @@ void AttAuthorized::ResetAuthorized()
 bool AttAuthorized::ReadAuthorized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("auth")) {
-        this->SetAuth(StrToStr(element.attribute("auth").value()));
-        if (removeAttr) element.remove_attribute("auth");
+    if (pugi::xml_attribute attr = element.attribute("auth")) {
+        this->SetAuth(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("auth.uri")) {
-        this->SetAuthUri(StrToStr(element.attribute("auth.uri").value()));
-        if (removeAttr) element.remove_attribute("auth.uri");
+    if (pugi::xml_attribute attr = element.attribute("auth.uri")) {
+        this->SetAuthUri(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -334,9 +334,9 @@ void AttBarLineLog::ResetBarLineLog()
 bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToBarrendition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -376,19 +376,19 @@ void AttBarring::ResetBarring()
 bool AttBarring::ReadBarring(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.len")) {
-        this->SetBarLen(StrToDbl(element.attribute("bar.len").value()));
-        if (removeAttr) element.remove_attribute("bar.len");
+    if (pugi::xml_attribute attr = element.attribute("bar.len")) {
+        this->SetBarLen(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("bar.method")) {
-        this->SetBarMethod(StrToBarmethod(element.attribute("bar.method").value()));
-        if (removeAttr) element.remove_attribute("bar.method");
+    if (pugi::xml_attribute attr = element.attribute("bar.method")) {
+        this->SetBarMethod(StrToBarmethod(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("bar.place")) {
-        this->SetBarPlace(StrToInt(element.attribute("bar.place").value()));
-        if (removeAttr) element.remove_attribute("bar.place");
+    if (pugi::xml_attribute attr = element.attribute("bar.place")) {
+        this->SetBarPlace(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -444,9 +444,9 @@ void AttBasic::ResetBasic()
 bool AttBasic::ReadBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        if (removeAttr) element.remove_attribute("xml:base");
+    if (pugi::xml_attribute attr = element.attribute("xml:base")) {
+        this->SetBase(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -484,9 +484,9 @@ void AttBibl::ResetBibl()
 bool AttBibl::ReadBibl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        if (removeAttr) element.remove_attribute("analog");
+    if (pugi::xml_attribute attr = element.attribute("analog")) {
+        this->SetAnalog(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -524,9 +524,9 @@ void AttCalendared::ResetCalendared()
 bool AttCalendared::ReadCalendared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        if (removeAttr) element.remove_attribute("calendar");
+    if (pugi::xml_attribute attr = element.attribute("calendar")) {
+        this->SetCalendar(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -564,9 +564,9 @@ void AttCanonical::ResetCanonical()
 bool AttCanonical::ReadCanonical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        if (removeAttr) element.remove_attribute("codedval");
+    if (pugi::xml_attribute attr = element.attribute("codedval")) {
+        this->SetCodedval(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -604,9 +604,9 @@ void AttClassed::ResetClassed()
 bool AttClassed::ReadClassed(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("class")) {
-        this->SetClass(StrToStr(element.attribute("class").value()));
-        if (removeAttr) element.remove_attribute("class");
+    if (pugi::xml_attribute attr = element.attribute("class")) {
+        this->SetClass(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -644,9 +644,9 @@ void AttClefLog::ResetClefLog()
 bool AttClefLog::ReadClefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        if (removeAttr) element.remove_attribute("cautionary");
+    if (pugi::xml_attribute attr = element.attribute("cautionary")) {
+        this->SetCautionary(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -684,9 +684,9 @@ void AttClefShape::ResetClefShape()
 bool AttClefShape::ReadClefShape(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        if (removeAttr) element.remove_attribute("shape");
+    if (pugi::xml_attribute attr = element.attribute("shape")) {
+        this->SetShape(StrToClefshape(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -727,24 +727,24 @@ void AttCleffingLog::ResetCleffingLog()
 bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        if (removeAttr) element.remove_attribute("clef.shape");
+    if (pugi::xml_attribute attr = element.attribute("clef.shape")) {
+        this->SetClefShape(StrToClefshape(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        if (removeAttr) element.remove_attribute("clef.line");
+    if (pugi::xml_attribute attr = element.attribute("clef.line")) {
+        this->SetClefLine(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        if (removeAttr) element.remove_attribute("clef.dis");
+    if (pugi::xml_attribute attr = element.attribute("clef.dis")) {
+        this->SetClefDis(StrToOctaveDis(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToStaffrelBasic(element.attribute("clef.dis.place").value()));
-        if (removeAttr) element.remove_attribute("clef.dis.place");
+    if (pugi::xml_attribute attr = element.attribute("clef.dis.place")) {
+        this->SetClefDisPlace(StrToStaffrelBasic(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -809,9 +809,9 @@ void AttColor::ResetColor()
 bool AttColor::ReadColor(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        if (removeAttr) element.remove_attribute("color");
+    if (pugi::xml_attribute attr = element.attribute("color")) {
+        this->SetColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -849,9 +849,9 @@ void AttColoration::ResetColoration()
 bool AttColoration::ReadColoration(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        if (removeAttr) element.remove_attribute("colored");
+    if (pugi::xml_attribute attr = element.attribute("colored")) {
+        this->SetColored(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -889,9 +889,9 @@ void AttCoordX1::ResetCoordX1()
 bool AttCoordX1::ReadCoordX1(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.x1")) {
-        this->SetCoordX1(StrToDbl(element.attribute("coord.x1").value()));
-        if (removeAttr) element.remove_attribute("coord.x1");
+    if (pugi::xml_attribute attr = element.attribute("coord.x1")) {
+        this->SetCoordX1(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -929,9 +929,9 @@ void AttCoordX2::ResetCoordX2()
 bool AttCoordX2::ReadCoordX2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.x2")) {
-        this->SetCoordX2(StrToDbl(element.attribute("coord.x2").value()));
-        if (removeAttr) element.remove_attribute("coord.x2");
+    if (pugi::xml_attribute attr = element.attribute("coord.x2")) {
+        this->SetCoordX2(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -969,9 +969,9 @@ void AttCoordY1::ResetCoordY1()
 bool AttCoordY1::ReadCoordY1(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coord.y1")) {
-        this->SetCoordY1(StrToDbl(element.attribute("coord.y1").value()));
-        if (removeAttr) element.remove_attribute("coord.y1");
+    if (pugi::xml_attribute attr = element.attribute("coord.y1")) {
+        this->SetCoordY1(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1011,19 +1011,19 @@ void AttCoordinated::ResetCoordinated()
 bool AttCoordinated::ReadCoordinated(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        if (removeAttr) element.remove_attribute("lrx");
+    if (pugi::xml_attribute attr = element.attribute("lrx")) {
+        this->SetLrx(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        if (removeAttr) element.remove_attribute("lry");
+    if (pugi::xml_attribute attr = element.attribute("lry")) {
+        this->SetLry(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rotate")) {
-        this->SetRotate(StrToDbl(element.attribute("rotate").value()));
-        if (removeAttr) element.remove_attribute("rotate");
+    if (pugi::xml_attribute attr = element.attribute("rotate")) {
+        this->SetRotate(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1080,14 +1080,14 @@ void AttCoordinatedUl::ResetCoordinatedUl()
 bool AttCoordinatedUl::ReadCoordinatedUl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        if (removeAttr) element.remove_attribute("ulx");
+    if (pugi::xml_attribute attr = element.attribute("ulx")) {
+        this->SetUlx(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        if (removeAttr) element.remove_attribute("uly");
+    if (pugi::xml_attribute attr = element.attribute("uly")) {
+        this->SetUly(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1134,9 +1134,9 @@ void AttCue::ResetCue()
 bool AttCue::ReadCue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cue")) {
-        this->SetCue(StrToBoolean(element.attribute("cue").value()));
-        if (removeAttr) element.remove_attribute("cue");
+    if (pugi::xml_attribute attr = element.attribute("cue")) {
+        this->SetCue(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1176,19 +1176,19 @@ void AttCurvature::ResetCurvature()
 bool AttCurvature::ReadCurvature(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        if (removeAttr) element.remove_attribute("bezier");
+    if (pugi::xml_attribute attr = element.attribute("bezier")) {
+        this->SetBezier(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToBulge(element.attribute("bulge").value()));
-        if (removeAttr) element.remove_attribute("bulge");
+    if (pugi::xml_attribute attr = element.attribute("bulge")) {
+        this->SetBulge(StrToBulge(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        if (removeAttr) element.remove_attribute("curvedir");
+    if (pugi::xml_attribute attr = element.attribute("curvedir")) {
+        this->SetCurvedir(StrToCurvatureCurvedir(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1244,9 +1244,9 @@ void AttCustosLog::ResetCustosLog()
 bool AttCustosLog::ReadCustosLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
+    if (pugi::xml_attribute attr = element.attribute("target")) {
+        this->SetTarget(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1284,9 +1284,9 @@ void AttDataPointing::ResetDataPointing()
 bool AttDataPointing::ReadDataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        if (removeAttr) element.remove_attribute("data");
+    if (pugi::xml_attribute attr = element.attribute("data")) {
+        this->SetData(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1328,29 +1328,29 @@ void AttDatable::ResetDatable()
 bool AttDatable::ReadDatable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        if (removeAttr) element.remove_attribute("enddate");
+    if (pugi::xml_attribute attr = element.attribute("enddate")) {
+        this->SetEnddate(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        if (removeAttr) element.remove_attribute("isodate");
+    if (pugi::xml_attribute attr = element.attribute("isodate")) {
+        this->SetIsodate(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        if (removeAttr) element.remove_attribute("notafter");
+    if (pugi::xml_attribute attr = element.attribute("notafter")) {
+        this->SetNotafter(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        if (removeAttr) element.remove_attribute("notbefore");
+    if (pugi::xml_attribute attr = element.attribute("notbefore")) {
+        this->SetNotbefore(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        if (removeAttr) element.remove_attribute("startdate");
+    if (pugi::xml_attribute attr = element.attribute("startdate")) {
+        this->SetStartdate(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1428,29 +1428,29 @@ void AttDistances::ResetDistances()
 bool AttDistances::ReadDistances(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir.dist")) {
-        this->SetDirDist(StrToMeasurementsigned(element.attribute("dir.dist").value()));
-        if (removeAttr) element.remove_attribute("dir.dist");
+    if (pugi::xml_attribute attr = element.attribute("dir.dist")) {
+        this->SetDirDist(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToMeasurementsigned(element.attribute("dynam.dist").value()));
-        if (removeAttr) element.remove_attribute("dynam.dist");
+    if (pugi::xml_attribute attr = element.attribute("dynam.dist")) {
+        this->SetDynamDist(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToMeasurementsigned(element.attribute("harm.dist").value()));
-        if (removeAttr) element.remove_attribute("harm.dist");
+    if (pugi::xml_attribute attr = element.attribute("harm.dist")) {
+        this->SetHarmDist(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("reh.dist")) {
-        this->SetRehDist(StrToMeasurementsigned(element.attribute("reh.dist").value()));
-        if (removeAttr) element.remove_attribute("reh.dist");
+    if (pugi::xml_attribute attr = element.attribute("reh.dist")) {
+        this->SetRehDist(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tempo.dist")) {
-        this->SetTempoDist(StrToMeasurementsigned(element.attribute("tempo.dist").value()));
-        if (removeAttr) element.remove_attribute("tempo.dist");
+    if (pugi::xml_attribute attr = element.attribute("tempo.dist")) {
+        this->SetTempoDist(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1524,9 +1524,9 @@ void AttDotLog::ResetDotLog()
 bool AttDotLog::ReadDotLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToDotLogForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1564,9 +1564,9 @@ void AttDurationAdditive::ResetDurationAdditive()
 bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
+    if (pugi::xml_attribute attr = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1606,19 +1606,19 @@ void AttDurationDefault::ResetDurationDefault()
 bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        if (removeAttr) element.remove_attribute("dur.default");
+    if (pugi::xml_attribute attr = element.attribute("dur.default")) {
+        this->SetDurDefault(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        if (removeAttr) element.remove_attribute("num.default");
+    if (pugi::xml_attribute attr = element.attribute("num.default")) {
+        this->SetNumDefault(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        if (removeAttr) element.remove_attribute("numbase.default");
+    if (pugi::xml_attribute attr = element.attribute("numbase.default")) {
+        this->SetNumbaseDefault(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1674,9 +1674,9 @@ void AttDurationLog::ResetDurationLog()
 bool AttDurationLog::ReadDurationLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
+    if (pugi::xml_attribute attr = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1715,14 +1715,14 @@ void AttDurationRatio::ResetDurationRatio()
 bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
+    if (pugi::xml_attribute attr = element.attribute("num")) {
+        this->SetNum(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        if (removeAttr) element.remove_attribute("numbase");
+    if (pugi::xml_attribute attr = element.attribute("numbase")) {
+        this->SetNumbase(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1769,9 +1769,9 @@ void AttEnclosingChars::ResetEnclosingChars()
 bool AttEnclosingChars::ReadEnclosingChars(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        if (removeAttr) element.remove_attribute("enclose");
+    if (pugi::xml_attribute attr = element.attribute("enclose")) {
+        this->SetEnclose(StrToEnclosure(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1809,9 +1809,9 @@ void AttEndings::ResetEndings()
 bool AttEndings::ReadEndings(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        if (removeAttr) element.remove_attribute("ending.rend");
+    if (pugi::xml_attribute attr = element.attribute("ending.rend")) {
+        this->SetEndingRend(StrToEndingsEndingrend(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1850,14 +1850,14 @@ void AttEvidence::ResetEvidence()
 bool AttEvidence::ReadEvidence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        if (removeAttr) element.remove_attribute("cert");
+    if (pugi::xml_attribute attr = element.attribute("cert")) {
+        this->SetCert(StrToCertainty(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        if (removeAttr) element.remove_attribute("evidence");
+    if (pugi::xml_attribute attr = element.attribute("evidence")) {
+        this->SetEvidence(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1904,9 +1904,9 @@ void AttExtender::ResetExtender()
 bool AttExtender::ReadExtender(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        if (removeAttr) element.remove_attribute("extender");
+    if (pugi::xml_attribute attr = element.attribute("extender")) {
+        this->SetExtender(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1944,9 +1944,9 @@ void AttExtent::ResetExtent()
 bool AttExtent::ReadExtent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        if (removeAttr) element.remove_attribute("extent");
+    if (pugi::xml_attribute attr = element.attribute("extent")) {
+        this->SetExtent(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1984,9 +1984,9 @@ void AttFermataPresent::ResetFermataPresent()
 bool AttFermataPresent::ReadFermataPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToStaffrelBasic(element.attribute("fermata").value()));
-        if (removeAttr) element.remove_attribute("fermata");
+    if (pugi::xml_attribute attr = element.attribute("fermata")) {
+        this->SetFermata(StrToStaffrelBasic(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2024,9 +2024,9 @@ void AttFiling::ResetFiling()
 bool AttFiling::ReadFiling(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        if (removeAttr) element.remove_attribute("nonfiling");
+    if (pugi::xml_attribute attr = element.attribute("nonfiling")) {
+        this->SetNonfiling(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2064,9 +2064,9 @@ void AttFormework::ResetFormework()
 bool AttFormework::ReadFormework(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToPgfunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToPgfunc(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2104,9 +2104,9 @@ void AttGrpSymLog::ResetGrpSymLog()
 bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        if (removeAttr) element.remove_attribute("level");
+    if (pugi::xml_attribute attr = element.attribute("level")) {
+        this->SetLevel(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2144,9 +2144,9 @@ void AttHandIdent::ResetHandIdent()
 bool AttHandIdent::ReadHandIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        if (removeAttr) element.remove_attribute("hand");
+    if (pugi::xml_attribute attr = element.attribute("hand")) {
+        this->SetHand(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2184,9 +2184,9 @@ void AttHeight::ResetHeight()
 bool AttHeight::ReadHeight(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToMeasurementunsigned(element.attribute("height").value()));
-        if (removeAttr) element.remove_attribute("height");
+    if (pugi::xml_attribute attr = element.attribute("height")) {
+        this->SetHeight(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2224,9 +2224,9 @@ void AttHorizontalAlign::ResetHorizontalAlign()
 bool AttHorizontalAlign::ReadHorizontalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        if (removeAttr) element.remove_attribute("halign");
+    if (pugi::xml_attribute attr = element.attribute("halign")) {
+        this->SetHalign(StrToHorizontalalignment(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2264,9 +2264,9 @@ void AttInternetMedia::ResetInternetMedia()
 bool AttInternetMedia::ReadInternetMedia(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        if (removeAttr) element.remove_attribute("mimetype");
+    if (pugi::xml_attribute attr = element.attribute("mimetype")) {
+        this->SetMimetype(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2304,9 +2304,9 @@ void AttJoined::ResetJoined()
 bool AttJoined::ReadJoined(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        if (removeAttr) element.remove_attribute("join");
+    if (pugi::xml_attribute attr = element.attribute("join")) {
+        this->SetJoin(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2344,9 +2344,9 @@ void AttKeyMode::ResetKeyMode()
 bool AttKeyMode::ReadKeyMode(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        if (removeAttr) element.remove_attribute("mode");
+    if (pugi::xml_attribute attr = element.attribute("mode")) {
+        this->SetMode(StrToMode(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2384,9 +2384,9 @@ void AttKeySigLog::ResetKeySigLog()
 bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        if (removeAttr) element.remove_attribute("sig");
+    if (pugi::xml_attribute attr = element.attribute("sig")) {
+        this->SetSig(StrToKeysignature(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2424,9 +2424,9 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
 bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("keysig")) {
-        this->SetKeysig(StrToKeysignature(element.attribute("keysig").value()));
-        if (removeAttr) element.remove_attribute("keysig");
+    if (pugi::xml_attribute attr = element.attribute("keysig")) {
+        this->SetKeysig(StrToKeysignature(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2464,9 +2464,9 @@ void AttLabelled::ResetLabelled()
 bool AttLabelled::ReadLabelled(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        if (removeAttr) element.remove_attribute("label");
+    if (pugi::xml_attribute attr = element.attribute("label")) {
+        this->SetLabel(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2505,14 +2505,14 @@ void AttLang::ResetLang()
 bool AttLang::ReadLang(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        if (removeAttr) element.remove_attribute("xml:lang");
+    if (pugi::xml_attribute attr = element.attribute("xml:lang")) {
+        this->SetLang(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("translit")) {
-        this->SetTranslit(StrToStr(element.attribute("translit").value()));
-        if (removeAttr) element.remove_attribute("translit");
+    if (pugi::xml_attribute attr = element.attribute("translit")) {
+        this->SetTranslit(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2559,9 +2559,9 @@ void AttLayerLog::ResetLayerLog()
 bool AttLayerLog::ReadLayerLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        if (removeAttr) element.remove_attribute("def");
+    if (pugi::xml_attribute attr = element.attribute("def")) {
+        this->SetDef(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2599,9 +2599,9 @@ void AttLayerIdent::ResetLayerIdent()
 bool AttLayerIdent::ReadLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        if (removeAttr) element.remove_attribute("layer");
+    if (pugi::xml_attribute attr = element.attribute("layer")) {
+        this->SetLayer(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2639,9 +2639,9 @@ void AttLineLoc::ResetLineLoc()
 bool AttLineLoc::ReadLineLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        if (removeAttr) element.remove_attribute("line");
+    if (pugi::xml_attribute attr = element.attribute("line")) {
+        this->SetLine(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2682,24 +2682,24 @@ void AttLineRend::ResetLineRend()
 bool AttLineRend::ReadLineRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        if (removeAttr) element.remove_attribute("lendsym");
+    if (pugi::xml_attribute attr = element.attribute("lendsym")) {
+        this->SetLendsym(StrToLinestartendsymbol(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lendsym.size")) {
-        this->SetLendsymSize(StrToInt(element.attribute("lendsym.size").value()));
-        if (removeAttr) element.remove_attribute("lendsym.size");
+    if (pugi::xml_attribute attr = element.attribute("lendsym.size")) {
+        this->SetLendsymSize(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        if (removeAttr) element.remove_attribute("lstartsym");
+    if (pugi::xml_attribute attr = element.attribute("lstartsym")) {
+        this->SetLstartsym(StrToLinestartendsymbol(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsym.size")) {
-        this->SetLstartsymSize(StrToInt(element.attribute("lstartsym.size").value()));
-        if (removeAttr) element.remove_attribute("lstartsym.size");
+    if (pugi::xml_attribute attr = element.attribute("lstartsym.size")) {
+        this->SetLstartsymSize(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2766,19 +2766,19 @@ void AttLineRendBase::ResetLineRendBase()
 bool AttLineRendBase::ReadLineRendBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        if (removeAttr) element.remove_attribute("lform");
+    if (pugi::xml_attribute attr = element.attribute("lform")) {
+        this->SetLform(StrToLineform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        if (removeAttr) element.remove_attribute("lwidth");
+    if (pugi::xml_attribute attr = element.attribute("lwidth")) {
+        this->SetLwidth(StrToLinewidth(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lsegs")) {
-        this->SetLsegs(StrToInt(element.attribute("lsegs").value()));
-        if (removeAttr) element.remove_attribute("lsegs");
+    if (pugi::xml_attribute attr = element.attribute("lsegs")) {
+        this->SetLsegs(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2841,44 +2841,44 @@ void AttLinking::ResetLinking()
 bool AttLinking::ReadLinking(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        if (removeAttr) element.remove_attribute("copyof");
+    if (pugi::xml_attribute attr = element.attribute("copyof")) {
+        this->SetCopyof(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        if (removeAttr) element.remove_attribute("corresp");
+    if (pugi::xml_attribute attr = element.attribute("corresp")) {
+        this->SetCorresp(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("follows")) {
-        this->SetFollows(StrToStr(element.attribute("follows").value()));
-        if (removeAttr) element.remove_attribute("follows");
+    if (pugi::xml_attribute attr = element.attribute("follows")) {
+        this->SetFollows(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        if (removeAttr) element.remove_attribute("next");
+    if (pugi::xml_attribute attr = element.attribute("next")) {
+        this->SetNext(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("precedes")) {
-        this->SetPrecedes(StrToStr(element.attribute("precedes").value()));
-        if (removeAttr) element.remove_attribute("precedes");
+    if (pugi::xml_attribute attr = element.attribute("precedes")) {
+        this->SetPrecedes(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        if (removeAttr) element.remove_attribute("prev");
+    if (pugi::xml_attribute attr = element.attribute("prev")) {
+        this->SetPrev(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        if (removeAttr) element.remove_attribute("sameas");
+    if (pugi::xml_attribute attr = element.attribute("sameas")) {
+        this->SetSameas(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        if (removeAttr) element.remove_attribute("synch");
+    if (pugi::xml_attribute attr = element.attribute("synch")) {
+        this->SetSynch(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2984,34 +2984,34 @@ void AttLyricStyle::ResetLyricStyle()
 bool AttLyricStyle::ReadLyricStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToMeasurementsigned(element.attribute("lyric.align").value()));
-        if (removeAttr) element.remove_attribute("lyric.align");
+    if (pugi::xml_attribute attr = element.attribute("lyric.align")) {
+        this->SetLyricAlign(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        if (removeAttr) element.remove_attribute("lyric.fam");
+    if (pugi::xml_attribute attr = element.attribute("lyric.fam")) {
+        this->SetLyricFam(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        if (removeAttr) element.remove_attribute("lyric.name");
+    if (pugi::xml_attribute attr = element.attribute("lyric.name")) {
+        this->SetLyricName(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToFontsize(element.attribute("lyric.size").value()));
-        if (removeAttr) element.remove_attribute("lyric.size");
+    if (pugi::xml_attribute attr = element.attribute("lyric.size")) {
+        this->SetLyricSize(StrToFontsize(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        if (removeAttr) element.remove_attribute("lyric.style");
+    if (pugi::xml_attribute attr = element.attribute("lyric.style")) {
+        this->SetLyricStyle(StrToFontstyle(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        if (removeAttr) element.remove_attribute("lyric.weight");
+    if (pugi::xml_attribute attr = element.attribute("lyric.weight")) {
+        this->SetLyricWeight(StrToFontweight(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3094,9 +3094,9 @@ void AttMeasureNumbers::ResetMeasureNumbers()
 bool AttMeasureNumbers::ReadMeasureNumbers(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        if (removeAttr) element.remove_attribute("mnum.visible");
+    if (pugi::xml_attribute attr = element.attribute("mnum.visible")) {
+        this->SetMnumVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3134,9 +3134,9 @@ void AttMeasurement::ResetMeasurement()
 bool AttMeasurement::ReadMeasurement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        if (removeAttr) element.remove_attribute("unit");
+    if (pugi::xml_attribute attr = element.attribute("unit")) {
+        this->SetUnit(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3176,19 +3176,19 @@ void AttMediaBounds::ResetMediaBounds()
 bool AttMediaBounds::ReadMediaBounds(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        if (removeAttr) element.remove_attribute("begin");
+    if (pugi::xml_attribute attr = element.attribute("begin")) {
+        this->SetBegin(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        if (removeAttr) element.remove_attribute("end");
+    if (pugi::xml_attribute attr = element.attribute("end")) {
+        this->SetEnd(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        if (removeAttr) element.remove_attribute("betype");
+    if (pugi::xml_attribute attr = element.attribute("betype")) {
+        this->SetBetype(StrToBetype(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3244,9 +3244,9 @@ void AttMedium::ResetMedium()
 bool AttMedium::ReadMedium(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        if (removeAttr) element.remove_attribute("medium");
+    if (pugi::xml_attribute attr = element.attribute("medium")) {
+        this->SetMedium(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3284,9 +3284,9 @@ void AttMeiVersion::ResetMeiVersion()
 bool AttMeiVersion::ReadMeiVersion(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiVersionMeiversion(element.attribute("meiversion").value()));
-        if (removeAttr) element.remove_attribute("meiversion");
+    if (pugi::xml_attribute attr = element.attribute("meiversion")) {
+        this->SetMeiversion(StrToMeiVersionMeiversion(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3324,9 +3324,9 @@ void AttMensurLog::ResetMensurLog()
 bool AttMensurLog::ReadMensurLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToDuration(element.attribute("level").value()));
-        if (removeAttr) element.remove_attribute("level");
+    if (pugi::xml_attribute attr = element.attribute("level")) {
+        this->SetLevel(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3364,9 +3364,9 @@ void AttMetadataPointing::ResetMetadataPointing()
 bool AttMetadataPointing::ReadMetadataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        if (removeAttr) element.remove_attribute("decls");
+    if (pugi::xml_attribute attr = element.attribute("decls")) {
+        this->SetDecls(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3404,9 +3404,9 @@ void AttMeterConformance::ResetMeterConformance()
 bool AttMeterConformance::ReadMeterConformance(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterConformanceMetcon(element.attribute("metcon").value()));
-        if (removeAttr) element.remove_attribute("metcon");
+    if (pugi::xml_attribute attr = element.attribute("metcon")) {
+        this->SetMetcon(StrToMeterConformanceMetcon(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3445,14 +3445,14 @@ void AttMeterConformanceBar::ResetMeterConformanceBar()
 bool AttMeterConformanceBar::ReadMeterConformanceBar(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        if (removeAttr) element.remove_attribute("metcon");
+    if (pugi::xml_attribute attr = element.attribute("metcon")) {
+        this->SetMetcon(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        if (removeAttr) element.remove_attribute("control");
+    if (pugi::xml_attribute attr = element.attribute("control")) {
+        this->SetControl(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3501,19 +3501,19 @@ void AttMeterSigLog::ResetMeterSigLog()
 bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToMetercountPair(element.attribute("count").value()));
-        if (removeAttr) element.remove_attribute("count");
+    if (pugi::xml_attribute attr = element.attribute("count")) {
+        this->SetCount(StrToMetercountPair(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        if (removeAttr) element.remove_attribute("sym");
+    if (pugi::xml_attribute attr = element.attribute("sym")) {
+        this->SetSym(StrToMetersign(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        if (removeAttr) element.remove_attribute("unit");
+    if (pugi::xml_attribute attr = element.attribute("unit")) {
+        this->SetUnit(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3571,19 +3571,19 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
 bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToMetercountPair(element.attribute("meter.count").value()));
-        if (removeAttr) element.remove_attribute("meter.count");
+    if (pugi::xml_attribute attr = element.attribute("meter.count")) {
+        this->SetMeterCount(StrToMetercountPair(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        if (removeAttr) element.remove_attribute("meter.unit");
+    if (pugi::xml_attribute attr = element.attribute("meter.unit")) {
+        this->SetMeterUnit(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        if (removeAttr) element.remove_attribute("meter.sym");
+    if (pugi::xml_attribute attr = element.attribute("meter.sym")) {
+        this->SetMeterSym(StrToMetersign(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3641,19 +3641,19 @@ void AttMmTempo::ResetMmTempo()
 bool AttMmTempo::ReadMmTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToDbl(element.attribute("mm").value()));
-        if (removeAttr) element.remove_attribute("mm");
+    if (pugi::xml_attribute attr = element.attribute("mm")) {
+        this->SetMm(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        if (removeAttr) element.remove_attribute("mm.unit");
+    if (pugi::xml_attribute attr = element.attribute("mm.unit")) {
+        this->SetMmUnit(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        if (removeAttr) element.remove_attribute("mm.dots");
+    if (pugi::xml_attribute attr = element.attribute("mm.dots")) {
+        this->SetMmDots(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3709,9 +3709,9 @@ void AttMultinumMeasures::ResetMultinumMeasures()
 bool AttMultinumMeasures::ReadMultinumMeasures(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        if (removeAttr) element.remove_attribute("multi.number");
+    if (pugi::xml_attribute attr = element.attribute("multi.number")) {
+        this->SetMultiNumber(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3749,9 +3749,9 @@ void AttNInteger::ResetNInteger()
 bool AttNInteger::ReadNInteger(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        if (removeAttr) element.remove_attribute("n");
+    if (pugi::xml_attribute attr = element.attribute("n")) {
+        this->SetN(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3789,9 +3789,9 @@ void AttNNumberLike::ResetNNumberLike()
 bool AttNNumberLike::ReadNNumberLike(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToStr(element.attribute("n").value()));
-        if (removeAttr) element.remove_attribute("n");
+    if (pugi::xml_attribute attr = element.attribute("n")) {
+        this->SetN(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3830,14 +3830,14 @@ void AttName::ResetName()
 bool AttName::ReadName(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        if (removeAttr) element.remove_attribute("nymref");
+    if (pugi::xml_attribute attr = element.attribute("nymref")) {
+        this->SetNymref(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        if (removeAttr) element.remove_attribute("role");
+    if (pugi::xml_attribute attr = element.attribute("role")) {
+        this->SetRole(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3885,14 +3885,14 @@ void AttNotationStyle::ResetNotationStyle()
 bool AttNotationStyle::ReadNotationStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        if (removeAttr) element.remove_attribute("music.name");
+    if (pugi::xml_attribute attr = element.attribute("music.name")) {
+        this->SetMusicName(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToFontsize(element.attribute("music.size").value()));
-        if (removeAttr) element.remove_attribute("music.size");
+    if (pugi::xml_attribute attr = element.attribute("music.size")) {
+        this->SetMusicSize(StrToFontsize(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3947,49 +3947,49 @@ void AttNoteHeads::ResetNoteHeads()
 bool AttNoteHeads::ReadNoteHeads(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("head.altsym")) {
-        this->SetHeadAltsym(StrToStr(element.attribute("head.altsym").value()));
-        if (removeAttr) element.remove_attribute("head.altsym");
+    if (pugi::xml_attribute attr = element.attribute("head.altsym")) {
+        this->SetHeadAltsym(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.auth")) {
-        this->SetHeadAuth(StrToStr(element.attribute("head.auth").value()));
-        if (removeAttr) element.remove_attribute("head.auth");
+    if (pugi::xml_attribute attr = element.attribute("head.auth")) {
+        this->SetHeadAuth(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        if (removeAttr) element.remove_attribute("head.color");
+    if (pugi::xml_attribute attr = element.attribute("head.color")) {
+        this->SetHeadColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        if (removeAttr) element.remove_attribute("head.fill");
+    if (pugi::xml_attribute attr = element.attribute("head.fill")) {
+        this->SetHeadFill(StrToFill(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        if (removeAttr) element.remove_attribute("head.fillcolor");
+    if (pugi::xml_attribute attr = element.attribute("head.fillcolor")) {
+        this->SetHeadFillcolor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToNoteheadmodifier(element.attribute("head.mod").value()));
-        if (removeAttr) element.remove_attribute("head.mod");
+    if (pugi::xml_attribute attr = element.attribute("head.mod")) {
+        this->SetHeadMod(StrToNoteheadmodifier(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToRotation(element.attribute("head.rotation").value()));
-        if (removeAttr) element.remove_attribute("head.rotation");
+    if (pugi::xml_attribute attr = element.attribute("head.rotation")) {
+        this->SetHeadRotation(StrToRotation(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshape(element.attribute("head.shape").value()));
-        if (removeAttr) element.remove_attribute("head.shape");
+    if (pugi::xml_attribute attr = element.attribute("head.shape")) {
+        this->SetHeadShape(StrToHeadshape(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        if (removeAttr) element.remove_attribute("head.visible");
+    if (pugi::xml_attribute attr = element.attribute("head.visible")) {
+        this->SetHeadVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4099,9 +4099,9 @@ void AttOctave::ResetOctave()
 bool AttOctave::ReadOctave(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToOctave(element.attribute("oct").value()));
-        if (removeAttr) element.remove_attribute("oct");
+    if (pugi::xml_attribute attr = element.attribute("oct")) {
+        this->SetOct(StrToOctave(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4139,9 +4139,9 @@ void AttOctaveDefault::ResetOctaveDefault()
 bool AttOctaveDefault::ReadOctaveDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.default")) {
-        this->SetOctDefault(StrToOctave(element.attribute("oct.default").value()));
-        if (removeAttr) element.remove_attribute("oct.default");
+    if (pugi::xml_attribute attr = element.attribute("oct.default")) {
+        this->SetOctDefault(StrToOctave(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4180,14 +4180,14 @@ void AttOctaveDisplacement::ResetOctaveDisplacement()
 bool AttOctaveDisplacement::ReadOctaveDisplacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        if (removeAttr) element.remove_attribute("dis");
+    if (pugi::xml_attribute attr = element.attribute("dis")) {
+        this->SetDis(StrToOctaveDis(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToStaffrelBasic(element.attribute("dis.place").value()));
-        if (removeAttr) element.remove_attribute("dis.place");
+    if (pugi::xml_attribute attr = element.attribute("dis.place")) {
+        this->SetDisPlace(StrToStaffrelBasic(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4234,9 +4234,9 @@ void AttOneLineStaff::ResetOneLineStaff()
 bool AttOneLineStaff::ReadOneLineStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        if (removeAttr) element.remove_attribute("ontheline");
+    if (pugi::xml_attribute attr = element.attribute("ontheline")) {
+        this->SetOntheline(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4274,9 +4274,9 @@ void AttOptimization::ResetOptimization()
 bool AttOptimization::ReadOptimization(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        if (removeAttr) element.remove_attribute("optimize");
+    if (pugi::xml_attribute attr = element.attribute("optimize")) {
+        this->SetOptimize(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4314,9 +4314,9 @@ void AttOriginLayerIdent::ResetOriginLayerIdent()
 bool AttOriginLayerIdent::ReadOriginLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        if (removeAttr) element.remove_attribute("origin.layer");
+    if (pugi::xml_attribute attr = element.attribute("origin.layer")) {
+        this->SetOriginLayer(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4354,9 +4354,9 @@ void AttOriginStaffIdent::ResetOriginStaffIdent()
 bool AttOriginStaffIdent::ReadOriginStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        if (removeAttr) element.remove_attribute("origin.staff");
+    if (pugi::xml_attribute attr = element.attribute("origin.staff")) {
+        this->SetOriginStaff(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4395,14 +4395,14 @@ void AttOriginStartEndId::ResetOriginStartEndId()
 bool AttOriginStartEndId::ReadOriginStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        if (removeAttr) element.remove_attribute("origin.startid");
+    if (pugi::xml_attribute attr = element.attribute("origin.startid")) {
+        this->SetOriginStartid(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        if (removeAttr) element.remove_attribute("origin.endid");
+    if (pugi::xml_attribute attr = element.attribute("origin.endid")) {
+        this->SetOriginEndid(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4450,14 +4450,14 @@ void AttOriginTimestampLog::ResetOriginTimestampLog()
 bool AttOriginTimestampLog::ReadOriginTimestampLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        if (removeAttr) element.remove_attribute("origin.tstamp");
+    if (pugi::xml_attribute attr = element.attribute("origin.tstamp")) {
+        this->SetOriginTstamp(StrToMeasurebeat(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        if (removeAttr) element.remove_attribute("origin.tstamp2");
+    if (pugi::xml_attribute attr = element.attribute("origin.tstamp2")) {
+        this->SetOriginTstamp2(StrToMeasurebeat(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4511,44 +4511,44 @@ void AttPages::ResetPages()
 bool AttPages::ReadPages(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToMeasurementunsigned(element.attribute("page.height").value()));
-        if (removeAttr) element.remove_attribute("page.height");
+    if (pugi::xml_attribute attr = element.attribute("page.height")) {
+        this->SetPageHeight(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToMeasurementunsigned(element.attribute("page.width").value()));
-        if (removeAttr) element.remove_attribute("page.width");
+    if (pugi::xml_attribute attr = element.attribute("page.width")) {
+        this->SetPageWidth(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToMeasurementunsigned(element.attribute("page.topmar").value()));
-        if (removeAttr) element.remove_attribute("page.topmar");
+    if (pugi::xml_attribute attr = element.attribute("page.topmar")) {
+        this->SetPageTopmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToMeasurementunsigned(element.attribute("page.botmar").value()));
-        if (removeAttr) element.remove_attribute("page.botmar");
+    if (pugi::xml_attribute attr = element.attribute("page.botmar")) {
+        this->SetPageBotmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToMeasurementunsigned(element.attribute("page.leftmar").value()));
-        if (removeAttr) element.remove_attribute("page.leftmar");
+    if (pugi::xml_attribute attr = element.attribute("page.leftmar")) {
+        this->SetPageLeftmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToMeasurementunsigned(element.attribute("page.rightmar").value()));
-        if (removeAttr) element.remove_attribute("page.rightmar");
+    if (pugi::xml_attribute attr = element.attribute("page.rightmar")) {
+        this->SetPageRightmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        if (removeAttr) element.remove_attribute("page.panels");
+    if (pugi::xml_attribute attr = element.attribute("page.panels")) {
+        this->SetPagePanels(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        if (removeAttr) element.remove_attribute("page.scale");
+    if (pugi::xml_attribute attr = element.attribute("page.scale")) {
+        this->SetPageScale(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4650,14 +4650,14 @@ void AttPartIdent::ResetPartIdent()
 bool AttPartIdent::ReadPartIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("part")) {
-        this->SetPart(StrToStr(element.attribute("part").value()));
-        if (removeAttr) element.remove_attribute("part");
+    if (pugi::xml_attribute attr = element.attribute("part")) {
+        this->SetPart(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("partstaff")) {
-        this->SetPartstaff(StrToStr(element.attribute("partstaff").value()));
-        if (removeAttr) element.remove_attribute("partstaff");
+    if (pugi::xml_attribute attr = element.attribute("partstaff")) {
+        this->SetPartstaff(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4704,9 +4704,9 @@ void AttPitch::ResetPitch()
 bool AttPitch::ReadPitch(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        if (removeAttr) element.remove_attribute("pname");
+    if (pugi::xml_attribute attr = element.attribute("pname")) {
+        this->SetPname(StrToPitchname(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4744,9 +4744,9 @@ void AttPlacementOnStaff::ResetPlacementOnStaff()
 bool AttPlacementOnStaff::ReadPlacementOnStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("onstaff")) {
-        this->SetOnstaff(StrToBoolean(element.attribute("onstaff").value()));
-        if (removeAttr) element.remove_attribute("onstaff");
+    if (pugi::xml_attribute attr = element.attribute("onstaff")) {
+        this->SetOnstaff(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4784,9 +4784,9 @@ void AttPlacementRelEvent::ResetPlacementRelEvent()
 bool AttPlacementRelEvent::ReadPlacementRelEvent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToStaffrel(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4824,9 +4824,9 @@ void AttPlacementRelStaff::ResetPlacementRelStaff()
 bool AttPlacementRelStaff::ReadPlacementRelStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToStaffrel(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4864,9 +4864,9 @@ void AttPlist::ResetPlist()
 bool AttPlist::ReadPlist(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToXsdAnyURIList(element.attribute("plist").value()));
-        if (removeAttr) element.remove_attribute("plist");
+    if (pugi::xml_attribute attr = element.attribute("plist")) {
+        this->SetPlist(StrToXsdAnyURIList(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4908,29 +4908,29 @@ void AttPointing::ResetPointing()
 bool AttPointing::ReadPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        if (removeAttr) element.remove_attribute("xlink:actuate");
+    if (pugi::xml_attribute attr = element.attribute("xlink:actuate")) {
+        this->SetActuate(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        if (removeAttr) element.remove_attribute("xlink:role");
+    if (pugi::xml_attribute attr = element.attribute("xlink:role")) {
+        this->SetRole(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        if (removeAttr) element.remove_attribute("xlink:show");
+    if (pugi::xml_attribute attr = element.attribute("xlink:show")) {
+        this->SetShow(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        if (removeAttr) element.remove_attribute("target");
+    if (pugi::xml_attribute attr = element.attribute("target")) {
+        this->SetTarget(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("targettype").value()));
-        if (removeAttr) element.remove_attribute("targettype");
+    if (pugi::xml_attribute attr = element.attribute("targettype")) {
+        this->SetTargettype(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5004,9 +5004,9 @@ void AttQuantity::ResetQuantity()
 bool AttQuantity::ReadQuantity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        if (removeAttr) element.remove_attribute("quantity");
+    if (pugi::xml_attribute attr = element.attribute("quantity")) {
+        this->SetQuantity(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5048,29 +5048,29 @@ void AttRanging::ResetRanging()
 bool AttRanging::ReadRanging(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("atleast")) {
-        this->SetAtleast(StrToDbl(element.attribute("atleast").value()));
-        if (removeAttr) element.remove_attribute("atleast");
+    if (pugi::xml_attribute attr = element.attribute("atleast")) {
+        this->SetAtleast(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("atmost")) {
-        this->SetAtmost(StrToDbl(element.attribute("atmost").value()));
-        if (removeAttr) element.remove_attribute("atmost");
+    if (pugi::xml_attribute attr = element.attribute("atmost")) {
+        this->SetAtmost(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("min")) {
-        this->SetMin(StrToDbl(element.attribute("min").value()));
-        if (removeAttr) element.remove_attribute("min");
+    if (pugi::xml_attribute attr = element.attribute("min")) {
+        this->SetMin(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("max")) {
-        this->SetMax(StrToDbl(element.attribute("max").value()));
-        if (removeAttr) element.remove_attribute("max");
+    if (pugi::xml_attribute attr = element.attribute("max")) {
+        this->SetMax(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("confidence")) {
-        this->SetConfidence(StrToDbl(element.attribute("confidence").value()));
-        if (removeAttr) element.remove_attribute("confidence");
+    if (pugi::xml_attribute attr = element.attribute("confidence")) {
+        this->SetConfidence(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5144,9 +5144,9 @@ void AttRepeatMarkLog::ResetRepeatMarkLog()
 bool AttRepeatMarkLog::ReadRepeatMarkLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToRepeatMarkLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToRepeatMarkLogFunc(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5184,9 +5184,9 @@ void AttResponsibility::ResetResponsibility()
 bool AttResponsibility::ReadResponsibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        if (removeAttr) element.remove_attribute("resp");
+    if (pugi::xml_attribute attr = element.attribute("resp")) {
+        this->SetResp(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5224,9 +5224,9 @@ void AttRestdurationLog::ResetRestdurationLog()
 bool AttRestdurationLog::ReadRestdurationLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        if (removeAttr) element.remove_attribute("dur");
+    if (pugi::xml_attribute attr = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5264,9 +5264,9 @@ void AttScalable::ResetScalable()
 bool AttScalable::ReadScalable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        if (removeAttr) element.remove_attribute("scale");
+    if (pugi::xml_attribute attr = element.attribute("scale")) {
+        this->SetScale(StrToPercent(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5304,9 +5304,9 @@ void AttSequence::ResetSequence()
 bool AttSequence::ReadSequence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        if (removeAttr) element.remove_attribute("seq");
+    if (pugi::xml_attribute attr = element.attribute("seq")) {
+        this->SetSeq(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5344,9 +5344,9 @@ void AttSlashCount::ResetSlashCount()
 bool AttSlashCount::ReadSlashCount(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
+    if (pugi::xml_attribute attr = element.attribute("slash")) {
+        this->SetSlash(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5384,9 +5384,9 @@ void AttSlurPresent::ResetSlurPresent()
 bool AttSlurPresent::ReadSlurPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        if (removeAttr) element.remove_attribute("slur");
+    if (pugi::xml_attribute attr = element.attribute("slur")) {
+        this->SetSlur(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5424,9 +5424,9 @@ void AttSource::ResetSource()
 bool AttSource::ReadSource(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        if (removeAttr) element.remove_attribute("source");
+    if (pugi::xml_attribute attr = element.attribute("source")) {
+        this->SetSource(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5467,24 +5467,24 @@ void AttSpacing::ResetSpacing()
 bool AttSpacing::ReadSpacing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        if (removeAttr) element.remove_attribute("spacing.packexp");
+    if (pugi::xml_attribute attr = element.attribute("spacing.packexp")) {
+        this->SetSpacingPackexp(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        if (removeAttr) element.remove_attribute("spacing.packfact");
+    if (pugi::xml_attribute attr = element.attribute("spacing.packfact")) {
+        this->SetSpacingPackfact(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToMeasurementsigned(element.attribute("spacing.staff").value()));
-        if (removeAttr) element.remove_attribute("spacing.staff");
+    if (pugi::xml_attribute attr = element.attribute("spacing.staff")) {
+        this->SetSpacingStaff(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToMeasurementsigned(element.attribute("spacing.system").value()));
-        if (removeAttr) element.remove_attribute("spacing.system");
+    if (pugi::xml_attribute attr = element.attribute("spacing.system")) {
+        this->SetSpacingSystem(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5549,9 +5549,9 @@ void AttStaffLog::ResetStaffLog()
 bool AttStaffLog::ReadStaffLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        if (removeAttr) element.remove_attribute("def");
+    if (pugi::xml_attribute attr = element.attribute("def")) {
+        this->SetDef(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5589,9 +5589,9 @@ void AttStaffDefLog::ResetStaffDefLog()
 bool AttStaffDefLog::ReadStaffDefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        if (removeAttr) element.remove_attribute("lines");
+    if (pugi::xml_attribute attr = element.attribute("lines")) {
+        this->SetLines(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5629,9 +5629,9 @@ void AttStaffGroupingSym::ResetStaffGroupingSym()
 bool AttStaffGroupingSym::ReadStaffGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffGroupingSymSymbol(element.attribute("symbol").value()));
-        if (removeAttr) element.remove_attribute("symbol");
+    if (pugi::xml_attribute attr = element.attribute("symbol")) {
+        this->SetSymbol(StrToStaffGroupingSymSymbol(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5669,9 +5669,9 @@ void AttStaffIdent::ResetStaffIdent()
 bool AttStaffIdent::ReadStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        if (removeAttr) element.remove_attribute("staff");
+    if (pugi::xml_attribute attr = element.attribute("staff")) {
+        this->SetStaff(StrToXsdPositiveIntegerList(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5711,19 +5711,19 @@ void AttStaffItems::ResetStaffItems()
 bool AttStaffItems::ReadStaffItems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("aboveorder")) {
-        this->SetAboveorder(StrToStaffitem(element.attribute("aboveorder").value()));
-        if (removeAttr) element.remove_attribute("aboveorder");
+    if (pugi::xml_attribute attr = element.attribute("aboveorder")) {
+        this->SetAboveorder(StrToStaffitem(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beloworder")) {
-        this->SetBeloworder(StrToStaffitem(element.attribute("beloworder").value()));
-        if (removeAttr) element.remove_attribute("beloworder");
+    if (pugi::xml_attribute attr = element.attribute("beloworder")) {
+        this->SetBeloworder(StrToStaffitem(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("betweenorder")) {
-        this->SetBetweenorder(StrToStaffitem(element.attribute("betweenorder").value()));
-        if (removeAttr) element.remove_attribute("betweenorder");
+    if (pugi::xml_attribute attr = element.attribute("betweenorder")) {
+        this->SetBetweenorder(StrToStaffitem(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5779,9 +5779,9 @@ void AttStaffLoc::ResetStaffLoc()
 bool AttStaffLoc::ReadStaffLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        if (removeAttr) element.remove_attribute("loc");
+    if (pugi::xml_attribute attr = element.attribute("loc")) {
+        this->SetLoc(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5820,14 +5820,14 @@ void AttStaffLocPitched::ResetStaffLocPitched()
 bool AttStaffLocPitched::ReadStaffLocPitched(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        if (removeAttr) element.remove_attribute("ploc");
+    if (pugi::xml_attribute attr = element.attribute("ploc")) {
+        this->SetPloc(StrToPitchname(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToOctave(element.attribute("oloc").value()));
-        if (removeAttr) element.remove_attribute("oloc");
+    if (pugi::xml_attribute attr = element.attribute("oloc")) {
+        this->SetOloc(StrToOctave(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5874,9 +5874,9 @@ void AttStartEndId::ResetStartEndId()
 bool AttStartEndId::ReadStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        if (removeAttr) element.remove_attribute("endid");
+    if (pugi::xml_attribute attr = element.attribute("endid")) {
+        this->SetEndid(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5914,9 +5914,9 @@ void AttStartId::ResetStartId()
 bool AttStartId::ReadStartId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        if (removeAttr) element.remove_attribute("startid");
+    if (pugi::xml_attribute attr = element.attribute("startid")) {
+        this->SetStartid(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5961,44 +5961,44 @@ void AttStems::ResetStems()
 bool AttStems::ReadStems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        if (removeAttr) element.remove_attribute("stem.dir");
+    if (pugi::xml_attribute attr = element.attribute("stem.dir")) {
+        this->SetStemDir(StrToStemdirection(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToDbl(element.attribute("stem.len").value()));
-        if (removeAttr) element.remove_attribute("stem.len");
+    if (pugi::xml_attribute attr = element.attribute("stem.len")) {
+        this->SetStemLen(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        if (removeAttr) element.remove_attribute("stem.mod");
+    if (pugi::xml_attribute attr = element.attribute("stem.mod")) {
+        this->SetStemMod(StrToStemmodifier(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        if (removeAttr) element.remove_attribute("stem.pos");
+    if (pugi::xml_attribute attr = element.attribute("stem.pos")) {
+        this->SetStemPos(StrToStemposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.sameas")) {
-        this->SetStemSameas(StrToStr(element.attribute("stem.sameas").value()));
-        if (removeAttr) element.remove_attribute("stem.sameas");
+    if (pugi::xml_attribute attr = element.attribute("stem.sameas")) {
+        this->SetStemSameas(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.visible")) {
-        this->SetStemVisible(StrToBoolean(element.attribute("stem.visible").value()));
-        if (removeAttr) element.remove_attribute("stem.visible");
+    if (pugi::xml_attribute attr = element.attribute("stem.visible")) {
+        this->SetStemVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        if (removeAttr) element.remove_attribute("stem.x");
+    if (pugi::xml_attribute attr = element.attribute("stem.x")) {
+        this->SetStemX(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        if (removeAttr) element.remove_attribute("stem.y");
+    if (pugi::xml_attribute attr = element.attribute("stem.y")) {
+        this->SetStemY(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6100,14 +6100,14 @@ void AttSylLog::ResetSylLog()
 bool AttSylLog::ReadSylLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        if (removeAttr) element.remove_attribute("con");
+    if (pugi::xml_attribute attr = element.attribute("con")) {
+        this->SetCon(StrToSylLogCon(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        if (removeAttr) element.remove_attribute("wordpos");
+    if (pugi::xml_attribute attr = element.attribute("wordpos")) {
+        this->SetWordpos(StrToSylLogWordpos(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6154,9 +6154,9 @@ void AttSylText::ResetSylText()
 bool AttSylText::ReadSylText(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        if (removeAttr) element.remove_attribute("syl");
+    if (pugi::xml_attribute attr = element.attribute("syl")) {
+        this->SetSyl(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6197,24 +6197,24 @@ void AttSystems::ResetSystems()
 bool AttSystems::ReadSystems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        if (removeAttr) element.remove_attribute("system.leftline");
+    if (pugi::xml_attribute attr = element.attribute("system.leftline")) {
+        this->SetSystemLeftline(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToMeasurementunsigned(element.attribute("system.leftmar").value()));
-        if (removeAttr) element.remove_attribute("system.leftmar");
+    if (pugi::xml_attribute attr = element.attribute("system.leftmar")) {
+        this->SetSystemLeftmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToMeasurementunsigned(element.attribute("system.rightmar").value()));
-        if (removeAttr) element.remove_attribute("system.rightmar");
+    if (pugi::xml_attribute attr = element.attribute("system.rightmar")) {
+        this->SetSystemRightmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToMeasurementunsigned(element.attribute("system.topmar").value()));
-        if (removeAttr) element.remove_attribute("system.topmar");
+    if (pugi::xml_attribute attr = element.attribute("system.topmar")) {
+        this->SetSystemTopmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6279,9 +6279,9 @@ void AttTargetEval::ResetTargetEval()
 bool AttTargetEval::ReadTargetEval(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetEvalEvaluate(element.attribute("evaluate").value()));
-        if (removeAttr) element.remove_attribute("evaluate");
+    if (pugi::xml_attribute attr = element.attribute("evaluate")) {
+        this->SetEvaluate(StrToTargetEvalEvaluate(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6319,9 +6319,9 @@ void AttTempoLog::ResetTempoLog()
 bool AttTempoLog::ReadTempoLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToTempoLogFunc(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6360,14 +6360,14 @@ void AttTextRendition::ResetTextRendition()
 bool AttTextRendition::ReadTextRendition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altrend")) {
-        this->SetAltrend(StrToStr(element.attribute("altrend").value()));
-        if (removeAttr) element.remove_attribute("altrend");
+    if (pugi::xml_attribute attr = element.attribute("altrend")) {
+        this->SetAltrend(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rend")) {
-        this->SetRend(StrToTextrendition(element.attribute("rend").value()));
-        if (removeAttr) element.remove_attribute("rend");
+    if (pugi::xml_attribute attr = element.attribute("rend")) {
+        this->SetRend(StrToTextrendition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6418,29 +6418,29 @@ void AttTextStyle::ResetTextStyle()
 bool AttTextStyle::ReadTextStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        if (removeAttr) element.remove_attribute("text.fam");
+    if (pugi::xml_attribute attr = element.attribute("text.fam")) {
+        this->SetTextFam(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        if (removeAttr) element.remove_attribute("text.name");
+    if (pugi::xml_attribute attr = element.attribute("text.name")) {
+        this->SetTextName(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToFontsize(element.attribute("text.size").value()));
-        if (removeAttr) element.remove_attribute("text.size");
+    if (pugi::xml_attribute attr = element.attribute("text.size")) {
+        this->SetTextSize(StrToFontsize(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        if (removeAttr) element.remove_attribute("text.style");
+    if (pugi::xml_attribute attr = element.attribute("text.style")) {
+        this->SetTextStyle(StrToFontstyle(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        if (removeAttr) element.remove_attribute("text.weight");
+    if (pugi::xml_attribute attr = element.attribute("text.weight")) {
+        this->SetTextWeight(StrToFontweight(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6514,9 +6514,9 @@ void AttTiePresent::ResetTiePresent()
 bool AttTiePresent::ReadTiePresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        if (removeAttr) element.remove_attribute("tie");
+    if (pugi::xml_attribute attr = element.attribute("tie")) {
+        this->SetTie(StrToTie(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6554,9 +6554,9 @@ void AttTimestampLog::ResetTimestampLog()
 bool AttTimestampLog::ReadTimestampLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        if (removeAttr) element.remove_attribute("tstamp");
+    if (pugi::xml_attribute attr = element.attribute("tstamp")) {
+        this->SetTstamp(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6594,9 +6594,9 @@ void AttTimestamp2Log::ResetTimestamp2Log()
 bool AttTimestamp2Log::ReadTimestamp2Log(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        if (removeAttr) element.remove_attribute("tstamp2");
+    if (pugi::xml_attribute attr = element.attribute("tstamp2")) {
+        this->SetTstamp2(StrToMeasurebeat(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6635,14 +6635,14 @@ void AttTransposition::ResetTransposition()
 bool AttTransposition::ReadTransposition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToInt(element.attribute("trans.diat").value()));
-        if (removeAttr) element.remove_attribute("trans.diat");
+    if (pugi::xml_attribute attr = element.attribute("trans.diat")) {
+        this->SetTransDiat(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToInt(element.attribute("trans.semi").value()));
-        if (removeAttr) element.remove_attribute("trans.semi");
+    if (pugi::xml_attribute attr = element.attribute("trans.semi")) {
+        this->SetTransSemi(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6691,19 +6691,19 @@ void AttTuning::ResetTuning()
 bool AttTuning::ReadTuning(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        if (removeAttr) element.remove_attribute("tune.Hz");
+    if (pugi::xml_attribute attr = element.attribute("tune.Hz")) {
+        this->SetTuneHz(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        if (removeAttr) element.remove_attribute("tune.pname");
+    if (pugi::xml_attribute attr = element.attribute("tune.pname")) {
+        this->SetTunePname(StrToPitchname(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        if (removeAttr) element.remove_attribute("tune.temper");
+    if (pugi::xml_attribute attr = element.attribute("tune.temper")) {
+        this->SetTuneTemper(StrToTemperament(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6759,9 +6759,9 @@ void AttTupletPresent::ResetTupletPresent()
 bool AttTupletPresent::ReadTupletPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        if (removeAttr) element.remove_attribute("tuplet");
+    if (pugi::xml_attribute attr = element.attribute("tuplet")) {
+        this->SetTuplet(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6799,9 +6799,9 @@ void AttTyped::ResetTyped()
 bool AttTyped::ReadTyped(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        if (removeAttr) element.remove_attribute("type");
+    if (pugi::xml_attribute attr = element.attribute("type")) {
+        this->SetType(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6845,39 +6845,39 @@ void AttTypography::ResetTypography()
 bool AttTypography::ReadTypography(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        if (removeAttr) element.remove_attribute("fontfam");
+    if (pugi::xml_attribute attr = element.attribute("fontfam")) {
+        this->SetFontfam(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        if (removeAttr) element.remove_attribute("fontname");
+    if (pugi::xml_attribute attr = element.attribute("fontname")) {
+        this->SetFontname(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToFontsize(element.attribute("fontsize").value()));
-        if (removeAttr) element.remove_attribute("fontsize");
+    if (pugi::xml_attribute attr = element.attribute("fontsize")) {
+        this->SetFontsize(StrToFontsize(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        if (removeAttr) element.remove_attribute("fontstyle");
+    if (pugi::xml_attribute attr = element.attribute("fontstyle")) {
+        this->SetFontstyle(StrToFontstyle(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        if (removeAttr) element.remove_attribute("fontweight");
+    if (pugi::xml_attribute attr = element.attribute("fontweight")) {
+        this->SetFontweight(StrToFontweight(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("letterspacing")) {
-        this->SetLetterspacing(StrToDbl(element.attribute("letterspacing").value()));
-        if (removeAttr) element.remove_attribute("letterspacing");
+    if (pugi::xml_attribute attr = element.attribute("letterspacing")) {
+        this->SetLetterspacing(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lineheight")) {
-        this->SetLineheight(StrToStr(element.attribute("lineheight").value()));
-        if (removeAttr) element.remove_attribute("lineheight");
+    if (pugi::xml_attribute attr = element.attribute("lineheight")) {
+        this->SetLineheight(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6969,9 +6969,9 @@ void AttVerticalAlign::ResetVerticalAlign()
 bool AttVerticalAlign::ReadVerticalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("valign")) {
-        this->SetValign(StrToVerticalalignment(element.attribute("valign").value()));
-        if (removeAttr) element.remove_attribute("valign");
+    if (pugi::xml_attribute attr = element.attribute("valign")) {
+        this->SetValign(StrToVerticalalignment(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7009,9 +7009,9 @@ void AttVerticalGroup::ResetVerticalGroup()
 bool AttVerticalGroup::ReadVerticalGroup(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vgrp")) {
-        this->SetVgrp(StrToInt(element.attribute("vgrp").value()));
-        if (removeAttr) element.remove_attribute("vgrp");
+    if (pugi::xml_attribute attr = element.attribute("vgrp")) {
+        this->SetVgrp(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7049,9 +7049,9 @@ void AttVisibility::ResetVisibility()
 bool AttVisibility::ReadVisibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        if (removeAttr) element.remove_attribute("visible");
+    if (pugi::xml_attribute attr = element.attribute("visible")) {
+        this->SetVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7089,9 +7089,9 @@ void AttVisualOffsetHo::ResetVisualOffsetHo()
 bool AttVisualOffsetHo::ReadVisualOffsetHo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToMeasurementsigned(element.attribute("ho").value()));
-        if (removeAttr) element.remove_attribute("ho");
+    if (pugi::xml_attribute attr = element.attribute("ho")) {
+        this->SetHo(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7129,9 +7129,9 @@ void AttVisualOffsetTo::ResetVisualOffsetTo()
 bool AttVisualOffsetTo::ReadVisualOffsetTo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        if (removeAttr) element.remove_attribute("to");
+    if (pugi::xml_attribute attr = element.attribute("to")) {
+        this->SetTo(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7169,9 +7169,9 @@ void AttVisualOffsetVo::ResetVisualOffsetVo()
 bool AttVisualOffsetVo::ReadVisualOffsetVo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToMeasurementsigned(element.attribute("vo").value()));
-        if (removeAttr) element.remove_attribute("vo");
+    if (pugi::xml_attribute attr = element.attribute("vo")) {
+        this->SetVo(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7210,14 +7210,14 @@ void AttVisualOffset2Ho::ResetVisualOffset2Ho()
 bool AttVisualOffset2Ho::ReadVisualOffset2Ho(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToMeasurementsigned(element.attribute("startho").value()));
-        if (removeAttr) element.remove_attribute("startho");
+    if (pugi::xml_attribute attr = element.attribute("startho")) {
+        this->SetStartho(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToMeasurementsigned(element.attribute("endho").value()));
-        if (removeAttr) element.remove_attribute("endho");
+    if (pugi::xml_attribute attr = element.attribute("endho")) {
+        this->SetEndho(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7265,14 +7265,14 @@ void AttVisualOffset2To::ResetVisualOffset2To()
 bool AttVisualOffset2To::ReadVisualOffset2To(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        if (removeAttr) element.remove_attribute("startto");
+    if (pugi::xml_attribute attr = element.attribute("startto")) {
+        this->SetStartto(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        if (removeAttr) element.remove_attribute("endto");
+    if (pugi::xml_attribute attr = element.attribute("endto")) {
+        this->SetEndto(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7320,14 +7320,14 @@ void AttVisualOffset2Vo::ResetVisualOffset2Vo()
 bool AttVisualOffset2Vo::ReadVisualOffset2Vo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToMeasurementsigned(element.attribute("startvo").value()));
-        if (removeAttr) element.remove_attribute("startvo");
+    if (pugi::xml_attribute attr = element.attribute("startvo")) {
+        this->SetStartvo(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToMeasurementsigned(element.attribute("endvo").value()));
-        if (removeAttr) element.remove_attribute("endvo");
+    if (pugi::xml_attribute attr = element.attribute("endvo")) {
+        this->SetEndvo(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7374,9 +7374,9 @@ void AttVoltaGroupingSym::ResetVoltaGroupingSym()
 bool AttVoltaGroupingSym::ReadVoltaGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("voltasym")) {
-        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(element.attribute("voltasym").value()));
-        if (removeAttr) element.remove_attribute("voltasym");
+    if (pugi::xml_attribute attr = element.attribute("voltasym")) {
+        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7414,9 +7414,9 @@ void AttWhitespace::ResetWhitespace()
 bool AttWhitespace::ReadWhitespace(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        if (removeAttr) element.remove_attribute("xml:space");
+    if (pugi::xml_attribute attr = element.attribute("xml:space")) {
+        this->SetSpace(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7454,9 +7454,9 @@ void AttWidth::ResetWidth()
 bool AttWidth::ReadWidth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToMeasurementunsigned(element.attribute("width").value()));
-        if (removeAttr) element.remove_attribute("width");
+    if (pugi::xml_attribute attr = element.attribute("width")) {
+        this->SetWidth(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7495,14 +7495,14 @@ void AttXy::ResetXy()
 bool AttXy::ReadXy(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        if (removeAttr) element.remove_attribute("x");
+    if (pugi::xml_attribute attr = element.attribute("x")) {
+        this->SetX(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        if (removeAttr) element.remove_attribute("y");
+    if (pugi::xml_attribute attr = element.attribute("y")) {
+        this->SetY(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7550,14 +7550,14 @@ void AttXy2::ResetXy2()
 bool AttXy2::ReadXy2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        if (removeAttr) element.remove_attribute("x2");
+    if (pugi::xml_attribute attr = element.attribute("x2")) {
+        this->SetX2(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        if (removeAttr) element.remove_attribute("y2");
+    if (pugi::xml_attribute attr = element.attribute("y2")) {
+        this->SetY2(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
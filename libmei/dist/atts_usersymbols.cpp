@@ -39,9 +39,9 @@ void AttAltSym::ResetAltSym()
 bool AttAltSym::ReadAltSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altsym")) {
-        this->SetAltsym(StrToStr(element.attribute("altsym").value()));
-        if (removeAttr) element.remove_attribute("altsym");
+    if (pugi::xml_attribute attr = element.attribute("altsym")) {
+        this->SetAltsym(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +79,9 @@ void AttAnchoredTextLog::ResetAnchoredTextLog()
 bool AttAnchoredTextLog::ReadAnchoredTextLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -119,9 +119,9 @@ void AttCurveLog::ResetCurveLog()
 bool AttCurveLog::ReadCurveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -159,9 +159,9 @@ void AttLineLog::ResetLineLog()
 bool AttLineLog::ReadLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
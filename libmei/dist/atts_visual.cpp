@@ -39,9 +39,9 @@ void AttAnnotVis::ResetAnnotVis()
 bool AttAnnotVis::ReadAnnotVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToPlacement(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToPlacement(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -83,29 +83,29 @@ void AttArpegVis::ResetArpegVis()
 bool AttArpegVis::ReadArpegVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        if (removeAttr) element.remove_attribute("arrow");
+    if (pugi::xml_attribute attr = element.attribute("arrow")) {
+        this->SetArrow(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.shape")) {
-        this->SetArrowShape(StrToLinestartendsymbol(element.attribute("arrow.shape").value()));
-        if (removeAttr) element.remove_attribute("arrow.shape");
+    if (pugi::xml_attribute attr = element.attribute("arrow.shape")) {
+        this->SetArrowShape(StrToLinestartendsymbol(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.size")) {
-        this->SetArrowSize(StrToInt(element.attribute("arrow.size").value()));
-        if (removeAttr) element.remove_attribute("arrow.size");
+    if (pugi::xml_attribute attr = element.attribute("arrow.size")) {
+        this->SetArrowSize(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.color")) {
-        this->SetArrowColor(StrToStr(element.attribute("arrow.color").value()));
-        if (removeAttr) element.remove_attribute("arrow.color");
+    if (pugi::xml_attribute attr = element.attribute("arrow.color")) {
+        this->SetArrowColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.fillcolor")) {
-        this->SetArrowFillcolor(StrToStr(element.attribute("arrow.fillcolor").value()));
-        if (removeAttr) element.remove_attribute("arrow.fillcolor");
+    if (pugi::xml_attribute attr = element.attribute("arrow.fillcolor")) {
+        this->SetArrowFillcolor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -181,19 +181,19 @@ void AttBarLineVis::ResetBarLineVis()
 bool AttBarLineVis::ReadBarLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("len")) {
-        this->SetLen(StrToDbl(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
+    if (pugi::xml_attribute attr = element.attribute("len")) {
+        this->SetLen(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("method")) {
-        this->SetMethod(StrToBarmethod(element.attribute("method").value()));
-        if (removeAttr) element.remove_attribute("method");
+    if (pugi::xml_attribute attr = element.attribute("method")) {
+        this->SetMethod(StrToBarmethod(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToInt(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -251,19 +251,19 @@ void AttBeamingVis::ResetBeamingVis()
 bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        if (removeAttr) element.remove_attribute("beam.color");
+    if (pugi::xml_attribute attr = element.attribute("beam.color")) {
+        this->SetBeamColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        if (removeAttr) element.remove_attribute("beam.rend");
+    if (pugi::xml_attribute attr = element.attribute("beam.rend")) {
+        this->SetBeamRend(StrToBeamingVisBeamrend(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        if (removeAttr) element.remove_attribute("beam.slope");
+    if (pugi::xml_attribute attr = element.attribute("beam.slope")) {
+        this->SetBeamSlope(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -319,9 +319,9 @@ void AttBeatRptVis::ResetBeatRptVis()
 bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBeatrptRend(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
+    if (pugi::xml_attribute attr = element.attribute("slash")) {
+        this->SetSlash(StrToBeatrptRend(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -359,9 +359,9 @@ void AttChordVis::ResetChordVis()
 bool AttChordVis::ReadChordVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        if (removeAttr) element.remove_attribute("cluster");
+    if (pugi::xml_attribute attr = element.attribute("cluster")) {
+        this->SetCluster(StrToCluster(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -400,14 +400,14 @@ void AttCleffingVis::ResetCleffingVis()
 bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        if (removeAttr) element.remove_attribute("clef.color");
+    if (pugi::xml_attribute attr = element.attribute("clef.color")) {
+        this->SetClefColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        if (removeAttr) element.remove_attribute("clef.visible");
+    if (pugi::xml_attribute attr = element.attribute("clef.visible")) {
+        this->SetClefVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -454,9 +454,9 @@ void AttCurvatureDirection::ResetCurvatureDirection()
 bool AttCurvatureDirection::ReadCurvatureDirection(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToCurvatureDirectionCurve(element.attribute("curve").value()));
-        if (removeAttr) element.remove_attribute("curve");
+    if (pugi::xml_attribute attr = element.attribute("curve")) {
+        this->SetCurve(StrToCurvatureDirectionCurve(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -495,14 +495,14 @@ void AttEpisemaVis::ResetEpisemaVis()
 bool AttEpisemaVis::ReadEpisemaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToEpisemaVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToEpisemaVisForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToEventrel(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -551,19 +551,19 @@ void AttFTremVis::ResetFTremVis()
 bool AttFTremVis::ReadFTremVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beams")) {
-        this->SetBeams(StrToInt(element.attribute("beams").value()));
-        if (removeAttr) element.remove_attribute("beams");
+    if (pugi::xml_attribute attr = element.attribute("beams")) {
+        this->SetBeams(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beams.float")) {
-        this->SetBeamsFloat(StrToInt(element.attribute("beams.float").value()));
-        if (removeAttr) element.remove_attribute("beams.float");
+    if (pugi::xml_attribute attr = element.attribute("beams.float")) {
+        this->SetBeamsFloat(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("float.gap")) {
-        this->SetFloatGap(StrToMeasurementunsigned(element.attribute("float.gap").value()));
-        if (removeAttr) element.remove_attribute("float.gap");
+    if (pugi::xml_attribute attr = element.attribute("float.gap")) {
+        this->SetFloatGap(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -620,14 +620,14 @@ void AttFermataVis::ResetFermataVis()
 bool AttFermataVis::ReadFermataVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToFermataVisForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        if (removeAttr) element.remove_attribute("shape");
+    if (pugi::xml_attribute attr = element.attribute("shape")) {
+        this->SetShape(StrToFermataVisShape(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -674,9 +674,9 @@ void AttFingGrpVis::ResetFingGrpVis()
 bool AttFingGrpVis::ReadFingGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToFingGrpVisOrient(element.attribute("orient").value()));
-        if (removeAttr) element.remove_attribute("orient");
+    if (pugi::xml_attribute attr = element.attribute("orient")) {
+        this->SetOrient(StrToFingGrpVisOrient(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -714,9 +714,9 @@ void AttGuitarGridVis::ResetGuitarGridVis()
 bool AttGuitarGridVis::ReadGuitarGridVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        if (removeAttr) element.remove_attribute("grid.show");
+    if (pugi::xml_attribute attr = element.attribute("grid.show")) {
+        this->SetGridShow(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -757,24 +757,24 @@ void AttHairpinVis::ResetHairpinVis()
 bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToMeasurementunsigned(element.attribute("opening").value()));
-        if (removeAttr) element.remove_attribute("opening");
+    if (pugi::xml_attribute attr = element.attribute("opening")) {
+        this->SetOpening(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("closed")) {
-        this->SetClosed(StrToBoolean(element.attribute("closed").value()));
-        if (removeAttr) element.remove_attribute("closed");
+    if (pugi::xml_attribute attr = element.attribute("closed")) {
+        this->SetClosed(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("opening.vertical")) {
-        this->SetOpeningVertical(StrToBoolean(element.attribute("opening.vertical").value()));
-        if (removeAttr) element.remove_attribute("opening.vertical");
+    if (pugi::xml_attribute attr = element.attribute("opening.vertical")) {
+        this->SetOpeningVertical(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("angle.optimize")) {
-        this->SetAngleOptimize(StrToBoolean(element.attribute("angle.optimize").value()));
-        if (removeAttr) element.remove_attribute("angle.optimize");
+    if (pugi::xml_attribute attr = element.attribute("angle.optimize")) {
+        this->SetAngleOptimize(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -839,9 +839,9 @@ void AttHarmVis::ResetHarmVis()
 bool AttHarmVis::ReadHarmVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        if (removeAttr) element.remove_attribute("rendgrid");
+    if (pugi::xml_attribute attr = element.attribute("rendgrid")) {
+        this->SetRendgrid(StrToHarmVisRendgrid(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -880,14 +880,14 @@ void AttHispanTickVis::ResetHispanTickVis()
 bool AttHispanTickVis::ReadHispanTickVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToEventrel(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        if (removeAttr) element.remove_attribute("tilt");
+    if (pugi::xml_attribute attr = element.attribute("tilt")) {
+        this->SetTilt(StrToCompassdirection(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -934,9 +934,9 @@ void AttKeySigVis::ResetKeySigVis()
 bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cancelaccid")) {
-        this->SetCancelaccid(StrToCancelaccid(element.attribute("cancelaccid").value()));
-        if (removeAttr) element.remove_attribute("cancelaccid");
+    if (pugi::xml_attribute attr = element.attribute("cancelaccid")) {
+        this->SetCancelaccid(StrToCancelaccid(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -975,14 +975,14 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
 bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("keysig.cancelaccid")) {
-        this->SetKeysigCancelaccid(StrToCancelaccid(element.attribute("keysig.cancelaccid").value()));
-        if (removeAttr) element.remove_attribute("keysig.cancelaccid");
+    if (pugi::xml_attribute attr = element.attribute("keysig.cancelaccid")) {
+        this->SetKeysigCancelaccid(StrToCancelaccid(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("keysig.visible")) {
-        this->SetKeysigVisible(StrToBoolean(element.attribute("keysig.visible").value()));
-        if (removeAttr) element.remove_attribute("keysig.visible");
+    if (pugi::xml_attribute attr = element.attribute("keysig.visible")) {
+        this->SetKeysigVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1029,9 +1029,9 @@ void AttLigatureVis::ResetLigatureVis()
 bool AttLigatureVis::ReadLigatureVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToLigatureform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1074,34 +1074,34 @@ void AttLineVis::ResetLineVis()
 bool AttLineVis::ReadLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToLineform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToLinewidth(element.attribute("width").value()));
-        if (removeAttr) element.remove_attribute("width");
+    if (pugi::xml_attribute attr = element.attribute("width")) {
+        this->SetWidth(StrToLinewidth(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        if (removeAttr) element.remove_attribute("endsym");
+    if (pugi::xml_attribute attr = element.attribute("endsym")) {
+        this->SetEndsym(StrToLinestartendsymbol(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endsym.size")) {
-        this->SetEndsymSize(StrToInt(element.attribute("endsym.size").value()));
-        if (removeAttr) element.remove_attribute("endsym.size");
+    if (pugi::xml_attribute attr = element.attribute("endsym.size")) {
+        this->SetEndsymSize(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        if (removeAttr) element.remove_attribute("startsym");
+    if (pugi::xml_attribute attr = element.attribute("startsym")) {
+        this->SetStartsym(StrToLinestartendsymbol(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("startsym.size")) {
-        this->SetStartsymSize(StrToInt(element.attribute("startsym.size").value()));
-        if (removeAttr) element.remove_attribute("startsym.size");
+    if (pugi::xml_attribute attr = element.attribute("startsym.size")) {
+        this->SetStartsymSize(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1184,9 +1184,9 @@ void AttLiquescentVis::ResetLiquescentVis()
 bool AttLiquescentVis::ReadLiquescentVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("looped")) {
-        this->SetLooped(StrToBoolean(element.attribute("looped").value()));
-        if (removeAttr) element.remove_attribute("looped");
+    if (pugi::xml_attribute attr = element.attribute("looped")) {
+        this->SetLooped(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1227,24 +1227,24 @@ void AttMensurVis::ResetMensurVis()
 bool AttMensurVis::ReadMensurVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        if (removeAttr) element.remove_attribute("dot");
+    if (pugi::xml_attribute attr = element.attribute("dot")) {
+        this->SetDot(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToMensurVisForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        if (removeAttr) element.remove_attribute("orient");
+    if (pugi::xml_attribute attr = element.attribute("orient")) {
+        this->SetOrient(StrToOrientation(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        if (removeAttr) element.remove_attribute("sign");
+    if (pugi::xml_attribute attr = element.attribute("sign")) {
+        this->SetSign(StrToMensurationsign(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1316,44 +1316,44 @@ void AttMensuralVis::ResetMensuralVis()
 bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        if (removeAttr) element.remove_attribute("mensur.color");
+    if (pugi::xml_attribute attr = element.attribute("mensur.color")) {
+        this->SetMensurColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        if (removeAttr) element.remove_attribute("mensur.dot");
+    if (pugi::xml_attribute attr = element.attribute("mensur.dot")) {
+        this->SetMensurDot(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        if (removeAttr) element.remove_attribute("mensur.form");
+    if (pugi::xml_attribute attr = element.attribute("mensur.form")) {
+        this->SetMensurForm(StrToMensuralVisMensurform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        if (removeAttr) element.remove_attribute("mensur.loc");
+    if (pugi::xml_attribute attr = element.attribute("mensur.loc")) {
+        this->SetMensurLoc(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        if (removeAttr) element.remove_attribute("mensur.orient");
+    if (pugi::xml_attribute attr = element.attribute("mensur.orient")) {
+        this->SetMensurOrient(StrToOrientation(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        if (removeAttr) element.remove_attribute("mensur.sign");
+    if (pugi::xml_attribute attr = element.attribute("mensur.sign")) {
+        this->SetMensurSign(StrToMensurationsign(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToFontsize(element.attribute("mensur.size").value()));
-        if (removeAttr) element.remove_attribute("mensur.size");
+    if (pugi::xml_attribute attr = element.attribute("mensur.size")) {
+        this->SetMensurSize(StrToFontsize(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        if (removeAttr) element.remove_attribute("mensur.slash");
+    if (pugi::xml_attribute attr = element.attribute("mensur.slash")) {
+        this->SetMensurSlash(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1454,9 +1454,9 @@ void AttMeterSigVis::ResetMeterSigVis()
 bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterform(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToMeterform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1496,19 +1496,19 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
 bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.form")) {
-        this->SetMeterForm(StrToMeterform(element.attribute("meter.form").value()));
-        if (removeAttr) element.remove_attribute("meter.form");
+    if (pugi::xml_attribute attr = element.attribute("meter.form")) {
+        this->SetMeterForm(StrToMeterform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        if (removeAttr) element.remove_attribute("meter.showchange");
+    if (pugi::xml_attribute attr = element.attribute("meter.showchange")) {
+        this->SetMeterShowchange(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.visible")) {
-        this->SetMeterVisible(StrToBoolean(element.attribute("meter.visible").value()));
-        if (removeAttr) element.remove_attribute("meter.visible");
+    if (pugi::xml_attribute attr = element.attribute("meter.visible")) {
+        this->SetMeterVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1564,9 +1564,9 @@ void AttMultiRestVis::ResetMultiRestVis()
 bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        if (removeAttr) element.remove_attribute("block");
+    if (pugi::xml_attribute attr = element.attribute("block")) {
+        this->SetBlock(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1604,9 +1604,9 @@ void AttPbVis::ResetPbVis()
 bool AttPbVis::ReadPbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        if (removeAttr) element.remove_attribute("folium");
+    if (pugi::xml_attribute attr = element.attribute("folium")) {
+        this->SetFolium(StrToPbVisFolium(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1644,9 +1644,9 @@ void AttPedalVis::ResetPedalVis()
 bool AttPedalVis::ReadPedalVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalstyle(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToPedalstyle(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1685,14 +1685,14 @@ void AttPlicaVis::ResetPlicaVis()
 bool AttPlicaVis::ReadPlicaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToStemdirectionBasic(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
+    if (pugi::xml_attribute attr = element.attribute("dir")) {
+        this->SetDir(StrToStemdirectionBasic(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("len")) {
-        this->SetLen(StrToMeasurementunsigned(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
+    if (pugi::xml_attribute attr = element.attribute("len")) {
+        this->SetLen(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1739,9 +1739,9 @@ void AttQuilismaVis::ResetQuilismaVis()
 bool AttQuilismaVis::ReadQuilismaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("waves")) {
-        this->SetWaves(StrToInt(element.attribute("waves").value()));
-        if (removeAttr) element.remove_attribute("waves");
+    if (pugi::xml_attribute attr = element.attribute("waves")) {
+        this->SetWaves(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1779,9 +1779,9 @@ void AttSbVis::ResetSbVis()
 bool AttSbVis::ReadSbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToSbVisForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1819,9 +1819,9 @@ void AttScoreDefVis::ResetScoreDefVis()
 bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        if (removeAttr) element.remove_attribute("vu.height");
+    if (pugi::xml_attribute attr = element.attribute("vu.height")) {
+        this->SetVuHeight(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1859,9 +1859,9 @@ void AttSectionVis::ResetSectionVis()
 bool AttSectionVis::ReadSectionVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        if (removeAttr) element.remove_attribute("restart");
+    if (pugi::xml_attribute attr = element.attribute("restart")) {
+        this->SetRestart(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1899,9 +1899,9 @@ void AttSignifLetVis::ResetSignifLetVis()
 bool AttSignifLetVis::ReadSignifLetVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToEventrel(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1939,9 +1939,9 @@ void AttSpaceVis::ResetSpaceVis()
 bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        if (removeAttr) element.remove_attribute("compressable");
+    if (pugi::xml_attribute attr = element.attribute("compressable")) {
+        this->SetCompressable(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1982,24 +1982,24 @@ void AttStaffDefVis::ResetStaffDefVis()
 bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        if (removeAttr) element.remove_attribute("layerscheme");
+    if (pugi::xml_attribute attr = element.attribute("layerscheme")) {
+        this->SetLayerscheme(StrToLayerscheme(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        if (removeAttr) element.remove_attribute("lines.color");
+    if (pugi::xml_attribute attr = element.attribute("lines.color")) {
+        this->SetLinesColor(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        if (removeAttr) element.remove_attribute("lines.visible");
+    if (pugi::xml_attribute attr = element.attribute("lines.visible")) {
+        this->SetLinesVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToMeasurementsigned(element.attribute("spacing").value()));
-        if (removeAttr) element.remove_attribute("spacing");
+    if (pugi::xml_attribute attr = element.attribute("spacing")) {
+        this->SetSpacing(StrToMeasurementsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2064,9 +2064,9 @@ void AttStaffGrpVis::ResetStaffGrpVis()
 bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.thru")) {
-        this->SetBarThru(StrToBoolean(element.attribute("bar.thru").value()));
-        if (removeAttr) element.remove_attribute("bar.thru");
+    if (pugi::xml_attribute attr = element.attribute("bar.thru")) {
+        this->SetBarThru(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2109,34 +2109,34 @@ void AttStemVis::ResetStemVis()
 bool AttStemVis::ReadStemVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pos")) {
-        this->SetPos(StrToStemposition(element.attribute("pos").value()));
-        if (removeAttr) element.remove_attribute("pos");
+    if (pugi::xml_attribute attr = element.attribute("pos")) {
+        this->SetPos(StrToStemposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("len")) {
-        this->SetLen(StrToMeasurementunsigned(element.attribute("len").value()));
-        if (removeAttr) element.remove_attribute("len");
+    if (pugi::xml_attribute attr = element.attribute("len")) {
+        this->SetLen(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("form")) {
-        this->SetForm(StrToStemformMensural(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToStemformMensural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dir")) {
-        this->SetDir(StrToStemdirection(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
+    if (pugi::xml_attribute attr = element.attribute("dir")) {
+        this->SetDir(StrToStemdirection(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("flag.pos")) {
-        this->SetFlagPos(StrToFlagposMensural(element.attribute("flag.pos").value()));
-        if (removeAttr) element.remove_attribute("flag.pos");
+    if (pugi::xml_attribute attr = element.attribute("flag.pos")) {
+        this->SetFlagPos(StrToFlagposMensural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("flag.form")) {
-        this->SetFlagForm(StrToFlagformMensural(element.attribute("flag.form").value()));
-        if (removeAttr) element.remove_attribute("flag.form");
+    if (pugi::xml_attribute attr = element.attribute("flag.form")) {
+        this->SetFlagForm(StrToFlagformMensural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2222,24 +2222,24 @@ void AttTupletVis::ResetTupletVis()
 bool AttTupletVis::ReadTupletVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToStaffrelBasic(element.attribute("bracket.place").value()));
-        if (removeAttr) element.remove_attribute("bracket.place");
+    if (pugi::xml_attribute attr = element.attribute("bracket.place")) {
+        this->SetBracketPlace(StrToStaffrelBasic(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        if (removeAttr) element.remove_attribute("bracket.visible");
+    if (pugi::xml_attribute attr = element.attribute("bracket.visible")) {
+        this->SetBracketVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        if (removeAttr) element.remove_attribute("dur.visible");
+    if (pugi::xml_attribute attr = element.attribute("dur.visible")) {
+        this->SetDurVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        if (removeAttr) element.remove_attribute("num.format");
+    if (pugi::xml_attribute attr = element.attribute("num.format")) {
+        this->SetNumFormat(StrToTupletVisNumformat(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -171,9 +171,9 @@ bool Att{attGroupNameUpper}::Write{attGroupNameUpper}(pugi::xml_node element)
 
 ATTCLASS_MEMBERS_DEFAULT_CPP = """m_{attNameLowerJoined} = {attDefault};"""
 
-ATTCLASS_READ_CPP = """if (element.attribute("{attNameLower}")) {{
-        this->Set{attNameUpper}({converterRead}(element.attribute("{attNameLower}").value()));
-        if (removeAttr) element.remove_attribute("{attNameLower}");
+ATTCLASS_READ_CPP = """if (pugi::xml_attribute attr = element.attribute("{attNameLower}")) {{
+        this->Set{attNameUpper}({converterRead}(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }}"""
 
@@ -328,6 +328,7 @@ CONVERTER_H = """
 #ifndef __LIBMEI_ATT_CONVERTER_H__
 #define __LIBMEI_ATT_CONVERTER_H__
 
+#include <cstdint>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -345,6 +346,19 @@ protected:
     AttConverterBase() = default;
     ~AttConverterBase() = default;
 
+    /**
+     * Hash function (32-bit FNV-1a) used for looking up values in the perfect hash tables of the converters.
+     * The seed is chosen by libmei when generating the tables so that all the values of a type have distinct slots.
+     */
+    static uint32_t HashValue(const std::string &value, uint32_t seed)
+    {{
+        uint32_t hash = 2166136261u ^ seed;
+        for (const unsigned char c : value) {{
+            hash = (hash ^ c) * 16777619u;
+        }}
+        return hash;
+    }}
+
 public:"""
 
 CONVERTER_METHODS_H = """
@@ -408,6 +422,13 @@ CONVERTER_METHOD1_CPP = """
 CONVERTER_METHOD2_CPP = """
     if (value == "{string}") return {val_prefix}_{value};"""
 
+CONVERTER_METHOD2_HASH_CPP = """
+    // Perfect hash table of the values, with 0 for an empty slot and the value index + 1 otherwise
+{slots}
+{values}
+    const {slot_type} slot = slots[HashValue(value, {seed}) & {mask}];
+    if (slot && value == values[slot - 1]) return static_cast<{type}>(slot);"""
+
 CONVERTER_METHOD1_END_CPP = """
         default:
             LogWarning("Unknown value '%d' for {type}", data);
@@ -558,6 +579,9 @@ GETTERS_END_CPP = """}}
 
 DATATYPES: dict
 
+# Minimum number of values for a converter to use a perfect hash table
+HASH_MIN_VALUES = 9
+
 TEI_RNG_NS = {"tei": "http://www.tei-c.org/ns/1.0",
               "rng": "http://relaxng.org/ns/structure/1.0"}
 
@@ -698,6 +722,54 @@ def vrv_getattdefault(schema, module: str, gp: str, aname: str) -> tuple:
         return default, [f"StrTo{cname}", f"{cname}ToStr"]
 
 
+def vrv_hash_value(value: str, seed: int) -> int:
+    """Mirror of AttConverterBase::HashValue (32-bit FNV-1a) in attconverter.h"""
+    h: int = 2166136261 ^ seed
+    for c in value.encode("utf-8"):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def vrv_wrap_array(declaration: str, items: list) -> str:
+    line: str = "    " + declaration + " = { " + ", ".join(items) + " };"
+    lines: list = textwrap.wrap(line, width=120, subsequent_indent="        ", break_long_words=False,
+                                break_on_hyphens=False)
+    return "\n".join(lines)
+
+
+def vrv_create_str_to_converter(fmt: dict, values: list) -> str:
+    """
+    Create the body of the string to value converter. Short lists are compared one by one and longer
+    ones looked up in a perfect hash table with the seed found here.
+    """
+    if len(values) < HASH_MIN_VALUES:
+        return "".join([CONVERTER_METHOD2_CPP.format_map(val_fmt) for val_fmt in values])
+
+    strings: list = [val_fmt["string"] for val_fmt in values]
+    size: int = 1
+    while size < 2 * len(strings):
+        size *= 2
+    while True:
+        for seed in range(0, 10000):
+            hashed: set = {vrv_hash_value(v, seed) & (size - 1) for v in strings}
+            if len(hashed) == len(strings):
+                slots: list = [0] * size
+                for i, v in enumerate(strings):
+                    slots[vrv_hash_value(v, seed) & (size - 1)] = i + 1
+                slot_type: str = "uint8_t" if len(strings) < 256 else "uint16_t"
+                hash_fmt = {
+                    "type": fmt["type"],
+                    "slot_type": slot_type,
+                    "slots": vrv_wrap_array(f"static const {slot_type} slots[{size}]", [str(slot) for slot in slots]),
+                    "values": vrv_wrap_array(f"static const char *const values[{len(strings)}]",
+                                             [f'"{v}"' for v in strings]),
+                    "seed": seed,
+                    "mask": size - 1
+                }
+                return CONVERTER_METHOD2_HASH_CPP.format_map(hash_fmt)
+        size *= 2
+
+
 def create_docstr(text: str, indent: int = 0) -> str:
     """
         Format a docstring. Take the first sentence (. followed by a space)
@@ -887,6 +959,7 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
         att_converter_header_data_types.append(CONVERTER_METHODS_H.format_map(converter_start_fmt))
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_START_CPP.format_map(converter_start_fmt))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_START_CPP.format_map(converter_start_fmt))
+        att_converter_str_to_values: list = []
 
         for v in values:
             val: str = re.sub(r"[\.\-\,]", "_", v)
@@ -899,7 +972,7 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
 
             att_type_data_types.append(TYPE_VALUE.format_map(val_fmt))
             att_converter_impl_from_converters.append(CONVERTER_METHOD1_CPP.format_map(val_fmt))
-            att_converter_impl_to_converters.append(CONVERTER_METHOD2_CPP.format_map(val_fmt))
+            att_converter_str_to_values.append(val_fmt)
 
         att_type_data_types.append(TYPE_END.format(val_prefix=val_prefix))
 
@@ -908,6 +981,8 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
             "type": data_type
         }
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_END_CPP.format_map(converter_end_fmt))
+        att_converter_impl_to_converters.append(vrv_create_str_to_converter(converter_start_fmt,
+                                                                            att_converter_str_to_values))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_END_CPP.format_map(converter_end_fmt))
 
         att_converter_impl_data_types.extend(att_converter_impl_from_converters)
@@ -942,6 +1017,7 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
         att_converter_header_data_list.append(CONVERTER_METHODS_H.format_map(converter_start_fmt))
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_START_CPP.format_map(converter_start_fmt))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_START_CPP.format_map(converter_start_fmt))
+        att_converter_str_to_values: list = []
 
         for v in values:
             val: str = re.sub(r"[\.\-\,]", "_", v)
@@ -953,10 +1029,12 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
             }
             att_type_data_list.append(TYPE_VALUE.format_map(val_fmt))
             att_converter_impl_from_converters.append(CONVERTER_METHOD1_CPP.format_map(val_fmt))
-            att_converter_impl_to_converters.append(CONVERTER_METHOD2_CPP.format_map(val_fmt))
+            att_converter_str_to_values.append(val_fmt)
 
         att_type_data_list.append(TYPE_END.format(val_prefix=val_prefix))
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_END_CPP.format(prefix=val_prefix, type=list_type))
+        att_converter_impl_to_converters.append(vrv_create_str_to_converter(converter_start_fmt,
+                                                                            att_converter_str_to_values))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_END_CPP.format(prefix=val_prefix, type=list_type))
         att_converter_impl_data_list.extend(att_converter_impl_from_converters)
         att_converter_impl_data_list.extend(att_converter_impl_to_converters)
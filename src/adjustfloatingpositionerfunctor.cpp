@@ -52,6 +52,7 @@ FunctorCode AdjustFloatingPositionersFunctor::VisitStaffAlignment(StaffAlignment
         return FUNCTOR_SIBLINGS;
     }
 
+    std::vector<int> overflowPositions;
     for (FloatingPositioner *positioner : staffAlignment->GetFloatingPositioners()) {
         assert(positioner->GetObject());
         if (!m_inBetween && !positioner->GetObject()->Is(m_classId)) continue;
@@ -120,10 +121,20 @@ FunctorCode AdjustFloatingPositionersFunctor::VisitStaffAlignment(StaffAlignment
         }
 
         // Find all the overflowing elements from the staff that overlap horizontally
-        for (auto i = overflowBoxes.begin(); i != overflowBoxes.end(); ++i) {
-            if (positioner->HasHorizontalOverlapWith(*i, drawingUnit)) {
+        // The index preselects them with the largest admissible overlap margin (see GetAdmissibleHorizOverlapMargin)
+        std::map<const StaffAlignment *, BoundingBoxIndex> &overflowIndexes
+            = (place == STAFFREL_above) ? m_overflowAboveIndexes : m_overflowBelowIndexes;
+        BoundingBoxIndex &overflowIndex
+            = overflowIndexes.try_emplace(staffAlignment, BBOX_INDEX_MAX_WIDTH * drawingUnit).first->second;
+        overflowIndex.Update(overflowBoxes);
+        const int maxMargin = 8 * drawingUnit;
+        overflowIndex.FindOverlapping(positioner->GetContentLeft() - maxMargin,
+            positioner->GetContentRight() + positioner->GetDrawingExtenderWidth() + maxMargin, overflowPositions);
+        for (int position : overflowPositions) {
+            BoundingBox *bbox = overflowBoxes.at(position);
+            if (positioner->HasHorizontalOverlapWith(bbox, drawingUnit)) {
                 // update the yRel accordingly
-                positioner->CalcDrawingYRel(m_doc, staffAlignment, *i);
+                positioner->CalcDrawingYRel(m_doc, staffAlignment, bbox);
             }
         }
 
@@ -152,6 +163,10 @@ FunctorCode AdjustFloatingPositionersFunctor::VisitSystem(System *system)
 {
     m_inBetween = false;
 
+    // The overflowing bounding boxes are indexed once for all the passes of the system
+    m_overflowAboveIndexes.clear();
+    m_overflowBelowIndexes.clear();
+
     AdjustFloatingPositionerGrpsFunctor adjustFloatingPositionerGrps(m_doc);
 
     m_classId = LV;
@@ -428,6 +443,11 @@ FunctorCode AdjustFloatingPositionersBetweenFunctor::VisitStaffAlignment(StaffAl
     dist -= m_previousStaffAlignment->GetStaffHeight();
     int centerYRel = dist / 2 + m_previousStaffAlignment->GetStaffHeight();
 
+    const ArrayOfBoundingBoxes &overflowBoxes = staffAlignment->GetBBoxesAbove();
+    // The index is built only when a positioner needs it
+    BoundingBoxIndex overflowIndex(BBOX_INDEX_MAX_WIDTH * m_doc->GetDrawingUnit(staffAlignment->GetStaffSize()));
+    std::vector<int> overflowPositions;
+
     for (FloatingPositioner *positioner : m_previousStaffAlignment->GetFloatingPositioners()) {
         assert(positioner->GetObject());
         if (!positioner->GetObject()->Is({ DIR, DYNAM, HAIRPIN, TEMPO })) continue;
@@ -439,21 +459,16 @@ FunctorCode AdjustFloatingPositionersBetweenFunctor::VisitStaffAlignment(StaffAl
 
         int diffY = centerYRel - positioner->GetDrawingYRel();
 
-        const ArrayOfBoundingBoxes &overflowBoxes = staffAlignment->GetBBoxesAbove();
-        auto i = overflowBoxes.begin();
-        auto end = overflowBoxes.end();
-        while (i != end) {
-
-            // find all the overflowing elements from the staff that overlap horizontally
-            i = std::find_if(
-                i, end, [positioner](BoundingBox *elem) { return positioner->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // update the yRel accordingly
-                const int spaceY = positioner->GetSpaceBelow(m_doc, staffAlignment, *i);
-                if (spaceY != VRV_UNSET) {
-                    diffY = std::min(diffY, spaceY);
-                }
-                ++i;
+        // find all the overflowing elements from the staff that overlap horizontally
+        overflowIndex.Update(overflowBoxes);
+        overflowIndex.FindOverlapping(positioner->GetContentLeft(), positioner->GetContentRight(), overflowPositions);
+        for (int position : overflowPositions) {
+            BoundingBox *bbox = overflowBoxes.at(position);
+            if (!positioner->HorizontalContentOverlap(bbox)) continue;
+            // update the yRel accordingly
+            const int spaceY = positioner->GetSpaceBelow(m_doc, staffAlignment, bbox);
+            if (spaceY != VRV_UNSET) {
+                diffY = std::min(diffY, spaceY);
             }
         }
         positioner->SetDrawingYRel(positioner->GetDrawingYRel() + diffY);
@@ -9,6 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <numeric>
+
+//----------------------------------------------------------------------------
+
 #include "doc.h"
 #include "floatingobject.h"
 #include "system.h"
@@ -61,36 +65,53 @@ FunctorCode AdjustStaffOverlapFunctor::VisitStaffAlignment(StaffAlignment *staff
     const int staffSize = staffAlignment->GetStaffSize();
     const int drawingUnit = m_doc->GetDrawingUnit(staffSize);
 
+    const ArrayOfBoundingBoxes &bboxesAbove = staffAlignment->GetBBoxesAbove();
+    // The elements of the bottom staff are indexed for finding the ones overlapping horizontally
+    BoundingBoxIndex bboxesAboveIndex(BBOX_INDEX_MAX_WIDTH * drawingUnit);
+    bboxesAboveIndex.Update(bboxesAbove);
+    std::vector<int> positions;
+
     // go through all the elements of the top staff that have an overflow below
     for (BoundingBox *bboxBelow : m_previous->GetBBoxesBelow()) {
-        const ArrayOfBoundingBoxes &bboxesAbove = staffAlignment->GetBBoxesAbove();
-        auto iter = bboxesAbove.begin();
-        auto end = bboxesAbove.end();
-        while (iter != end) {
-            // find all the elements from the bottom staff that have an overflow at the top with an horizontal overlap
-            iter = std::find_if(iter, end, [bboxBelow, drawingUnit](BoundingBox *elem) {
-                if (bboxBelow->Is(FLOATING_POSITIONER)) {
-                    FloatingPositioner *fp = vrv_cast<FloatingPositioner *>(bboxBelow);
-                    if (fp->GetObject()->Is({ DIR, DYNAM, TEMPO }) && fp->GetObject()->IsExtenderElement()) {
-                        return bboxBelow->HorizontalContentOverlap(elem, drawingUnit * 4)
-                            || bboxBelow->VerticalContentOverlap(elem);
-                    }
-                }
-                return bboxBelow->HorizontalContentOverlap(elem);
-            });
-            if (iter != end) {
-                // calculate the vertical overlap and see if this is more than the expected space
-                int overflowBelow = m_previous->CalcOverflowBelow(bboxBelow);
-                int overflowAbove = staffAlignment->CalcOverflowAbove(*iter);
-                int minSpaceBetween = 0;
-                if ((bboxBelow->Is(ARTIC) && ((*iter)->Is({ ARTIC, NOTE })))
-                    || (bboxBelow->Is(NOTE) && ((*iter)->Is(ARTIC)))) {
-                    minSpaceBetween = drawingUnit;
-                }
-                if (spacing < (overflowBelow + overflowAbove + minSpaceBetween)) {
-                    staffAlignment->SetOverlap((overflowBelow + overflowAbove + minSpaceBetween) - spacing);
+        bool isExtender = false;
+        if (bboxBelow->Is(FLOATING_POSITIONER)) {
+            FloatingPositioner *fp = vrv_cast<FloatingPositioner *>(bboxBelow);
+            isExtender = (fp->GetObject()->Is({ DIR, DYNAM, TEMPO }) && fp->GetObject()->IsExtenderElement());
+        }
+        // Extenders also check the vertical overlap, so all the elements need to be checked
+        if (isExtender) {
+            positions.resize(bboxesAbove.size());
+            std::iota(positions.begin(), positions.end(), 0);
+        }
+        else if (bboxBelow->HasContentBB()) {
+            bboxesAboveIndex.FindOverlapping(bboxBelow->GetContentLeft(), bboxBelow->GetContentRight(), positions);
+        }
+        else {
+            continue;
+        }
+
+        // find all the elements from the bottom staff that have an overflow at the top with an horizontal overlap
+        for (int position : positions) {
+            BoundingBox *bboxAbove = bboxesAbove.at(position);
+            if (isExtender) {
+                if (!bboxBelow->HorizontalContentOverlap(bboxAbove, drawingUnit * 4)
+                    && !bboxBelow->VerticalContentOverlap(bboxAbove)) {
+                    continue;
                 }
-                ++iter;
+            }
+            else if (!bboxBelow->HorizontalContentOverlap(bboxAbove)) {
+                continue;
+            }
+            // calculate the vertical overlap and see if this is more than the expected space
+            int overflowBelow = m_previous->CalcOverflowBelow(bboxBelow);
+            int overflowAbove = staffAlignment->CalcOverflowAbove(bboxAbove);
+            int minSpaceBetween = 0;
+            if ((bboxBelow->Is(ARTIC) && (bboxAbove->Is({ ARTIC, NOTE })))
+                || (bboxBelow->Is(NOTE) && (bboxAbove->Is(ARTIC)))) {
+                minSpaceBetween = drawingUnit;
+            }
+            if (spacing < (overflowBelow + overflowAbove + minSpaceBetween)) {
+                staffAlignment->SetOverlap((overflowBelow + overflowAbove + minSpaceBetween) - spacing);
             }
         }
     }
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <math.h>
 
@@ -1258,4 +1259,73 @@ void SegmentedLine::AddGap(int start, int end)
     }
 }
 
+//----------------------------------------------------------------------------
+// BoundingBoxIndex
+//----------------------------------------------------------------------------
+
+BoundingBoxIndex::BoundingBoxIndex(int maxWidth)
+{
+    this->Reset(maxWidth);
+}
+
+void BoundingBoxIndex::Reset(int maxWidth)
+{
+    m_sorted.clear();
+    m_wide.clear();
+    m_maxWidth = maxWidth;
+    m_count = 0;
+    m_last = NULL;
+}
+
+void BoundingBoxIndex::Update(const ArrayOfBoundingBoxes &boxes)
+{
+    // The array has been cleared or changed since the last update
+    if (((int)boxes.size() < m_count) || ((m_count > 0) && (boxes.at(m_count - 1) != m_last))) {
+        this->Reset(m_maxWidth);
+    }
+
+    for (int i = m_count; i < (int)boxes.size(); ++i) {
+        const BoundingBox *box = boxes.at(i);
+        // Boxes without content never overlap
+        if (!box->HasContentBB()) continue;
+
+        Entry entry;
+        entry.m_left = box->GetContentLeft();
+        entry.m_right = box->GetContentRight();
+        entry.m_position = i;
+        const FloatingPositioner *positioner = dynamic_cast<const FloatingPositioner *>(box);
+        if (positioner) entry.m_right += positioner->GetDrawingExtenderWidth();
+
+        if (entry.m_right - entry.m_left > m_maxWidth) {
+            m_wide.push_back(entry);
+        }
+        else {
+            auto it = std::upper_bound(m_sorted.begin(), m_sorted.end(), entry.m_left,
+                [](int left, const Entry &other) { return (left < other.m_left); });
+            m_sorted.insert(it, entry);
+        }
+    }
+
+    m_count = (int)boxes.size();
+    m_last = (m_count > 0) ? boxes.back() : NULL;
+}
+
+void BoundingBoxIndex::FindOverlapping(int left, int right, std::vector<int> &positions) const
+{
+    positions.clear();
+
+    // The sorted boxes overlapping the range cannot start before the left limit minus the maximum width
+    auto it = std::lower_bound(m_sorted.begin(), m_sorted.end(), left - m_maxWidth,
+        [](const Entry &entry, int value) { return (entry.m_left < value); });
+    for (; (it != m_sorted.end()) && (it->m_left <= right); ++it) {
+        if (it->m_right >= left) positions.push_back(it->m_position);
+    }
+
+    for (const Entry &entry : m_wide) {
+        if ((entry.m_left <= right) && (entry.m_right >= left)) positions.push_back(entry.m_position);
+    }
+
+    std::sort(positions.begin(), positions.end());
+}
+
 } // namespace vrv
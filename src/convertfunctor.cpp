@@ -58,7 +58,7 @@ FunctorCode ConvertToPageBasedFunctor::VisitEditorialElement(EditorialElement *e
 
 FunctorCode ConvertToPageBasedFunctor::VisitEditorialElementEnd(EditorialElement *editorialElement)
 {
-    if (editorialElement->m_visibility == Visible) {
+    if (editorialElement->GetVisibility() == Visible) {
         editorialElement->ConvertToPageBasedMilestone(editorialElement, m_currentSystem);
     }
 
@@ -98,7 +98,7 @@ FunctorCode ConvertToPageBasedFunctor::VisitMdiv(Mdiv *mdiv)
 
 FunctorCode ConvertToPageBasedFunctor::VisitMdivEnd(Mdiv *mdiv)
 {
-    if (mdiv->m_visibility == Visible) {
+    if (mdiv->GetVisibility() == Visible) {
         mdiv->ConvertToPageBasedMilestone(mdiv, m_page);
     }
 
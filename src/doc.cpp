@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <math.h>
+#include <set>
 
 //----------------------------------------------------------------------------
 
@@ -24,6 +25,7 @@
 #include "docselection.h"
 #include "expansion.h"
 #include "featureextractor.h"
+#include "findfunctor.h"
 #include "functor.h"
 #include "glyph.h"
 #include "instrdef.h"
@@ -82,7 +84,7 @@ namespace vrv {
 // Doc
 //----------------------------------------------------------------------------
 
-Doc::Doc() : Object(DOC, "doc-")
+Doc::Doc() : Object(DOC, "doc-"), m_treeChangeCounter(0)
 {
     m_options = new Options();
 
@@ -95,6 +97,9 @@ Doc::Doc() : Object(DOC, "doc-")
 
 Doc::~Doc()
 {
+    // Delete the content before the tree change counter is destroyed
+    this->ClearChildren();
+
     this->ClearSelectionPages();
 
     delete m_options;
@@ -128,13 +133,29 @@ void Doc::Reset()
     m_currentScoreDefDone = false;
     m_dataPreparationDone = false;
     m_timemapTempo = 0.0;
+    m_measureTimeIndex.Reset();
+    m_noteOrRestTimeIndexes.clear();
+    m_timemapIndexValid = false;
+    m_timemapIndexTreeChangeCounter = 0;
     m_markup = MARKUP_DEFAULT;
     m_isMensuralMusicOnly = false;
     m_isCastOff = false;
     m_visibleScores.clear();
+    m_drawingGrpObjects.clear();
 
     m_facsimile = NULL;
 
+    m_idIndex.clear();
+    m_idIndexValid = false;
+    m_idIndexHasDuplicates = false;
+    m_idIndexTreeChangeCounter = 0;
+    m_idLookUpTreeChangeCounter = 0;
+
+    m_classIdIndex.clear();
+    m_classIdIndexValid = false;
+    m_classIdIndexTreeChangeCounter = 0;
+    m_classIdLookUpTreeChangeCounter = 0;
+
     m_drawingSmuflFontSize = 0;
     m_drawingLyricFontSize = 0;
 
@@ -291,7 +312,9 @@ void Doc::GenerateMEIHeader(bool meiBasic)
 {
     // Try to preserve titles if we have an existing header
     std::list<std::string> titles;
-    pugi::xpath_node_set titlesNodeSet = m_header.select_nodes("//meiHead/fileDesc/titleStmt/title/text()");
+    // The query is compiled only once since a header is generated for every import
+    static const pugi::xpath_query titlesQuery("//meiHead/fileDesc/titleStmt/title/text()");
+    pugi::xpath_node_set titlesNodeSet = m_header.select_nodes(titlesQuery);
     for (pugi::xpath_node titleXpathNode : titlesNodeSet) {
         pugi::xml_node titleNode = titleXpathNode.node();
         if (!titleNode) continue;
@@ -390,6 +413,98 @@ void Doc::CalculateTimemap()
     this->Process(initTimemapTies);
 
     m_timemapTempo = m_options->m_midiTempoAdjustment.GetValue();
+
+    this->IndexTimemap();
+}
+
+void Doc::IndexTimemap()
+{
+    m_measureTimeIndex.Reset();
+    m_noteOrRestTimeIndexes.clear();
+
+    ClassIdsComparison matchNoteOrRest({ NOTE, REST });
+    int measureOrder = 0;
+    for (Object *object : this->FindAllDescendantsByType(MEASURE)) {
+        Measure *measure = vrv_cast<Measure *>(object);
+        assert(measure);
+        // One interval for each playing repeat time of the measure
+        const double duration = measure->GetRealTimeDurationMilliseconds();
+        int repeat = 1;
+        for (double offset : measure->GetRealTimeOffsetsMilliseconds()) {
+            m_measureTimeIndex.AddInterval({ offset, offset + duration, measure, measureOrder, repeat });
+            ++repeat;
+        }
+        ++measureOrder;
+
+        TimeIntervalIndex &noteOrRestTimeIndex = m_noteOrRestTimeIndexes[measure];
+        ListOfObjects notesOrRests;
+        measure->FindAllDescendantsByComparison(&notesOrRests, &matchNoteOrRest);
+        int order = 0;
+        for (Object *noteOrRest : notesOrRests) {
+            const DurationInterface *interface = noteOrRest->GetDurationInterface();
+            assert(interface);
+            noteOrRestTimeIndex.AddInterval({ interface->GetRealTimeOnsetMilliseconds(),
+                interface->GetRealTimeOffsetMilliseconds(), noteOrRest, order });
+            ++order;
+        }
+        noteOrRestTimeIndex.Sort();
+    }
+    m_measureTimeIndex.Sort();
+
+    m_timemapIndexTreeChangeCounter = this->GetTreeChangeCounter();
+    m_timemapIndexValid = true;
+}
+
+Measure *Doc::FindElementsAtTime(int millisec, ListOfObjects &notesOrRests)
+{
+    if (!m_timemapIndexValid || (m_timemapIndexTreeChangeCounter != this->GetTreeChangeCounter())) {
+        this->IndexTimemap();
+    }
+
+    // The first measure in the document with its first repeat playing at that time
+    std::vector<const TimeInterval *> measureIntervals = m_measureTimeIndex.FindIntervalsAt(millisec);
+    if (measureIntervals.empty()) return NULL;
+    Measure *measure = vrv_cast<Measure *>(measureIntervals.front()->object);
+    assert(measure);
+
+    // The times of the notes and rests are relative to the integer part of the measure onset
+    const int time = millisec - (int)measureIntervals.front()->onset;
+    for (const TimeInterval *interval : m_noteOrRestTimeIndexes.at(measure).FindIntervalsAt(time)) {
+        notesOrRests.push_back(interval->object);
+    }
+
+    return measure;
+}
+
+std::vector<int> Doc::GetTimemapChangeTimes(int startMillisec, int endMillisec)
+{
+    if (!m_timemapIndexValid || (m_timemapIndexTreeChangeCounter != this->GetTreeChangeCounter())) {
+        this->IndexTimemap();
+    }
+
+    std::vector<int> times;
+    auto addTime = [&times, startMillisec, endMillisec](double time) {
+        const int millisec = ceil(time);
+        if ((millisec > startMillisec) && (millisec <= endMillisec)) times.push_back(millisec);
+    };
+
+    for (const TimeInterval *measureInterval : m_measureTimeIndex.FindIntervalsBetween(startMillisec, endMillisec)) {
+        // The measure is played from the first integer time after its onset and up to the integer part of its offset
+        addTime(measureInterval->onset);
+        addTime(floor(measureInterval->offset) + 1);
+        // Same for the notes and rests with the time relative to the integer part of the measure onset
+        const Measure *measure = vrv_cast<const Measure *>(measureInterval->object);
+        const int measureOnset = (int)measureInterval->onset;
+        for (const TimeInterval &interval : m_noteOrRestTimeIndexes.at(measure).GetIntervals()) {
+            addTime(measureOnset + ceil(interval.onset));
+            addTime(measureOnset + floor(interval.offset) + 1);
+        }
+    }
+
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+
+    return times;
 }
 
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
@@ -560,7 +675,24 @@ bool Doc::ExportExpansionMap(std::string &output)
     return false;
 }
 
-bool Doc::ExportFeatures(std::string &output, const std::string &options)
+bool Doc::ExportFeatures(std::string &output, const std::string &options, bool compact)
+{
+    FeatureExtractor extractor(options);
+    if (!this->ExtractFeatures(extractor)) {
+        output = "{}";
+        return false;
+    }
+    if (compact) {
+        extractor.ToCompactJson(output);
+    }
+    else {
+        extractor.ToJson(output);
+    }
+
+    return true;
+}
+
+bool Doc::ExtractFeatures(FeatureExtractor &extractor)
 {
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
@@ -568,13 +700,10 @@ bool Doc::ExportFeatures(std::string &output, const std::string &options)
     }
     if (!this->HasTimemap()) {
         LogWarning("Calculation of the timemap failed, the features cannot be exported.");
-        output = "{}";
         return false;
     }
-    FeatureExtractor extractor(options);
     GenerateFeaturesFunctor generateFeatures(&extractor);
     this->Process(generateFeatures);
-    extractor.ToJson(output);
 
     return true;
 }
@@ -587,9 +716,21 @@ void Doc::PrepareData()
         ResetDataFunctor resetData;
         this->Process(resetData);
     }
+    m_drawingGrpObjects.clear();
     PrepareDataInitializationFunctor prepareDataInitialization(this);
     this->Process(prepareDataInitialization);
 
+    /************ Collect the element types ************/
+
+    // The passes resolving elements that are not in the document are skipped - typically, most of them for incipits.
+    // These elements are not created by the preparation, so they are looked up before the tree is changed.
+    const bool hasPlists = this->HasDescendantOfType({ ARPEG, BEAMSPAN, EXPANSION });
+    const bool hasBeamSpans = this->HasDescendantOfType({ BEAMSPAN });
+    const bool hasPedals = this->HasDescendantOfType({ PEDAL });
+    const bool hasTurns = this->HasDescendantOfType({ TURN });
+    const bool hasMRpts = this->HasDescendantOfType({ MRPT });
+    const bool hasSyllables = this->HasDescendantOfType({ SYLLABLE });
+
     /************ Generate measure indices ************/
 
     this->PrepareMeasureIndices();
@@ -634,14 +775,15 @@ void Doc::PrepareData()
     /************ Resolve @startid (only) ************/
 
     // Resolve <reh> elements first, since they can be encoded without @startid or @tstamp, but we need one internally
-    // for placement
+    // for placement. This only changes the <reh> itself, so it can be done in the same traversal.
     PrepareRehPositionFunctor prepareRehPosition;
-    this->Process(prepareRehPosition);
+    prepareRehPosition.SetDirection(BACKWARD);
 
     // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
     PrepareTimePointingFunctor prepareTimePointing;
     prepareTimePointing.SetDirection(BACKWARD);
-    this->Process(prepareTimePointing);
+    CompositeFunctor prepareTimePointingAndReh({ &prepareRehPosition, &prepareTimePointing });
+    this->Process(prepareTimePointingAndReh);
 
     /************ Resolve @tstamp / tstamp2 ************/
 
@@ -684,12 +826,14 @@ void Doc::PrepareData()
 
     // Try to match all pointing elements using @plist
     PreparePlistFunctor preparePlist;
-    this->Process(preparePlist);
-    preparePlist.SetDataCollectionCompleted();
-
-    // Process plist after all pairs have been collected
-    if (!preparePlist.GetInterfaceIDPairs().empty()) {
+    if (hasPlists) {
         this->Process(preparePlist);
+        preparePlist.SetDataCollectionCompleted();
+
+        // Process plist after all pairs have been collected
+        if (!preparePlist.GetInterfaceIDPairs().empty()) {
+            this->Process(preparePlist);
+        }
     }
 
     // If some are still there, then it is probably an issue in the encoding
@@ -706,12 +850,18 @@ void Doc::PrepareData()
     /************ Resolve beamspan elements ***********/
 
     PrepareBeamSpanElementsFunctor prepareBeamSpanElements;
-    this->Process(prepareBeamSpanElements);
 
     /************ Match pedal lines ***********/
 
     PreparePedalsFunctor preparePedals(this);
-    this->Process(preparePedals);
+
+    // Both are independent and can be done in a single traversal
+    CompositeFunctor prepareBeamSpanElementsAndPedals;
+    if (hasBeamSpans) prepareBeamSpanElementsAndPedals.AddFunctor(&prepareBeamSpanElements);
+    if (hasPedals) prepareBeamSpanElementsAndPedals.AddFunctor(&preparePedals);
+    if (!prepareBeamSpanElementsAndPedals.GetFunctors().empty()) {
+        this->Process(prepareBeamSpanElementsAndPedals);
+    }
 
     /************ Prepare processing by staff/layer/verse ************/
 
@@ -754,7 +904,7 @@ void Doc::PrepareData()
     /************ Resolve delayed turns ************/
 
     PrepareDelayedTurnsFunctor prepareDelayedTurns;
-    this->Process(prepareDelayedTurns);
+    if (hasTurns) this->Process(prepareDelayedTurns);
     prepareDelayedTurns.SetDataCollectionCompleted();
 
     if (!prepareDelayedTurns.GetDelayedTurns().empty()) {
@@ -816,7 +966,7 @@ void Doc::PrepareData()
     /************ Resolve mRpt ************/
 
     // Process by staff for matching mRpt elements and setting the drawing number
-    for (staves = layerTree.child.begin(); staves != layerTree.child.end(); ++staves) {
+    for (staves = layerTree.child.begin(); hasMRpts && (staves != layerTree.child.end()); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             filters.Clear();
             // Create ad comparison object for each type / @n
@@ -836,25 +986,25 @@ void Doc::PrepareData()
 
     // Prepare the endings (pointers to the measure after and before the boundaries)
     PrepareMilestonesFunctor prepareMilestones;
-    this->Process(prepareMilestones);
 
     /************ Resolve floating groups for vertical alignment ************/
 
     // Prepare the floating drawing groups
     PrepareFloatingGrpsFunctor prepareFloatingGrps;
-    this->Process(prepareFloatingGrps);
 
     /************ Resolve cue size ************/
 
     // Prepare the drawing cue size
     PrepareCueSizeFunctor prepareCueSize;
-    this->Process(prepareCueSize);
 
     /************ Resolve @altsym ************/
 
     // Try to match all pointing elements using @next, @sameas and @stem.sameas
     PrepareAltSymFunctor prepareAltSym;
-    this->Process(prepareAltSym);
+
+    // None of them depends on the others, so they can be done in a single traversal
+    CompositeFunctor prepareDrawingData({ &prepareMilestones, &prepareFloatingGrps, &prepareCueSize, &prepareAltSym });
+    this->Process(prepareDrawingData);
 
     /************ Instanciate LayerElement parts (stem, flag, dots, etc) ************/
 
@@ -862,10 +1012,12 @@ void Doc::PrepareData()
     this->Process(prepareLayerElementParts);
 
     /************ Add default syl for syllables (if applicable) ************/
-    ListOfObjects syllables = this->FindAllDescendantsByType(SYLLABLE);
-    for (Object *object : syllables) {
-        Syllable *syllable = dynamic_cast<Syllable *>(object);
-        syllable->MarkupAddSyl();
+    if (hasSyllables) {
+        ListOfObjects syllables = this->FindAllDescendantsByType(SYLLABLE);
+        for (Object *object : syllables) {
+            Syllable *syllable = dynamic_cast<Syllable *>(object);
+            syllable->MarkupAddSyl();
+        }
     }
 
     /************ Resolve @facs ************/
@@ -1025,6 +1177,15 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     castOffSinglePage->ResetCachedDrawingX();
     castOffSinglePage->LayOutVertically();
 
+    // Store the position and height of the systems for casting off the pages (again)
+    for (Object *child : castOffSinglePage->GetChildren()) {
+        if (!child->Is(SYSTEM)) continue;
+        System *system = vrv_cast<System *>(child);
+        assert(system);
+        system->m_castOffYRel = system->GetDrawingYRel() - m_drawingPageContentHeight;
+        system->m_castOffHeight = system->GetHeight();
+    }
+
     // Detach the contentPage to prepare for CastOffPages
     pages->DetachChild(0);
     assert(castOffSinglePage && !castOffSinglePage->GetParent());
@@ -1051,6 +1212,72 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     m_isCastOff = true;
 }
 
+bool Doc::CastOffPagesDoc()
+{
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    if (!this->IsCastOff()) {
+        LogDebug("Document is not cast off");
+        return false;
+    }
+
+    // Systems merged with a leftover system were changed after their height was stored
+    if (m_options->m_breaksNoWidow.GetValue()) return false;
+
+    // All the systems need to have been cast off into pages by Doc::CastOffDocBase
+    for (Object *page : pages->GetChildren()) {
+        for (Object *child : page->GetChildren()) {
+            if (child->Is(SYSTEM) && (vrv_cast<System *>(child)->m_castOffHeight == VRV_UNSET)) return false;
+        }
+    }
+
+    std::list<Score *> scores = this->GetVisibleScores();
+    assert(!scores.empty());
+
+    // Move the content of all the pages back to a single page
+    Page *castOffSinglePage = new Page();
+    for (Object *page : pages->GetChildren()) {
+        castOffSinglePage->MoveChildrenFrom(page);
+    }
+    pages->ClearChildren();
+    pages->AddChild(castOffSinglePage);
+    this->ResetDataPage();
+    this->SetDrawingPage(0);
+
+    // Detach the contentPage to prepare for CastOffPages
+    pages->DetachChild(0);
+    assert(castOffSinglePage && !castOffSinglePage->GetParent());
+    this->ResetDataPage();
+
+    for (Score *score : scores) {
+        score->CalcRunningElementHeight(this);
+    }
+
+    Page *castOffFirstPage = new Page();
+    CastOffPagesFunctor castOffPages(castOffSinglePage, this, castOffFirstPage);
+    castOffPages.SetPageHeight(m_drawingPageContentHeight);
+
+    pages->AddChild(castOffFirstPage);
+    castOffSinglePage->Process(castOffPages);
+    delete castOffSinglePage;
+
+    bool optimize = false;
+    for (Score *score : scores) {
+        if (score->ScoreDefNeedsOptimization(m_options->m_condense.GetValue())) {
+            optimize = true;
+            break;
+        }
+    }
+
+    this->ScoreDefSetCurrentDoc(true);
+    if (optimize) {
+        this->ScoreDefOptimizeDoc();
+    }
+
+    return true;
+}
+
 void Doc::UnCastOffDoc(bool resetCache)
 {
     if (!this->IsCastOff()) {
@@ -1080,6 +1307,102 @@ void Doc::UnCastOffDoc(bool resetCache)
     m_isCastOff = false;
 }
 
+void Doc::MarkLayoutDirty(Object *object)
+{
+    assert(object);
+
+    System *system = vrv_cast<System *>(object->GetFirstAncestor(SYSTEM));
+    if (system) system->SetLayoutDirty(true);
+}
+
+bool Doc::LayOutDirtySystems()
+{
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // The edited systems are laid out with their entire page, since the horizontal layout carries state from one
+    // system to the next - laying out only the edited measures or systems is not supported
+    std::vector<Page *> dirtyPages;
+    for (Object *child : pages->GetChildren()) {
+        Page *page = vrv_cast<Page *>(child);
+        assert(page);
+        if (!page->HasLayoutDirtySystems()) continue;
+        // Without a previous layout we cannot tell if the edited systems still fit
+        if (!page->IsLayoutDone()) return false;
+        dirtyPages.push_back(page);
+    }
+
+    if (dirtyPages.empty()) return false;
+
+    for (Page *page : dirtyPages) {
+        // Keep the size of the edited systems before laying out the page again
+        std::map<System *, std::pair<int, int>> systemSizes;
+        for (Object *pageChild : page->GetChildren()) {
+            if (!pageChild->Is(SYSTEM)) continue;
+            System *system = vrv_cast<System *>(pageChild);
+            assert(system);
+            if (system->IsLayoutDirty()) {
+                systemSizes[system] = { system->m_drawingTotalWidth, system->GetHeight() };
+            }
+        }
+
+        // A change of width is known after the horizontal layout, before justifying and laying out vertically
+        this->SetDrawingPage(page->GetIdx());
+        page->LayOutHorizontally();
+        for (const auto &[system, size] : systemSizes) {
+            if (system->m_drawingTotalWidth != size.first) return false;
+        }
+
+        page->LayOutAfterHorizontally();
+        for (const auto &[system, size] : systemSizes) {
+            if (system->GetHeight() != size.second) return false;
+        }
+    }
+
+    // Elements spanning from one page to the next (e.g., slurs or ties) are laid out again on the neighbouring pages
+    auto isDirty = [&dirtyPages](Object *page) {
+        return (std::find(dirtyPages.begin(), dirtyPages.end(), page) != dirtyPages.end());
+    };
+    for (Page *page : dirtyPages) {
+        Object *previous = pages->GetPrevious(page);
+        if (previous && !isDirty(previous)) vrv_cast<Page *>(previous)->ResetLayout();
+        Object *next = pages->GetNext(page);
+        if (next && !isDirty(next)) vrv_cast<Page *>(next)->ResetLayout();
+    }
+
+    return true;
+}
+
+bool Doc::HasLayoutDirtySystems() const
+{
+    const Pages *pages = this->GetPages();
+    assert(pages);
+
+    const ArrayOfConstObjects children = pages->GetChildren();
+    return std::any_of(children.begin(), children.end(),
+        [](const Object *child) { return vrv_cast<const Page *>(child)->HasLayoutDirtySystems(); });
+}
+
+bool Doc::HasLaidOutPages() const
+{
+    const Pages *pages = this->GetPages();
+    assert(pages);
+
+    const ArrayOfConstObjects children = pages->GetChildren();
+    return std::any_of(children.begin(), children.end(),
+        [](const Object *child) { return vrv_cast<const Page *>(child)->IsLayoutDone(); });
+}
+
+void Doc::ResetPageLayouts()
+{
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    for (Object *child : pages->GetChildren()) {
+        vrv_cast<Page *>(child)->ResetLayout();
+    }
+}
+
 void Doc::CastOffEncodingDoc()
 {
     if (this->IsCastOff()) {
@@ -1459,6 +1782,81 @@ void Doc::ExpandExpansions()
     // for (std::string s : existingList) std::cout << s.c_str() << ((s != existingList.back()) ? " " : "}.\n");
 }
 
+bool Doc::FindIndexedByID(const std::string &id, const Object *&element) const
+{
+    const uint32_t treeChangeCounter = this->GetTreeChangeCounter();
+    if (!m_idIndexValid || (m_idIndexTreeChangeCounter != treeChangeCounter)) {
+        m_idIndexValid = false;
+        // The tree was changed since the previous look up - for example during import or editing where
+        // look ups and changes alternate - rebuilding the index would be more expensive than searching
+        if (m_idLookUpTreeChangeCounter != treeChangeCounter) {
+            m_idLookUpTreeChangeCounter = treeChangeCounter;
+            return false;
+        }
+        m_idIndex.clear();
+        IndexIDsFunctor indexIDs(&m_idIndex);
+        indexIDs.SetVisibleOnly(false);
+        this->Process(indexIDs, UNLIMITED_DEPTH, true);
+        m_idIndexHasDuplicates = indexIDs.HasDuplicates();
+        m_idIndexTreeChangeCounter = treeChangeCounter;
+        m_idIndexValid = true;
+    }
+
+    // With duplicated ids, the element found depends on the object the search starts from
+    if (m_idIndexHasDuplicates) return false;
+
+    MapOfStrConstObjects::const_iterator iter = m_idIndex.find(id);
+    element = (iter != m_idIndex.end()) ? iter->second : NULL;
+    return true;
+}
+
+const ArrayOfConstObjects *Doc::FindIndexedByType(const Object *root, ClassId classId) const
+{
+    assert(root);
+
+    const uint32_t treeChangeCounter = this->GetTreeChangeCounter();
+    if (!m_classIdIndexValid || (m_classIdIndexTreeChangeCounter != treeChangeCounter)) {
+        // See Doc::FindIndexedByID
+        if (m_classIdLookUpTreeChangeCounter != treeChangeCounter) {
+            m_classIdIndexValid = false;
+            m_classIdLookUpTreeChangeCounter = treeChangeCounter;
+            return NULL;
+        }
+        this->IndexClassIds();
+    }
+
+    static const ArrayOfConstObjects noDescendants;
+
+    // Only the document and its pages are indexed
+    std::map<const Object *, MapOfClassIdConstObjects>::const_iterator rootIter = m_classIdIndex.find(root);
+    if (rootIter == m_classIdIndex.end()) return (root == this) ? &noDescendants : NULL;
+
+    MapOfClassIdConstObjects::const_iterator iter = rootIter->second.find(classId);
+    return (iter != rootIter->second.end()) ? &iter->second : &noDescendants;
+}
+
+bool Doc::HasDescendantOfType(const std::vector<ClassId> &classIds) const
+{
+    this->IndexClassIds();
+
+    const MapOfClassIdConstObjects &docIndex = m_classIdIndex.at(this);
+    return std::any_of(
+        classIds.begin(), classIds.end(), [&docIndex](ClassId classId) { return (docIndex.count(classId) > 0); });
+}
+
+void Doc::IndexClassIds() const
+{
+    const uint32_t treeChangeCounter = this->GetTreeChangeCounter();
+    if (m_classIdIndexValid && (m_classIdIndexTreeChangeCounter == treeChangeCounter)) return;
+
+    m_classIdIndex.clear();
+    IndexClassIdsFunctor indexClassIds(this, &m_classIdIndex);
+    this->Process(indexClassIds, UNLIMITED_DEPTH, true);
+    m_classIdIndexTreeChangeCounter = treeChangeCounter;
+    m_classIdLookUpTreeChangeCounter = treeChangeCounter;
+    m_classIdIndexValid = true;
+}
+
 bool Doc::HasPage(int pageIdx) const
 {
     const Pages *pages = this->GetPages();
@@ -71,6 +71,14 @@ void EditorialElement::Reset()
     m_visibility = Visible;
 }
 
+void EditorialElement::SetVisibility(VisibilityType visibility)
+{
+    if (m_visibility == visibility) return;
+
+    m_visibility = visibility;
+    this->NotifyTreeChange();
+}
+
 EditorialElement::~EditorialElement() {}
 
 bool EditorialElement::IsSupportedChild(Object *child)
@@ -215,7 +215,10 @@ bool EditorToolkitCMN::Delete(std::string &elementId)
     if (!element) return false;
 
     if (element->Is(NOTE)) {
-        return this->DeleteNote(vrv_cast<Note *>(element));
+        Object *measure = element->GetFirstAncestor(MEASURE);
+        if (!this->DeleteNote(vrv_cast<Note *>(element))) return false;
+        if (measure) m_doc->MarkLayoutDirty(measure);
+        return true;
     }
     return false;
 }
@@ -234,6 +237,7 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
         element->GetPitchInterface()->SetPname(pname);
         element->GetPitchInterface()->SetOct(oct);
+        m_doc->MarkLayoutDirty(element);
 
         return true;
     }
@@ -256,6 +260,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
             default: step = 0;
         }
         interface->AdjustPitchByOffset(step);
+        m_doc->MarkLayoutDirty(element);
         return true;
     }
     return false;
@@ -306,6 +311,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     measure->AddChild(element);
     interface->SetStartid("#" + startid);
     interface->SetEndid("#" + endid);
+    m_doc->MarkLayoutDirty(measure);
 
     m_chainedId = element->GetID();
     m_editInfo.import("uuid", element->GetID());
@@ -324,7 +330,10 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         return false;
     }
     if (elementType == "note") {
-        return this->InsertNote(start);
+        Object *measure = start->GetFirstAncestor(MEASURE);
+        if (!this->InsertNote(start)) return false;
+        if (measure) m_doc->MarkLayoutDirty(measure);
+        return true;
     }
     // Check if it is a LayerElement
     if (!dynamic_cast<LayerElement *>(start)) {
@@ -352,6 +361,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     assert(interface);
     measure->AddChild(element);
     interface->SetStartid("#" + startid);
+    m_doc->MarkLayoutDirty(measure);
 
     m_chainedId = element->GetID();
     m_editInfo.import("uuid", element->GetID());
@@ -394,6 +404,7 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     else if (AttModule::SetVisual(element, attribute, value))
         success = true;
     if (success) {
+        m_doc->MarkLayoutDirty(element);
         return true;
     }
     return false;
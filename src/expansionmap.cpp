@@ -115,11 +115,11 @@ void ExpansionMap::Expand(const xsdAnyURI_List &expansionList, xsdAnyURI_List &e
         assert(currSect);
         if (currSect->Is(ENDING) || currSect->Is(SECTION)) {
             SystemElement *tmp = dynamic_cast<SystemElement *>(currSect);
-            tmp->m_visibility = Hidden;
+            tmp->SetVisibility(Hidden);
         }
         else if (currSect->Is(LEM) || currSect->Is(RDG)) {
             EditorialElement *tmp = dynamic_cast<EditorialElement *>(currSect);
-            tmp->m_visibility = Hidden;
+            tmp->SetVisibility(Hidden);
         }
     }
 }
@@ -9,7 +9,9 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <fstream>
 #include <iostream>
 
 //----------------------------------------------------------------------------
@@ -60,11 +62,9 @@ void FeatureExtractor::Extract(const Object *object)
         // Check if the note is tied to a previous one and skip it if yes
         if (note->GetScoreTimeTiedDuration() == -1.0) {
             // Check if we need to add it to the previous interval ids
-            const int intervalsIdsSize = (int)m_intervalsIds.size();
-            if (intervalsIdsSize > 0) m_intervalsIds.get<jsonxx::Array>(intervalsIdsSize - 1) << note->GetID();
+            if (!m_intervalsIds.empty()) m_intervalsIds.back().push_back(note->GetID());
             // Same for pitch ids
-            const int pitchesIdsSize = (int)m_pitchesIds.size();
-            if (pitchesIdsSize > 0) m_pitchesIds.get<jsonxx::Array>(pitchesIdsSize - 1) << note->GetID();
+            if (!m_pitchesIds.empty()) m_pitchesIds.back().push_back(note->GetID());
             m_previousNotes.push_back(note);
             return;
         }
@@ -104,37 +104,35 @@ void FeatureExtractor::Extract(const Object *object)
         std::transform(pname.begin(), pname.end(), pname.begin(), ::toupper);
         pitch << pname;
 
-        m_pitchesChromatic << pitch.str();
-        m_pitchesDiatonic << pname;
-        jsonxx::Array pitchesIds;
-        pitchesIds << note->GetID();
-        m_pitchesIds << jsonxx::Value(pitchesIds);
+        m_pitchesChromatic.push_back(pitch.str());
+        m_pitchesDiatonic.push_back(pname);
+        m_pitchesIds.push_back({ note->GetID() });
 
         // We have a previous note (or more with tied notes), so we can calculate an interval
         if (!m_previousNotes.empty()) {
             const int intervalChromatic = note->GetMIDIPitch() - m_previousNotes.front()->GetMIDIPitch();
             if (intervalChromatic == 0) {
-                m_intervalGrossContour << "s";
-                m_intervalRefinedContour << "s";
+                m_intervalGrossContour.push_back("s");
+                m_intervalRefinedContour.push_back("s");
             }
             else if (intervalChromatic < 0) {
-                m_intervalGrossContour << "D";
-                m_intervalRefinedContour << ((intervalChromatic < -2) ? "D" : "d");
+                m_intervalGrossContour.push_back("D");
+                m_intervalRefinedContour.push_back((intervalChromatic < -2) ? "D" : "d");
             }
             else {
-                m_intervalGrossContour << "U";
-                m_intervalRefinedContour << ((intervalChromatic > 2) ? "U" : "u");
+                m_intervalGrossContour.push_back("U");
+                m_intervalRefinedContour.push_back((intervalChromatic > 2) ? "U" : "u");
             }
-            m_intervalsChromatic << StringFormat("%d", intervalChromatic);
+            m_intervalsChromatic.push_back(StringFormat("%d", intervalChromatic));
             std::string intervalDiatonicStr
                 = StringFormat("%d", note->GetDiatonicPitch() - m_previousNotes.front()->GetDiatonicPitch());
-            m_intervalsDiatonic << intervalDiatonicStr;
-            jsonxx::Array intervalsIds;
+            m_intervalsDiatonic.push_back(intervalDiatonicStr);
+            std::vector<std::string> intervalsIds;
             for (const Note *previousNote : m_previousNotes) {
-                intervalsIds << previousNote->GetID();
+                intervalsIds.push_back(previousNote->GetID());
             }
-            intervalsIds << note->GetID();
-            m_intervalsIds << jsonxx::Value(intervalsIds);
+            intervalsIds.push_back(note->GetID());
+            m_intervalsIds.push_back(intervalsIds);
         }
         m_previousNotes.clear();
         m_previousNotes.push_back(note);
@@ -145,18 +143,554 @@ void FeatureExtractor::ToJson(std::string &output)
 {
     jsonxx::Object o;
 
-    o << "pitchesChromatic" << m_pitchesChromatic;
-    o << "pitchesDiatonic" << m_pitchesDiatonic;
-    o << "pitchesIds" << m_pitchesIds;
+    o << "pitchesChromatic" << ToJsonArray(m_pitchesChromatic);
+    o << "pitchesDiatonic" << ToJsonArray(m_pitchesDiatonic);
+    o << "pitchesIds" << ToJsonArray(m_pitchesIds);
 
-    o << "intervalsChromatic" << m_intervalsChromatic;
-    o << "intervalsDiatonic" << m_intervalsDiatonic;
-    o << "intervalGrossContour" << m_intervalGrossContour;
-    o << "intervalRefinedContour" << m_intervalRefinedContour;
-    o << "intervalsIds" << m_intervalsIds;
+    o << "intervalsChromatic" << ToJsonArray(m_intervalsChromatic);
+    o << "intervalsDiatonic" << ToJsonArray(m_intervalsDiatonic);
+    o << "intervalGrossContour" << ToJsonArray(m_intervalGrossContour);
+    o << "intervalRefinedContour" << ToJsonArray(m_intervalRefinedContour);
+    o << "intervalsIds" << ToJsonArray(m_intervalsIds);
 
     output = o.json();
     LogDebug("%s", output.c_str());
 }
 
+void FeatureExtractor::ToCompactJson(std::string &output) const
+{
+    // Same keys in the same (alphabetical) order as the jsonxx output of ToJson
+    output = "{\"intervalGrossContour\":";
+    AppendCompactArray(output, m_intervalGrossContour);
+    output += ",\"intervalRefinedContour\":";
+    AppendCompactArray(output, m_intervalRefinedContour);
+    output += ",\"intervalsChromatic\":";
+    AppendCompactArray(output, m_intervalsChromatic);
+    output += ",\"intervalsDiatonic\":";
+    AppendCompactArray(output, m_intervalsDiatonic);
+    output += ",\"intervalsIds\":";
+    AppendCompactArray(output, m_intervalsIds);
+    output += ",\"pitchesChromatic\":";
+    AppendCompactArray(output, m_pitchesChromatic);
+    output += ",\"pitchesDiatonic\":";
+    AppendCompactArray(output, m_pitchesDiatonic);
+    output += ",\"pitchesIds\":";
+    AppendCompactArray(output, m_pitchesIds);
+    output += "}";
+}
+
+void FeatureExtractor::AppendCompactArray(std::string &output, const std::vector<std::string> &values)
+{
+    output.push_back('[');
+    for (auto iter = values.begin(); iter != values.end(); ++iter) {
+        if (iter != values.begin()) output.push_back(',');
+        output.push_back('"');
+        // Pitches, intervals and IDs do not have characters to escape, but an ID could have in theory
+        for (const char c : *iter) {
+            if ((c == '"') || (c == '\\')) {
+                output.push_back('\\');
+                output.push_back(c);
+            }
+            else if ((unsigned char)c < 0x20) {
+                output += StringFormat("\\u%04x", c);
+            }
+            else {
+                output.push_back(c);
+            }
+        }
+        output.push_back('"');
+    }
+    output.push_back(']');
+}
+
+void FeatureExtractor::AppendCompactArray(std::string &output, const std::vector<std::vector<std::string>> &values)
+{
+    output.push_back('[');
+    for (auto iter = values.begin(); iter != values.end(); ++iter) {
+        if (iter != values.begin()) output.push_back(',');
+        AppendCompactArray(output, *iter);
+    }
+    output.push_back(']');
+}
+
+jsonxx::Array FeatureExtractor::ToJsonArray(const std::vector<std::string> &values)
+{
+    jsonxx::Array array;
+    for (const std::string &value : values) array << value;
+    return array;
+}
+
+jsonxx::Array FeatureExtractor::ToJsonArray(const std::vector<std::vector<std::string>> &values)
+{
+    jsonxx::Array array;
+    for (const std::vector<std::string> &value : values) array << jsonxx::Value(ToJsonArray(value));
+    return array;
+}
+
+//----------------------------------------------------------------------------
+// FeatureIndex
+//----------------------------------------------------------------------------
+
+// The names of the features in the order of FeatureIndex::Feature
+static const char *const featureNames[]
+    = { "pitchesChromatic", "pitchesDiatonic", "intervalsChromatic", "intervalsDiatonic", "intervalGrossContour",
+          "intervalRefinedContour" };
+
+// The number of bits of each token in the n-gram keys
+static const int featureIndexTokenBits = 64 / FEATURE_INDEX_NGRAM_LENGTH;
+
+static const char featureIndexMagic[8] = { 'V', 'R', 'V', 'F', 'I', 'D', 'X', '\0' };
+static const uint32_t featureIndexVersion = 1;
+
+// Helpers for reading and writing the index file
+static void WriteUInt32(std::ostream &output, uint32_t value)
+{
+    output.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+static void WriteString(std::ostream &output, const std::string &value)
+{
+    WriteUInt32(output, (uint32_t)value.size());
+    output.write(value.data(), value.size());
+}
+
+template <typename T> static void WriteVector(std::ostream &output, const std::vector<T> &values)
+{
+    WriteUInt32(output, (uint32_t)values.size());
+    output.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+static void WriteStrings(std::ostream &output, const std::vector<std::string> &values)
+{
+    WriteUInt32(output, (uint32_t)values.size());
+    for (const std::string &value : values) WriteString(output, value);
+}
+
+static bool ReadUInt32(std::istream &input, uint32_t &value)
+{
+    return (bool)input.read(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+// The sizes read are checked against the file size before allocating, since the values cannot take more bytes
+static bool ReadString(std::istream &input, std::string &value, uint64_t fileSize)
+{
+    uint32_t size;
+    if (!ReadUInt32(input, size) || (size > fileSize)) return false;
+    value.resize(size);
+    return (bool)input.read(value.data(), size);
+}
+
+template <typename T> static bool ReadVector(std::istream &input, std::vector<T> &values, uint64_t fileSize)
+{
+    uint32_t size;
+    if (!ReadUInt32(input, size) || (size > fileSize / sizeof(T))) return false;
+    values.resize(size);
+    return (bool)input.read(reinterpret_cast<char *>(values.data()), size * sizeof(T));
+}
+
+static bool ReadStrings(std::istream &input, std::vector<std::string> &values, uint64_t fileSize)
+{
+    uint32_t size;
+    if (!ReadUInt32(input, size) || (size > fileSize / sizeof(uint32_t))) return false;
+    values.resize(size);
+    for (std::string &value : values) {
+        if (!ReadString(input, value, fileSize)) return false;
+    }
+    return true;
+}
+
+FeatureIndex::FeatureIndex()
+{
+    this->Reset();
+}
+
+FeatureIndex::~FeatureIndex() {}
+
+void FeatureIndex::Reset()
+{
+    m_documents.clear();
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        m_vocabularies[feature].clear();
+        m_tokens[feature].clear();
+        m_postings[feature] = Postings();
+    }
+    m_isFinalized = true;
+}
+
+bool FeatureIndex::AddDocument(const std::string &docId, const FeatureExtractor &extractor)
+{
+    const std::vector<std::string> *values[FEATURE_COUNT] = { &extractor.m_pitchesChromatic,
+        &extractor.m_pitchesDiatonic, &extractor.m_intervalsChromatic, &extractor.m_intervalsDiatonic,
+        &extractor.m_intervalGrossContour, &extractor.m_intervalRefinedContour };
+
+    Document &document = m_documents.emplace_back();
+    document.m_id = docId;
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        document.m_sequences[feature].reserve(values[feature]->size());
+        for (const std::string &value : *values[feature]) {
+            uint32_t token = 0;
+            if (!this->GetToken(feature, value, token)) {
+                LogError("Too many distinct values for the feature '%s' in the feature index, '%s' not added",
+                    featureNames[feature], docId.c_str());
+                m_documents.pop_back();
+                return false;
+            }
+            document.m_sequences[feature].push_back(token);
+        }
+    }
+    document.m_pitchesIds = extractor.m_pitchesIds;
+    document.m_intervalsIds = extractor.m_intervalsIds;
+
+    m_isFinalized = false;
+    return true;
+}
+
+bool FeatureIndex::GetToken(int feature, const std::string &value, uint32_t &token)
+{
+    auto iter = m_tokens[feature].find(value);
+    if (iter != m_tokens[feature].end()) {
+        token = iter->second;
+        return true;
+    }
+    // Tokens start at 1 since 0 marks the missing tokens of the n-grams at the end of the sequences
+    token = (uint32_t)m_vocabularies[feature].size() + 1;
+    if (token >= (1u << featureIndexTokenBits)) return false;
+    m_tokens[feature].emplace(value, token);
+    m_vocabularies[feature].push_back(value);
+    return true;
+}
+
+uint64_t FeatureIndex::GetKey(const uint32_t *tokens, int count)
+{
+    assert(count <= FEATURE_INDEX_NGRAM_LENGTH);
+
+    uint64_t key = 0;
+    for (int i = 0; i < FEATURE_INDEX_NGRAM_LENGTH; ++i) {
+        key <<= featureIndexTokenBits;
+        if (i < count) key |= tokens[i];
+    }
+    return key;
+}
+
+void FeatureIndex::Finalize()
+{
+    if (m_isFinalized) return;
+
+    // Each position of a sequence is indexed with the n-gram starting there, which is shorter at the end
+    struct Entry {
+        uint64_t m_key;
+        uint32_t m_document;
+        uint32_t m_position;
+    };
+    std::vector<Entry> entries;
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        entries.clear();
+        for (int i = 0; i < (int)m_documents.size(); ++i) {
+            const std::vector<uint32_t> &sequence = m_documents.at(i).m_sequences[feature];
+            for (int position = 0; position < (int)sequence.size(); ++position) {
+                const int count = std::min(FEATURE_INDEX_NGRAM_LENGTH, (int)sequence.size() - position);
+                entries.push_back({ GetKey(sequence.data() + position, count), (uint32_t)i, (uint32_t)position });
+            }
+        }
+        // The entries are created by document and position, so a stable sort keeps them in that order for each key
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const Entry &entry1, const Entry &entry2) { return (entry1.m_key < entry2.m_key); });
+
+        Postings &postings = m_postings[feature];
+        postings = Postings();
+        postings.m_entries.reserve(entries.size() * 2);
+        for (const Entry &entry : entries) {
+            if (postings.m_keys.empty() || (postings.m_keys.back() != entry.m_key)) {
+                postings.m_keys.push_back(entry.m_key);
+                postings.m_offsets.push_back((uint32_t)postings.m_entries.size() / 2);
+            }
+            postings.m_entries.push_back(entry.m_document);
+            postings.m_entries.push_back(entry.m_position);
+        }
+        postings.m_offsets.push_back((uint32_t)postings.m_entries.size() / 2);
+    }
+
+    m_isFinalized = true;
+}
+
+bool FeatureIndex::Write(const std::string &filename)
+{
+    this->Finalize();
+
+    std::ofstream output(filename, std::ios::binary);
+    if (!output.is_open()) {
+        LogError("Unable to write the feature index to '%s'", filename.c_str());
+        return false;
+    }
+
+    output.write(featureIndexMagic, sizeof(featureIndexMagic));
+    WriteUInt32(output, featureIndexVersion);
+    WriteUInt32(output, FEATURE_INDEX_NGRAM_LENGTH);
+
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        WriteStrings(output, m_vocabularies[feature]);
+    }
+
+    WriteUInt32(output, (uint32_t)m_documents.size());
+    for (const Document &document : m_documents) {
+        WriteString(output, document.m_id);
+        for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+            WriteVector(output, document.m_sequences[feature]);
+        }
+        for (const auto *ids : { &document.m_pitchesIds, &document.m_intervalsIds }) {
+            WriteUInt32(output, (uint32_t)ids->size());
+            for (const std::vector<std::string> &noteIds : *ids) WriteStrings(output, noteIds);
+        }
+    }
+
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        WriteVector(output, m_postings[feature].m_keys);
+        WriteVector(output, m_postings[feature].m_offsets);
+        WriteVector(output, m_postings[feature].m_entries);
+    }
+
+    return (bool)output;
+}
+
+bool FeatureIndex::Read(const std::string &filename)
+{
+    this->Reset();
+
+    std::ifstream input(filename, std::ios::binary);
+    if (!input.is_open()) {
+        LogError("Unable to read the feature index from '%s'", filename.c_str());
+        return false;
+    }
+
+    char magic[sizeof(featureIndexMagic)];
+    uint32_t version = 0;
+    uint32_t ngramLength = 0;
+    if (!input.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), featureIndexMagic)
+        || !ReadUInt32(input, version) || (version != featureIndexVersion) || !ReadUInt32(input, ngramLength)
+        || (ngramLength != FEATURE_INDEX_NGRAM_LENGTH)) {
+        LogError("The file '%s' is not a feature index supported by this version", filename.c_str());
+        return false;
+    }
+
+    input.seekg(0, std::ios::end);
+    const uint64_t fileSize = (uint64_t)input.tellg();
+    input.seekg(sizeof(magic) + 2 * sizeof(uint32_t));
+
+    bool success = (bool)input;
+    for (int feature = 0; success && (feature < FEATURE_COUNT); ++feature) {
+        success = ReadStrings(input, m_vocabularies[feature], fileSize);
+        for (int i = 0; success && (i < (int)m_vocabularies[feature].size()); ++i) {
+            m_tokens[feature][m_vocabularies[feature].at(i)] = i + 1;
+        }
+    }
+
+    // Each document takes at least the sizes of its ID, sequences and IDs
+    uint32_t documentCount = 0;
+    success = success && ReadUInt32(input, documentCount)
+        && (documentCount <= fileSize / ((1 + FEATURE_COUNT + 2) * sizeof(uint32_t)));
+    if (success) m_documents.resize(documentCount);
+    for (Document &document : m_documents) {
+        if (!success) break;
+        success = ReadString(input, document.m_id, fileSize);
+        for (int feature = 0; success && (feature < FEATURE_COUNT); ++feature) {
+            success = ReadVector(input, document.m_sequences[feature], fileSize);
+        }
+        for (auto *ids : { &document.m_pitchesIds, &document.m_intervalsIds }) {
+            uint32_t size = 0;
+            success = success && ReadUInt32(input, size) && (size <= fileSize / sizeof(uint32_t));
+            if (success) ids->resize(size);
+            for (std::vector<std::string> &noteIds : *ids) {
+                success = success && ReadStrings(input, noteIds, fileSize);
+            }
+        }
+    }
+
+    for (int feature = 0; success && (feature < FEATURE_COUNT); ++feature) {
+        Postings &postings = m_postings[feature];
+        success = ReadVector(input, postings.m_keys, fileSize) && ReadVector(input, postings.m_offsets, fileSize)
+            && ReadVector(input, postings.m_entries, fileSize);
+    }
+
+    if (!success || !this->IsValid()) {
+        LogError("The feature index '%s' could not be read", filename.c_str());
+        this->Reset();
+        return false;
+    }
+    return true;
+}
+
+bool FeatureIndex::IsValid() const
+{
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        const uint32_t vocabularySize = (uint32_t)m_vocabularies[feature].size();
+        if (vocabularySize >= (1u << featureIndexTokenBits)) return false;
+        for (const Document &document : m_documents) {
+            for (uint32_t token : document.m_sequences[feature]) {
+                if ((token == 0) || (token > vocabularySize)) return false;
+            }
+        }
+
+        // The keys are sorted and the offsets are ranges of (document, position) pairs covering all the entries
+        const Postings &postings = m_postings[feature];
+        if ((postings.m_offsets.size() != postings.m_keys.size() + 1) || (postings.m_offsets.front() != 0)
+            || (postings.m_entries.size() % 2 != 0) || (postings.m_offsets.back() != postings.m_entries.size() / 2)) {
+            return false;
+        }
+        for (int i = 1; i < (int)postings.m_keys.size(); ++i) {
+            if (postings.m_keys.at(i - 1) >= postings.m_keys.at(i)) return false;
+        }
+        for (int i = 1; i < (int)postings.m_offsets.size(); ++i) {
+            if (postings.m_offsets.at(i - 1) > postings.m_offsets.at(i)) return false;
+        }
+        for (int i = 0; i < (int)postings.m_entries.size(); i += 2) {
+            const uint32_t document = postings.m_entries.at(i);
+            if (document >= m_documents.size()) return false;
+            if (postings.m_entries.at(i + 1) >= m_documents.at(document).m_sequences[feature].size()) return false;
+        }
+    }
+    return true;
+}
+
+std::string FeatureIndex::Query(const std::string &jsonQuery)
+{
+    this->Finalize();
+
+    jsonxx::Object result;
+    jsonxx::Object query;
+    if (!query.parse(jsonQuery) || !query.has<jsonxx::String>("feature") || !query.has<jsonxx::Array>("values")) {
+        LogError("A feature index query requires a 'feature' and an array of 'values'");
+        return result.json();
+    }
+
+    const std::string featureName = query.get<jsonxx::String>("feature");
+    const int feature = (int)(std::find(featureNames, featureNames + FEATURE_COUNT, featureName) - featureNames);
+    if (feature == FEATURE_COUNT) {
+        LogError("Unsupported feature '%s' in the feature index query", featureName.c_str());
+        return result.json();
+    }
+    const int limit = query.has<jsonxx::Number>("limit") ? (int)query.get<jsonxx::Number>("limit") : 100;
+
+    // Values unknown to the vocabulary cannot match anything
+    std::vector<uint32_t> tokens;
+    const jsonxx::Array &values = query.get<jsonxx::Array>("values");
+    for (int i = 0; i < (int)values.size(); ++i) {
+        std::string value;
+        if (values.has<jsonxx::String>(i)) {
+            value = values.get<jsonxx::String>(i);
+        }
+        else if (values.has<jsonxx::Number>(i)) {
+            value = StringFormat("%d", (int)values.get<jsonxx::Number>(i));
+        }
+        auto iter = m_tokens[feature].find(value);
+        if (iter == m_tokens[feature].end()) {
+            tokens.clear();
+            break;
+        }
+        tokens.push_back(iter->second);
+    }
+
+    // The matches as (document, position) pairs, sorted
+    std::vector<std::pair<uint32_t, uint32_t>> matches;
+    int documentCount = 0;
+    const Postings &postings = m_postings[feature];
+    const int length = (int)tokens.size();
+    if (length >= FEATURE_INDEX_NGRAM_LENGTH) {
+        // Look up the least frequent n-gram of the query and check the rest of the query in the documents
+        int bestOffset = -1;
+        int bestIndex = 0;
+        for (int offset = 0; offset + FEATURE_INDEX_NGRAM_LENGTH <= length; ++offset) {
+            const uint64_t key = GetKey(tokens.data() + offset, FEATURE_INDEX_NGRAM_LENGTH);
+            auto iter = std::lower_bound(postings.m_keys.begin(), postings.m_keys.end(), key);
+            if ((iter == postings.m_keys.end()) || (*iter != key)) {
+                bestOffset = -1;
+                break;
+            }
+            const int index = (int)(iter - postings.m_keys.begin());
+            if ((bestOffset == -1)
+                || (postings.m_offsets.at(index + 1) - postings.m_offsets.at(index)
+                    < postings.m_offsets.at(bestIndex + 1) - postings.m_offsets.at(bestIndex))) {
+                bestOffset = offset;
+                bestIndex = index;
+            }
+        }
+        if (bestOffset != -1) {
+            for (uint32_t i = postings.m_offsets.at(bestIndex); i < postings.m_offsets.at(bestIndex + 1); ++i) {
+                const uint32_t document = postings.m_entries.at(2 * i);
+                const uint32_t position = postings.m_entries.at(2 * i + 1);
+                if (position < (uint32_t)bestOffset) continue;
+                const std::vector<uint32_t> &sequence = m_documents.at(document).m_sequences[feature];
+                const uint32_t start = position - bestOffset;
+                if (start + length > sequence.size()) continue;
+                if (std::equal(tokens.begin(), tokens.end(), sequence.begin() + start)) {
+                    if (matches.empty() || (matches.back().first != document)) ++documentCount;
+                    matches.push_back({ document, start });
+                }
+            }
+        }
+    }
+    else if (length > 0) {
+        // Shorter queries match all the n-grams starting with them, which are contiguous in the keys
+        const uint64_t low = GetKey(tokens.data(), length);
+        const uint64_t high = low + (uint64_t(1) << (featureIndexTokenBits * (FEATURE_INDEX_NGRAM_LENGTH - length)));
+        const int first
+            = (int)(std::lower_bound(postings.m_keys.begin(), postings.m_keys.end(), low) - postings.m_keys.begin());
+        const int last
+            = (int)(std::lower_bound(postings.m_keys.begin(), postings.m_keys.end(), high) - postings.m_keys.begin());
+        const uint32_t begin = postings.m_offsets.at(first);
+        const uint32_t end = postings.m_offsets.at(last);
+        // These can be most of the postings, so only the matches of the documents returned are sorted
+        std::vector<bool> matched(m_documents.size(), false);
+        for (uint32_t i = begin; i < end; ++i) {
+            matched.at(postings.m_entries.at(2 * i)) = true;
+        }
+        uint32_t lastDocument = 0;
+        for (uint32_t document = 0; document < matched.size(); ++document) {
+            if (!matched.at(document)) continue;
+            ++documentCount;
+            if (documentCount <= limit) lastDocument = document;
+        }
+        for (uint32_t i = begin; i < end; ++i) {
+            if (postings.m_entries.at(2 * i) > lastDocument) continue;
+            matches.push_back({ postings.m_entries.at(2 * i), postings.m_entries.at(2 * i + 1) });
+        }
+        std::sort(matches.begin(), matches.end());
+    }
+
+    jsonxx::Array documents;
+    for (auto iter = matches.begin(); (iter != matches.end()) && ((int)documents.size() < limit);) {
+        const uint32_t document = iter->first;
+        jsonxx::Array noteIds;
+        for (; (iter != matches.end()) && (iter->first == document); ++iter) {
+            this->AppendMatch(noteIds, m_documents.at(document), feature, iter->second, length);
+        }
+        jsonxx::Object o;
+        o << "docId" << m_documents.at(document).m_id;
+        o << "noteIds" << noteIds;
+        documents << o;
+    }
+
+    result << "count" << documentCount;
+    result << "documents" << documents;
+    return result.json();
+}
+
+void FeatureIndex::AppendMatch(
+    jsonxx::Array &matches, const Document &document, int feature, int position, int length) const
+{
+    const std::vector<std::vector<std::string>> &ids
+        = (feature <= PITCHES_DIATONIC) ? document.m_pitchesIds : document.m_intervalsIds;
+
+    // Consecutive intervals share the notes between them
+    std::vector<std::string> noteIds;
+    for (int i = position; (i < position + length) && (i < (int)ids.size()); ++i) {
+        for (const std::string &id : ids.at(i)) {
+            if (std::find(noteIds.begin(), noteIds.end(), id) == noteIds.end()) noteIds.push_back(id);
+        }
+    }
+
+    jsonxx::Array match;
+    for (const std::string &id : noteIds) match << id;
+    matches << jsonxx::Value(match);
+}
+
 } // namespace vrv
@@ -10,8 +10,10 @@
 //----------------------------------------------------------------------------
 
 #include "comparison.h"
+#include "doc.h"
 #include "layer.h"
 #include "object.h"
+#include "page.h"
 #include "plistinterface.h"
 
 namespace vrv {
@@ -351,4 +353,74 @@ FunctorCode AddToFlatListFunctor::VisitObject(const Object *object)
     return FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// IndexIDsFunctor
+//----------------------------------------------------------------------------
+
+IndexIDsFunctor::IndexIDsFunctor(MapOfStrConstObjects *idIndex) : ConstFunctor()
+{
+    m_idIndex = idIndex;
+    m_hasDuplicates = false;
+}
+
+FunctorCode IndexIDsFunctor::VisitObject(const Object *object)
+{
+    if (!m_idIndex->emplace(object->GetID(), object).second) {
+        m_hasDuplicates = true;
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+//----------------------------------------------------------------------------
+// IndexClassIdsFunctor
+//----------------------------------------------------------------------------
+
+IndexClassIdsFunctor::IndexClassIdsFunctor(
+    const Doc *doc, std::map<const Object *, MapOfClassIdConstObjects> *classIdIndex)
+    : ConstFunctor()
+{
+    m_classIdIndex = classIdIndex;
+    m_docIndex = &(*m_classIdIndex)[doc];
+    m_pageIndex = NULL;
+}
+
+FunctorCode IndexClassIdsFunctor::VisitObject(const Object *object)
+{
+    (*m_docIndex)[object->GetClassId()].push_back(object);
+    if (m_pageIndex) (*m_pageIndex)[object->GetClassId()].push_back(object);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode IndexClassIdsFunctor::VisitPage(const Page *page)
+{
+    this->VisitObject(page);
+    m_pageIndex = &(*m_classIdIndex)[page];
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode IndexClassIdsFunctor::VisitPageEnd(const Page *page)
+{
+    m_pageIndex = NULL;
+
+    return FUNCTOR_CONTINUE;
+}
+
+//----------------------------------------------------------------------------
+// CollectClassIdsFunctor
+//----------------------------------------------------------------------------
+
+CollectClassIdsFunctor::CollectClassIdsFunctor() : ConstFunctor() {}
+
+FunctorCode CollectClassIdsFunctor::VisitObject(const Object *object)
+{
+    auto [iter, inserted] = m_classIds.try_emplace(object->GetClassId(), "", 0);
+    if (inserted) iter->second.first = object->GetClassName();
+    ++iter->second.second;
+
+    return FUNCTOR_CONTINUE;
+}
+
 } // namespace vrv
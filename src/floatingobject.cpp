@@ -45,12 +45,6 @@
 
 namespace vrv {
 
-//----------------------------------------------------------------------------
-// Static members
-//----------------------------------------------------------------------------
-
-thread_local std::vector<void *> FloatingObject::s_drawingObjectIds;
-
 //----------------------------------------------------------------------------
 // FloatingObject
 //----------------------------------------------------------------------------
@@ -133,11 +127,6 @@ void FloatingObject::SetMaxDrawingYRel(int maxDrawingYRel, data_STAFFREL place)
     }
 }
 
-void FloatingObject::ResetDrawingObjectIDs()
-{
-    FloatingObject::s_drawingObjectIds.clear();
-}
-
 void FloatingObject::SetCurrentFloatingPositioner(FloatingPositioner *boundingBox)
 {
     m_currentPositioner = boundingBox;
@@ -159,16 +148,20 @@ int FloatingObject::SetDrawingGrpObject(void *drawingGrpObject)
 {
     assert(drawingGrpObject);
 
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+    std::vector<void *> &drawingGrpObjects = doc->m_drawingGrpObjects;
+
     int idx = 0;
     std::vector<void *>::const_iterator it
-        = std::find(s_drawingObjectIds.begin(), s_drawingObjectIds.end(), drawingGrpObject);
-    if (it == s_drawingObjectIds.end()) {
-        idx = (int)s_drawingObjectIds.size();
-        s_drawingObjectIds.push_back(drawingGrpObject);
+        = std::find(drawingGrpObjects.begin(), drawingGrpObjects.end(), drawingGrpObject);
+    if (it == drawingGrpObjects.end()) {
+        idx = (int)drawingGrpObjects.size();
+        drawingGrpObjects.push_back(drawingGrpObject);
         // LogDebug("Creating grpId %d", idx);
     }
     else {
-        idx = (int)(it - s_drawingObjectIds.begin());
+        idx = (int)(it - drawingGrpObjects.begin());
         // LogDebug("Using grpId %d", idx);
     }
     m_drawingGrpId = idx + 1000;
@@ -58,8 +58,26 @@ const Alignment *HorizontalAligner::SearchAlignmentAtTime(double time, Alignment
 {
     idx = -1; // the index if we reach the end.
     const Alignment *alignment = NULL;
-    // First try to see if we already have something at the time position
-    for (int i = 0; i < this->GetAlignmentCount(); ++i) {
+
+    // The alignments are ordered by time, so we can look for the first one at or after the time position with a
+    // binary search. This skips all the alignments before, which the loop below would go through without stopping.
+    int first = 0;
+    int count = this->GetAlignmentCount();
+    while (count > 0) {
+        const int step = count / 2;
+        alignment = vrv_cast<const Alignment *>(this->GetChild(first + step));
+        assert(alignment);
+        if ((alignment->GetTime() < time) && !AreEqual(alignment->GetTime(), time)) {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else {
+            count = step;
+        }
+    }
+
+    // Then try to see if we already have something at the time position
+    for (int i = first; i < this->GetAlignmentCount(); ++i) {
         alignment = vrv_cast<const Alignment *>(this->GetChild(i));
         assert(alignment);
 
@@ -686,6 +686,21 @@ string HumdrumInput::GetHumdrumString()
     return tempout.str();
 }
 
+//////////////////////////////
+//
+// HumdrumInput::MoveHumdrumFiles -- Transfer the ownership of the
+//    parsed Humdrum files, so that they can be serialized later only
+//    if the Humdrum data is requested.
+//
+
+void HumdrumInput::MoveHumdrumFiles(hum::HumdrumFileSet &infiles)
+{
+    for (int i = 0; i < m_infiles.getCount(); ++i) {
+        infiles.appendHumdrumPointer(&m_infiles[i]);
+    }
+    m_infiles.clearNoFree();
+}
+
 //////////////////////////////
 //
 // HumdrumInput::convertHumdrum -- Top level method called from ImportFile or
@@ -27646,7 +27661,7 @@ void HumdrumInput::setupMeiDocument()
     m_doc->SetType(Raw);
     // The mdiv
     Mdiv *mdiv = new Mdiv();
-    mdiv->m_visibility = Visible;
+    mdiv->SetVisibility(Visible);
     m_doc->AddChild(mdiv);
     // The score
     m_score = new Score();
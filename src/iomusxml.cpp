@@ -356,25 +356,34 @@ void MusicXmlInput::AddMeasure(Section *section, Measure *measure, int i)
     // we just need to add a measure
     if (section->GetChildCount(MEASURE) <= i - GetMrestMeasuresCountBeforeIndex(i)) {
         section->AddChild(measure);
+        m_sectionMeasures.insert({ i, measure });
         contentMeasure = measure;
     }
     // otherwise copy the content to the corresponding existing measure
     else {
         Measure *existingMeasure = NULL;
-        // Search by measure number first
-        ListOfObjects matchingMeasures;
-        AttNNumberLikeComparison comparisonMeasure(MEASURE, measure->GetN());
-        section->FindAllDescendantsByComparison(&matchingMeasures, &comparisonMeasure, 1);
-        // For now take the first match
-        if (!matchingMeasures.empty()) {
-            existingMeasure = vrv_cast<Measure *>(matchingMeasures.front());
-        }
-        // Prefer any measure with matching index (measure numbers might be non-unique)
-        for (Object *object : matchingMeasures) {
-            Measure *matchingMeasure = vrv_cast<Measure *>(object);
-            if (m_measureCounts.at(matchingMeasure) == i) {
-                existingMeasure = matchingMeasure;
-                break;
+        // The measure with matching index and number is the one preferred by the search below
+        const auto sectionMeasureIter = m_sectionMeasures.find(i);
+        if ((sectionMeasureIter != m_sectionMeasures.end())
+            && (sectionMeasureIter->second->GetN() == measure->GetN())) {
+            existingMeasure = sectionMeasureIter->second;
+        }
+        else {
+            // Search by measure number first
+            ListOfObjects matchingMeasures;
+            AttNNumberLikeComparison comparisonMeasure(MEASURE, measure->GetN());
+            section->FindAllDescendantsByComparison(&matchingMeasures, &comparisonMeasure, 1);
+            // For now take the first match
+            if (!matchingMeasures.empty()) {
+                existingMeasure = vrv_cast<Measure *>(matchingMeasures.front());
+            }
+            // Prefer any measure with matching index (measure numbers might be non-unique)
+            for (Object *object : matchingMeasures) {
+                Measure *matchingMeasure = vrv_cast<Measure *>(object);
+                if (m_measureCounts.at(matchingMeasure) == i) {
+                    existingMeasure = matchingMeasure;
+                    break;
+                }
             }
         }
         if (existingMeasure) {
@@ -832,7 +841,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
 
     // the mdiv
     Mdiv *mdiv = new Mdiv();
-    mdiv->m_visibility = Visible;
+    mdiv->SetVisibility(Visible);
     m_doc->AddChild(mdiv);
     // the score
     Score *score = new Score();
@@ -1092,11 +1101,17 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
 
     ProcessClefChangeQueue(section);
 
+    // The first measure of the section with each measure number
+    std::map<std::string, Measure *> measuresByN;
+    for (Object *child : section->GetChildren()) {
+        if (child->Is(MEASURE)) measuresByN.insert({ vrv_cast<Measure *>(child)->GetN(), vrv_cast<Measure *>(child) });
+    }
+
     Measure *measure = NULL;
     for (auto iter = m_controlElements.begin(); iter != m_controlElements.end(); ++iter) {
         if (!measure || (measure->GetN() != iter->first)) {
-            AttNNumberLikeComparison comparisonMeasure(MEASURE, iter->first);
-            measure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure, 1));
+            const auto measureIter = measuresByN.find(iter->first);
+            measure = (measureIter != measuresByN.end()) ? measureIter->second : NULL;
         }
         if (!measure) {
             LogWarning("MusicXML import: Element '%s' could not be added to measure %s",
@@ -1654,11 +1669,14 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     bool isMRestInOtherSystem = (mrestPositonIter != m_multiRests.end());
     int multiRestStaffNumber = 1;
 
+    this->CollectNoteSiblings(node);
+
     // read the content of the measure
     for (pugi::xml_node::iterator it = node.begin(); it != node.end(); ++it) {
         // first check if there is a multi measure rest
-        if (it->select_node(".//multiple-rest")) {
-            const int multiRestLength = it->select_node(".//multiple-rest").node().text().as_int();
+        const pugi::xpath_node multipleRest = it->select_node(m_multipleRestQuery);
+        if (multipleRest) {
+            const int multiRestLength = multipleRest.node().text().as_int();
             MultiRest *multiRest = new MultiRest;
             if (it->select_node(".//multiple-rest[@use-symbols='yes']")) multiRest->SetBlock(BOOLEAN_false);
             multiRest->SetNum(multiRestLength);
@@ -1715,6 +1733,7 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     // clear stop stacks after each measure
     m_hairpinStopStack.clear();
     m_tieStopStack.clear();
+    m_noteSiblings.clear();
 
     for (auto staff : measure->GetChildren()) {
         if (!staff->Is(STAFF)) {
@@ -2094,11 +2113,10 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
     }
 
-    pugi::xpath_node_set words = node.select_nodes("direction-type/words");
+    pugi::xpath_node_set words = node.select_nodes(m_wordsQuery);
     const bool containsWords = !words.empty();
-    bool containsDynamics
-        = !node.select_node("direction-type/dynamics").node().empty() || soundNode.attribute("dynamics");
-    bool containsTempo = !node.select_node("direction-type/metronome").node().empty() || soundNode.attribute("tempo");
+    bool containsDynamics = !node.select_node(m_dynamicsQuery).node().empty() || soundNode.attribute("dynamics");
+    bool containsTempo = !node.select_node(m_metronomeQuery).node().empty() || soundNode.attribute("tempo");
 
     // Directive
     int defaultY = 0; // y position attribute, only for directives and dynamics
@@ -2218,7 +2236,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Hairpins
-    pugi::xpath_node_set wedges = node.select_nodes("direction-type/wedge");
+    pugi::xpath_node_set wedges = node.select_nodes(m_wedgeQuery);
     for (pugi::xpath_node_set::const_iterator wedge = wedges.begin(); wedge != wedges.end(); ++wedge) {
         short int hairpinNumber = wedge->node().attribute("number").as_int();
         hairpinNumber = (hairpinNumber < 1) ? 1 : hairpinNumber;
@@ -2627,8 +2645,17 @@ void MusicXmlInput::ReadMusicXmlNote(
     assert(staff);
     // find staff's staffDef
     // TODO Tablature: is this the correct way to find a staff's staffDef?
-    AttNIntegerComparison cnc(STAFFDEF, staff->GetN());
-    StaffDef *staffDef = vrv_cast<StaffDef *>(m_doc->GetFirstScoreDef()->FindDescendantByComparison(&cnc));
+    StaffDef *staffDef = NULL;
+    const auto staffDefIter = m_staffDefs.find(staff->GetN());
+    if (staffDefIter != m_staffDefs.end()) {
+        staffDef = staffDefIter->second;
+    }
+    else {
+        AttNIntegerComparison cnc(STAFFDEF, staff->GetN());
+        staffDef = vrv_cast<StaffDef *>(m_doc->GetFirstScoreDef()->FindDescendantByComparison(&cnc));
+        // The staffDef of a part is created before its measures are read, so it can be kept for the next notes
+        if (staffDef) m_staffDefs[staff->GetN()] = staffDef;
+    }
     bool isTablature = false;
     Tuning *tuning = NULL;
 
@@ -2661,23 +2688,24 @@ void MusicXmlInput::ReadMusicXmlNote(
         return;
     }
 
-    const pugi::xpath_node notations = node.select_node("notations[not(@print-object='no')]");
+    const pugi::xpath_node notations = node.select_node(m_notationsQuery);
 
-    const bool cue = (node.child("cue") || node.select_node("type[@size='cue']")) ? true : false;
+    const bool cue = (node.child("cue") || node.select_node(m_cueTypeQuery)) ? true : false;
     pugi::xml_node grace = node.child("grace");
 
     // duration string and dots
     const std::string typeStr = node.child("type").text().as_string();
-    const int dots = (int)node.select_nodes("dot").size();
+    const auto dotNodes = node.children("dot");
+    const int dots = (int)std::distance(dotNodes.begin(), dotNodes.end());
 
     short int tremSlashNum = -1;
 
     const bool readBeamsAndTuplets = ReadMusicXmlBeamsAndTuplets(node, layer, isChord);
 
     // beam start
-    bool beamStart = node.select_node("beam[@number='1'][text()='begin']");
+    bool beamStart = node.select_node(m_beamStartQuery);
     // tremolos
-    pugi::xpath_node tremolo = notations.node().select_node("ornaments/tremolo");
+    pugi::xpath_node tremolo = notations.node().select_node(m_tremoloQuery);
 
     if (tremolo) {
         if (HasAttributeWithValue(tremolo.node(), "type", "start")) {
@@ -2906,8 +2934,8 @@ void MusicXmlInput::ReadMusicXmlNote(
         if (node.child("notehead-text")) LogWarning("MusicXML import: notehead-text is not supported");
 
         // look at the next note to see if we are starting or ending a chord
-        pugi::xpath_node nextNote = node.select_node("./following-sibling::note");
-        if (nextNote.node().child("chord")) nextIsChord = true;
+        const pugi::xml_node nextNote = m_noteSiblings.at(node).m_nextNote;
+        if (nextNote.child("chord")) nextIsChord = true;
         Chord *chord = NULL;
         TabGrp *tabGrp = NULL;
         if (isTablature) {
@@ -3124,7 +3152,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // slurs
-        pugi::xpath_node_set slurs = node.select_nodes("notations/slur");
+        pugi::xpath_node_set slurs = node.select_nodes(m_slurQuery);
         for (pugi::xpath_node_set::const_iterator it = slurs.begin(); it != slurs.end(); ++it) {
             pugi::xml_node slur = it->node();
             short int slurNumber = slur.attribute("number").as_int();
@@ -3271,7 +3299,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     m_ID = "#" + element->GetID();
 
     // breath marks
-    pugi::xpath_node xmlBreath = notations.node().select_node("articulations/breath-mark");
+    pugi::xpath_node xmlBreath = notations.node().select_node(m_breathQuery);
     if (xmlBreath) {
         Breath *breath = new Breath();
         m_controlElements.push_back({ measureNum, breath });
@@ -3283,7 +3311,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // caesura
-    pugi::xpath_node xmlCaesura = notations.node().select_node("articulations/caesura");
+    pugi::xpath_node xmlCaesura = notations.node().select_node(m_caesuraQuery);
     if (xmlCaesura) {
         Caesura *caesura = new Caesura();
         m_controlElements.push_back({ measureNum, caesura });
@@ -3335,7 +3363,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fingering
-    auto xmlFing = notations.node().select_node("technical/fingering");
+    auto xmlFing = notations.node().select_node(m_fingeringQuery);
     if (xmlFing) {
         const std::string fingText = xmlFing.node().text().as_string();
         Fing *fing = new Fing();
@@ -3350,7 +3378,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // glissando and slide
-    pugi::xpath_node_set glissandi = notations.node().select_nodes("glissando|slide");
+    pugi::xpath_node_set glissandi = notations.node().select_nodes(m_glissandoQuery);
     for (pugi::xpath_node_set::const_iterator it = glissandi.begin(); it != glissandi.end(); ++it) {
         std::string noteID = m_ID;
         // prevent from using chords or tabGrps
@@ -3384,7 +3412,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // mordents
-    pugi::xpath_node xmlMordent = notations.node().select_node("ornaments/*[contains(name(), 'mordent')]");
+    pugi::xpath_node xmlMordent = notations.node().select_node(m_mordentQuery);
     if (xmlMordent) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
@@ -3436,8 +3464,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // schleifer/haydn (counts as mordent with different glyph)
-    pugi::xpath_node xmlExtOrnament
-        = notations.node().select_node("ornaments/*[contains(name(), 'schleifer') or contains(name(), 'haydn')]");
+    pugi::xpath_node xmlExtOrnament = notations.node().select_node(m_schleiferQuery);
     if (xmlExtOrnament) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
@@ -3454,8 +3481,8 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // trill
-    pugi::xpath_node xmlTrill = notations.node().select_node("ornaments/trill-mark");
-    pugi::xpath_node xmlTrillLine = notations.node().select_node("ornaments/wavy-line[@type='start']");
+    pugi::xpath_node xmlTrill = notations.node().select_node(m_trillQuery);
+    pugi::xpath_node xmlTrillLine = notations.node().select_node(m_trillLineStartQuery);
     if (xmlTrill || xmlTrillLine) {
         Trill *trill = new Trill();
         m_controlElements.push_back({ measureNum, trill });
@@ -3487,9 +3514,8 @@ void MusicXmlInput::ReadMusicXmlNote(
             }
         }
     }
-    if (!m_trillStack.empty() && notations.node().select_node("ornaments/wavy-line[@type='stop']")) {
-        short int extNumber
-            = notations.node().select_node("ornaments/wavy-line[@type='stop']").node().attribute("number").as_int();
+    if (!m_trillStack.empty() && notations.node().select_node(m_trillLineStopQuery)) {
+        short int extNumber = notations.node().select_node(m_trillLineStopQuery).node().attribute("number").as_int();
         std::vector<std::pair<Trill *, musicxml::OpenSpanner>>::iterator iter = m_trillStack.begin();
         while (iter != m_trillStack.end()) {
             const int measureDifference = m_measureCounts.at(measure) - iter->second.m_lastMeasureCount;
@@ -3506,7 +3532,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // turns
-    pugi::xpath_node xmlTurn = notations.node().select_node("ornaments/*[contains(name(), 'turn')]");
+    pugi::xpath_node xmlTurn = notations.node().select_node(m_turnQuery);
     if (xmlTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back({ measureNum, turn });
@@ -3550,7 +3576,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // arpeggio
-    pugi::xpath_node xmlArpeggiate = notations.node().select_node("*[contains(name(), 'arpeggiate')]");
+    pugi::xpath_node xmlArpeggiate = notations.node().select_node(m_arpeggiateQuery);
     if (xmlArpeggiate) {
         short int arpegN = xmlArpeggiate.node().attribute("number").as_int();
         arpegN = (arpegN < 1) ? 1 : arpegN;
@@ -3603,13 +3629,13 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // tuplet end
-    pugi::xpath_node tupletEnd = node.select_node("notations/tuplet[@type='stop']");
+    pugi::xpath_node tupletEnd = node.select_node(m_tupletEndQuery);
     if (tupletEnd) {
         RemoveLastFromStack(TUPLET, layer);
     }
 
     // beam end
-    bool beamEnd = node.select_node("beam[text()='end']");
+    bool beamEnd = node.select_node(m_beamEndQuery);
     if (beamEnd) {
         int breakSec = (int)node.select_nodes("beam[text()='continue']").size();
         if (breakSec) {
@@ -3711,23 +3737,20 @@ void MusicXmlInput::ReadMusicXmlPrint(pugi::xml_node node, Section *section)
 
 bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Layer *layer, bool isChord)
 {
-    pugi::xpath_node beamStart = node.select_node("beam[@number='1' and text()='begin']");
-    pugi::xpath_node tupletStart = node.select_node("notations/tuplet[@type='start']");
-    pugi::xpath_node currentMeasure = node.select_node("ancestor::measure");
+    pugi::xpath_node beamStart = node.select_node(m_beamStartQuery);
+    pugi::xpath_node tupletStart = node.select_node(m_tupletStartQuery);
+    if (!beamStart && !tupletStart) return true;
 
-    pugi::xml_node beamEnd = node.select_node("./following-sibling::note[beam[@number='1' and text()='end']]").node();
-    pugi::xml_node tupletEnd = node.select_node("./following-sibling::note[notations/tuplet[@type='stop']]").node();
+    // The next notes ending the beam and the tuplet, with their positions in the measure
+    const musicxml::NoteSiblings &siblings = m_noteSiblings.at(node);
+    const pugi::xml_node beamEnd = siblings.m_beamEnd;
+    const pugi::xml_node tupletEnd = siblings.m_tupletEnd;
 
-    const auto measureNodeChildren = currentMeasure.node().children();
-    std::vector<pugi::xml_node> currentMeasureNodes(measureNodeChildren.begin(), measureNodeChildren.end());
     // in case note is a start of both beam and tuplet - need to figure which one is longer
     if (beamStart && tupletStart) {
-        const auto beamEndIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), beamEnd);
-        const auto tupletEndIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), tupletEnd);
-
-        // find distance between iterator, i.e. whether beam or tuplet ends first.
+        // find distance between the ends, i.e. whether beam or tuplet ends first.
         // Negative number - beam ends first, positive - tuplet, zero - both are of the same length
-        const int distance = static_cast<int>(std::distance(beamEndIterator, tupletEndIterator));
+        const int distance = siblings.m_tupletEndIndex - siblings.m_beamEndIndex;
         if (distance > 0) {
             if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
             ReadMusicXmlBeamStart(node, beamStart.node(), layer);
@@ -3740,33 +3763,21 @@ bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Laye
     // If note is a start of the beam only - check if there is a tuplet starting/ending in the span of
     // the whole duration of this beam
     else if (beamStart) {
-        // find whether there is a tuplet that starts during the span of the beam
-        pugi::xpath_node nextTupletStart
-            = node.select_node("./following-sibling::note[notations/tuplet[@type='start']]").node();
-
-        // find start and end of the beam
-        const auto beamStartIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), node);
-        const auto beamEndIterator = std::find(beamStartIterator, currentMeasureNodes.end(), beamEnd);
-
         // find staff number for the corresponding elements - we do not want to match beam start on one staff with beam
         // end on another
-        pugi::xpath_node nodeStaff = node.select_node("staff");
-        pugi::xpath_node endBeamStaff = beamEnd.select_node("staff");
-
-        if (beamEndIterator == currentMeasureNodes.end()
-            || (nodeStaff && endBeamStaff
-                && (nodeStaff.node().text().as_int() != endBeamStaff.node().text().as_int()))) {
-            std::string measureName = (currentMeasure.node().attribute("id"))
-                ? currentMeasure.node().attribute("id").as_string()
-                : currentMeasure.node().attribute("number").as_string();
+        pugi::xml_node nodeStaff = node.child("staff");
+        pugi::xml_node endBeamStaff = beamEnd.child("staff");
+
+        if (!beamEnd || (nodeStaff && endBeamStaff && (nodeStaff.text().as_int() != endBeamStaff.text().as_int()))) {
+            const pugi::xml_node currentMeasure = node.parent();
+            std::string measureName = (currentMeasure.attribute("id")) ? currentMeasure.attribute("id").as_string()
+                                                                       : currentMeasure.attribute("number").as_string();
             LogDebug("MusicXML import: Beam without end in measure %s treated as <beamSpan>", measureName.c_str());
             return false;
         }
-        // form vector of the beam nodes and find whether there are tuplets that start or end within the beam
-        std::vector<pugi::xml_node> beamNodes(beamStartIterator, beamEndIterator + 1);
-        bool isTupletStartInBeam
-            = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), nextTupletStart.node()));
-        bool isTupletEndInBeam = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), tupletEnd));
+        // find whether there are tuplets that start or end within the beam
+        bool isTupletStartInBeam = (siblings.m_tupletStart && (siblings.m_tupletStartIndex <= siblings.m_beamEndIndex));
+        bool isTupletEndInBeam = (tupletEnd && (siblings.m_tupletEndIndex <= siblings.m_beamEndIndex));
         // in case if there is only start/end of the tuplet in the beam, then we need to use beamSpan instead
         if ((tupletEnd != beamEnd) && (isTupletStartInBeam != isTupletEndInBeam)) {
             // TODO: same call as in else-case is intentional. Proper beamSpan support will need to be implemented
@@ -3785,6 +3796,40 @@ bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Laye
     return true;
 }
 
+void MusicXmlInput::CollectNoteSiblings(const pugi::xml_node &node)
+{
+    m_noteSiblings.clear();
+
+    // The next notes are collected going backward, starting with the position after the last child
+    const auto children = node.children();
+    int index = (int)std::distance(children.begin(), children.end());
+    musicxml::NoteSiblings next;
+    next.m_beamEndIndex = index;
+    next.m_tupletStartIndex = index;
+    next.m_tupletEndIndex = index;
+
+    for (pugi::xml_node child = node.last_child(); child; child = child.previous_sibling()) {
+        --index;
+        if (!IsElement(child, "note")) continue;
+        musicxml::NoteSiblings &siblings = m_noteSiblings[child];
+        siblings = next;
+        // The note is the next one for the preceding notes
+        next.m_nextNote = child;
+        if (child.select_node(m_beamFirstEndQuery)) {
+            next.m_beamEnd = child;
+            next.m_beamEndIndex = index;
+        }
+        if (child.select_node(m_tupletStartQuery)) {
+            next.m_tupletStart = child;
+            next.m_tupletStartIndex = index;
+        }
+        if (child.select_node(m_tupletEndQuery)) {
+            next.m_tupletEnd = child;
+            next.m_tupletEndIndex = index;
+        }
+    }
+}
+
 void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pugi::xml_node &tupletStart, Layer *layer)
 {
     // TODO <tuplet> does not support child <tabGrp>
@@ -687,7 +687,7 @@ void PAEInput::parsePlainAndEasy(std::istream &infile)
     m_doc->SetType(Raw);
     // The mdiv
     Mdiv *mdiv = new Mdiv();
-    mdiv->m_visibility = Visible;
+    mdiv->SetVisibility(Visible);
     m_doc->AddChild(mdiv);
     // The score
     Score *score = new Score();
@@ -2433,14 +2433,20 @@ namespace pae {
 
 } // namespace pae
 
+thread_local std::vector<pae::Token> PAEInput::s_tokenBuffer;
+
 PAEInput::PAEInput(Doc *doc) : Input(doc)
 {
     m_scoreBased = false;
+    // Take over the token storage of the previous input - it is empty but has kept its capacity
+    m_pae.swap(s_tokenBuffer);
 }
 
 PAEInput::~PAEInput()
 {
     this->ClearTokenObjects();
+    // Give the storage back for the next input
+    m_pae.swap(s_tokenBuffer);
 }
 
 void PAEInput::ClearTokenObjects()
@@ -2535,6 +2541,9 @@ void PAEInput::LogPAE(int errCode, pae::Token &token, std::string value)
 
 void PAEInput::LogDebugTokens(bool vertical)
 {
+    // Building the rows is not worth it when they are not logged
+    if (logLevel < LOG_DEBUG) return;
+
     // For long incipits or to see full class name
     if (vertical) {
         for (pae::Token &token : m_pae) {
@@ -2618,7 +2627,7 @@ void PAEInput::AddToken(char c, int &position)
     }
 }
 
-void PAEInput::PrepareInsertion(int position, std::list<pae::Token> &insertion)
+void PAEInput::PrepareInsertion(int position, std::vector<pae::Token> &insertion)
 {
     for (pae::Token &token : insertion) {
         token.m_position = position;
@@ -2778,7 +2787,8 @@ bool PAEInput::Import(const std::string &input)
 
     // Genereate the header and add a comment to the project description
     m_doc->GenerateMEIHeader(false);
-    pugi::xml_node projectDesc = m_doc->m_header.first_child().select_node("//projectDesc").node();
+    static const pugi::xpath_query projectDescQuery("//projectDesc");
+    pugi::xml_node projectDesc = m_doc->m_header.first_child().select_node(projectDescQuery).node();
     if (projectDesc) {
         pugi::xml_node p1 = projectDesc.append_child("p");
         p1.text().set("Converted from Plaine and Easie to MEI");
@@ -2861,6 +2871,7 @@ bool PAEInput::Import(const std::string &input)
     Measure *measure = new Measure(true, 1);
     // By default there is no end barline on an incipit
     measure->SetRight(BARRENDITION_invis);
+    m_pae.reserve(data.size() + 2);
     m_pae.push_back(pae::Token(0, pae::UNKOWN_POS, measure));
 
     // Remove non PAE internal characters
@@ -2868,9 +2879,18 @@ bool PAEInput::Import(const std::string &input)
         data.erase(std::remove(data.begin(), data.end(), c), data.end());
     }
 
-    data = std::regex_replace(data, std::regex("qq"), "Q");
-    data = std::regex_replace(data, std::regex("xx"), "X");
-    data = std::regex_replace(data, std::regex("bb"), "Y");
+    // Replace qq, xx and bb with their internal characters in a single pass
+    std::string::iterator dataEnd = data.begin();
+    for (std::string::iterator it = data.begin(); it != data.end(); ++it) {
+        if ((std::next(it) != data.end()) && (*std::next(it) == *it) && (*it == 'q' || *it == 'x' || *it == 'b')) {
+            *dataEnd++ = (*it == 'q') ? 'Q' : (*it == 'x') ? 'X' : 'Y';
+            ++it;
+        }
+        else {
+            *dataEnd++ = *it;
+        }
+    }
+    data.erase(dataEnd, data.end());
 
     int i = 0;
     for (char c : data) {
@@ -2951,7 +2971,7 @@ bool PAEInput::Parse()
     if (m_isMensural) m_doc->m_notationType = NOTATIONTYPE_mensural;
     // The mdiv
     Mdiv *mdiv = new Mdiv();
-    mdiv->m_visibility = Visible;
+    mdiv->SetVisibility(Visible);
     m_doc->AddChild(mdiv);
     // The score
     Score *score = new Score();
@@ -3396,11 +3416,11 @@ bool PAEInput::ConvertRepeatedFigure()
     // A status flag indicating that we are in figure of in a repetition of a figure
     pae::status_FIGURE status = pae::FIGURE_NONE;
     // The figure that will be repeated and to which we copy tokens
-    std::list<pae::Token> figure;
+    std::vector<pae::Token> figure;
     // A pointer to the beginning of the figure (for debugging purposes)
     pae::Token *figureToken = NULL;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -3445,11 +3465,8 @@ bool PAEInput::ConvertRepeatedFigure()
                 token->m_char = 0;
                 // Set position and clone objects
                 PrepareInsertion(token->m_position, figure);
-                // Move to the next token because we insert before it
-                ++token;
-                m_pae.insert(token, figure.begin(), figure.end());
-                // Move back to the previous token (now the end of the figure)
-                --token;
+                // Insert after the token and move to the end of the figure
+                token = m_pae.insert(std::next(token), figure.begin(), figure.end()) + figure.size() - 1;
                 status = pae::FIGURE_REPEAT;
             }
             // End of repetitions - this includes the end of a measure
@@ -3489,11 +3506,11 @@ bool PAEInput::ConvertRepeatedMeasure()
     if (!this->HasInput('i')) return true;
 
     // The measure that will be repeated and to which we copy tokens
-    std::list<pae::Token> measure;
+    std::vector<pae::Token> measure;
     bool measureStart = false;
     bool repeat = false;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -3517,11 +3534,8 @@ bool PAEInput::ConvertRepeatedMeasure()
             else {
                 // Set position and clone objects
                 PrepareInsertion(token->m_position, measure);
-                // Move to the next token because we insert before it
-                ++token;
-                m_pae.insert(token, measure.begin(), measure.end());
-                // Move back to the previous token (now the end of the measure)
-                --token;
+                // Insert after the token and move to the end of the measure
+                token = m_pae.insert(std::next(token), measure.begin(), measure.end()) + measure.size() - 1;
                 repeat = true;
             }
         }
@@ -3828,9 +3842,9 @@ bool PAEInput::ConvertChord()
     // A flag for the chord status NONE|MARKER|NOTE
     pae::status_CHORD status = pae::CHORD_NONE;
     // The iterator of the last note that can become the first note of a chord
-    std::list<pae::Token>::iterator note = m_pae.end();
+    std::vector<pae::Token>::iterator note = m_pae.end();
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -3871,8 +3885,14 @@ bool PAEInput::ConvertChord()
         // We passed the last note of the chord - create it
         if (status == pae::CHORD_NOTE) {
             Chord *chord = new Chord();
+            // Inserting invalidates the iterators - keep their positions
+            const int notePosition = (int)(note - m_pae.begin());
+            const int tokenPosition = (int)(token - m_pae.begin());
             m_pae.insert(note, pae::Token(0, pae::UNKOWN_POS, chord));
-            m_pae.insert(token, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, chord));
+            m_pae.insert(m_pae.begin() + tokenPosition + 1, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, chord));
+            // Both are shifted by the opening token and the token also by the closing one
+            note = m_pae.begin() + notePosition + 1;
+            token = m_pae.begin() + tokenPosition + 2;
         }
 
         status = pae::CHORD_NONE;
@@ -3901,7 +3921,7 @@ bool PAEInput::ConvertBeam()
     bool withinGrace = false;
 
     // Here we need an iterator because we might have to add a missing closing tag
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4024,7 +4044,7 @@ bool PAEInput::ConvertGraceGrp()
     GraceGrp *graceGrp = NULL;
 
     // Here we need an iterator because we might have to add a missing closing tag
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4146,7 +4166,7 @@ bool PAEInput::ConvertTuplet()
     };
 
     // Here we need an iterator because we might have to add a missing closing tag
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4236,7 +4256,7 @@ bool PAEInput::ConvertDuration()
     bool isChord = false;
 
     // Here we need an iterator because we might have to add a mensural dots
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4403,11 +4423,11 @@ bool PAEInput::ConvertLigature()
     // A flag for the ligature status NONE|MARKER|NOTE
     pae::status_LIGATURE status = pae::LIGATURE_NONE;
     // The iterator of the last note that can become the first note of a ligature
-    std::list<pae::Token>::iterator note = m_pae.end();
+    std::vector<pae::Token>::iterator note = m_pae.end();
     // The previous ligature note for checking that is it not of the same pitch
     Note *previousNote = NULL;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4475,8 +4495,14 @@ bool PAEInput::ConvertLigature()
         // We passed the last note of the ligature - create it
         if (status == pae::LIGATURE_NOTE) {
             Ligature *ligature = new Ligature();
+            // Inserting invalidates the iterators - keep their positions
+            const int notePosition = (int)(note - m_pae.begin());
+            const int tokenPosition = (int)(token - m_pae.begin());
             m_pae.insert(note, pae::Token(0, pae::UNKOWN_POS, ligature));
-            m_pae.insert(token, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, ligature));
+            m_pae.insert(m_pae.begin() + tokenPosition + 1, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, ligature));
+            // Both are shifted by the opening token and the token also by the closing one
+            note = m_pae.begin() + notePosition + 1;
+            token = m_pae.begin() + tokenPosition + 2;
         }
 
         status = pae::LIGATURE_NONE;
@@ -4578,7 +4604,7 @@ bool PAEInput::ConvertAccidGes()
 
 bool PAEInput::CheckHierarchy()
 {
-    std::list<pae::Token *> stack;
+    std::vector<pae::Token *> stack;
     // A reference layer to test with
     Layer layer;
     pae::Token layerToken('_', pae::UNKOWN_POS, &layer);
@@ -4662,7 +4688,7 @@ bool PAEInput::CheckContentPreBuild()
 
     pae::Token *previousToken = NULL;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid() || !token->m_object) {
             ++token;
@@ -4675,7 +4701,7 @@ bool PAEInput::CheckContentPreBuild()
             if (m_pedanticMode) return false;
             Measure *measure = new Measure();
             measure->SetRight(BARRENDITION_invis);
-            m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure));
+            token = m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure)) + 1;
         }
         // Check that the measure rest is at the end of a measure
         else if (previousToken && previousToken->Is(MULTIREST) && !token->Is(MEASURE)) {
@@ -4683,7 +4709,7 @@ bool PAEInput::CheckContentPreBuild()
             if (m_pedanticMode) return false;
             Measure *measure = new Measure();
             measure->SetRight(BARRENDITION_invis);
-            m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure));
+            token = m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure)) + 1;
         }
 
         if (token->m_object) {
@@ -4906,12 +4932,16 @@ bool PAEInput::ParseMeterSig(MeterSig *meterSig, const std::string &paeStr, pae:
         return true;
     }
 
+    // Compiling the regular expressions is costly - do it only once
+    static const std::regex fraction("(\\d+)/(\\d+)");
+    static const std::regex number("\\d+");
+
     std::cmatch matches;
-    if (regex_match(paeStr.c_str(), matches, std::regex("(\\d+)/(\\d+)"))) {
+    if (regex_match(paeStr.c_str(), matches, fraction)) {
         meterSig->SetCount({ { std::stoi(matches[1]) }, MeterCountSign::None });
         meterSig->SetUnit(std::stoi(matches[2]));
     }
-    else if (regex_match(paeStr.c_str(), matches, std::regex("\\d+"))) {
+    else if (regex_match(paeStr.c_str(), matches, number)) {
         meterSig->SetCount({ { std::stoi(paeStr) }, MeterCountSign::None });
         meterSig->SetUnit(1);
         meterSig->SetForm(METERFORM_num);
@@ -4961,15 +4991,20 @@ bool PAEInput::ParseMensur(Mensur *mensur, const std::string &paeStr, pae::Token
         return true;
     }
 
+    // Compiling the regular expressions is costly - do it only once
+    static const std::regex fraction("(\\d+)/(\\d+)");
+    static const std::regex number("\\d+");
+    static const std::regex sign("([co])([\\./]?)([\\./]?)(\\d*)/?(\\d*)");
+
     std::cmatch matches;
-    if (regex_match(paeStr.c_str(), matches, std::regex("(\\d+)/(\\d+)"))) {
+    if (regex_match(paeStr.c_str(), matches, fraction)) {
         mensur->SetNum(std::stoi(matches[1]));
         mensur->SetNumbase(std::stoi(matches[2]));
     }
-    else if (regex_match(paeStr.c_str(), matches, std::regex("\\d+"))) {
+    else if (regex_match(paeStr.c_str(), matches, number)) {
         mensur->SetNum(std::stoi(paeStr.c_str()));
     }
-    else if (regex_match(paeStr.c_str(), matches, std::regex("([co])([\\./]?)([\\./]?)(\\d*)/?(\\d*)"))) {
+    else if (regex_match(paeStr.c_str(), matches, sign)) {
         // C
         if (matches[1] == "c") {
             mensur->SetSign(MENSURATIONSIGN_C);
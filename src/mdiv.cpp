@@ -63,7 +63,7 @@ bool Mdiv::IsSupportedChild(Object *child)
 
 void Mdiv::MakeVisible()
 {
-    m_visibility = Visible;
+    this->SetVisibility(Visible);
     if (this->GetParent() && this->GetParent()->Is(MDIV)) {
         Mdiv *parent = vrv_cast<Mdiv *>(this->GetParent());
         assert(parent);
@@ -71,6 +71,14 @@ void Mdiv::MakeVisible()
     }
 }
 
+void Mdiv::SetVisibility(VisibilityType visibility)
+{
+    if (m_visibility == visibility) return;
+
+    m_visibility = visibility;
+    this->NotifyTreeChange();
+}
+
 //----------------------------------------------------------------------------
 // Functor methods
 //----------------------------------------------------------------------------
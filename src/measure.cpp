@@ -493,8 +493,7 @@ const Staff *Measure::GetBottomVisibleStaff() const
 int Measure::EnclosesTime(int time) const
 {
     int repeat = 1;
-    double timeDuration
-        = m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5;
+    double timeDuration = this->GetRealTimeDurationMilliseconds();
     std::vector<double>::const_iterator iter;
     for (iter = m_realTimeOffsetMilliseconds.begin(); iter != m_realTimeOffsetMilliseconds.end(); ++iter) {
         if ((time >= *iter) && (time <= *iter + timeDuration)) return repeat;
@@ -503,6 +502,11 @@ int Measure::EnclosesTime(int time) const
     return 0;
 }
 
+double Measure::GetRealTimeDurationMilliseconds() const
+{
+    return m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5;
+}
+
 double Measure::GetRealTimeOffsetMilliseconds(int repeat) const
 {
     if ((repeat < 1) || repeat > (int)m_realTimeOffsetMilliseconds.size()) return 0;
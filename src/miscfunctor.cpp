@@ -141,6 +141,7 @@ FunctorCode ReorderByXPosFunctor::VisitObject(Object *object)
 
     ArrayOfObjects &children = object->GetChildrenForModification();
     std::stable_sort(children.begin(), children.end(), Object::sortByUlx);
+    object->NotifyTreeChange();
 
     object->Modify();
 
@@ -42,6 +42,7 @@
 #include "page.h"
 #include "plistinterface.h"
 #include "resetfunctor.h"
+#include "runtimeclock.h"
 #include "savefunctor.h"
 #include "score.h"
 #include "staff.h"
@@ -61,6 +62,81 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// ClassRegistration
+//----------------------------------------------------------------------------
+
+std::mutex ClassRegistration::s_mutex;
+int ClassRegistration::s_count = 0;
+size_t ClassRegistration::s_bytes = 0;
+
+ClassRegistration::ClassRegistration() : m_key(0), m_firstExtension(NULL) {}
+
+ClassRegistration::~ClassRegistration()
+{
+    delete m_firstExtension.load();
+}
+
+const ClassRegistration *ClassRegistration::AddAttClass(AttClassId attClassId) const
+{
+    return this->Extend(attClassId, { attClassId }, NULL);
+}
+
+const ClassRegistration *ClassRegistration::AddInterface(
+    const std::vector<AttClassId> *attClasses, InterfaceId interfaceId) const
+{
+    assert(attClasses);
+
+    return this->Extend(-1 - interfaceId, *attClasses, &interfaceId);
+}
+
+const ClassRegistration *ClassRegistration::Extend(
+    int key, const std::vector<AttClassId> &attClasses, const InterfaceId *interfaceId) const
+{
+    // The registrations are never removed and are complete when added to the list
+    for (const ClassRegistration *extension = m_firstExtension.load(std::memory_order_acquire); extension;
+         extension = extension->m_nextExtension.get()) {
+        if (extension->m_key == key) return extension;
+    }
+
+    const std::lock_guard<std::mutex> lock(s_mutex);
+
+    // Look again since it might have been created by another thread in the meantime
+    ClassRegistration *firstExtension = m_firstExtension.load(std::memory_order_relaxed);
+    for (const ClassRegistration *extension = firstExtension; extension; extension = extension->m_nextExtension.get()) {
+        if (extension->m_key == key) return extension;
+    }
+
+    std::unique_ptr<ClassRegistration> extension = std::make_unique<ClassRegistration>();
+    extension->m_attClasses.reserve(m_attClasses.size() + attClasses.size());
+    extension->m_attClasses.insert(extension->m_attClasses.end(), m_attClasses.begin(), m_attClasses.end());
+    extension->m_attClasses.insert(extension->m_attClasses.end(), attClasses.begin(), attClasses.end());
+    extension->m_interfaces = m_interfaces;
+    if (interfaceId) extension->m_interfaces.push_back(*interfaceId);
+    extension->m_key = key;
+    extension->m_nextExtension.reset(firstExtension);
+    ++s_count;
+    s_bytes += sizeof(ClassRegistration) + extension->m_attClasses.capacity() * sizeof(AttClassId)
+        + extension->m_interfaces.capacity() * sizeof(InterfaceId);
+    m_firstExtension.store(extension.release(), std::memory_order_release);
+
+    return m_firstExtension.load(std::memory_order_relaxed);
+}
+
+const ClassRegistration *ClassRegistration::GetEmpty()
+{
+    static const ClassRegistration empty;
+    return &empty;
+}
+
+void ClassRegistration::GetStatistics(int &count, size_t &bytes)
+{
+    const std::lock_guard<std::mutex> lock(s_mutex);
+
+    count = s_count;
+    bytes = s_bytes;
+}
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
@@ -104,7 +180,7 @@ Object::Object(const Object &object) : BoundingBox(object)
     this->ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
     m_classId = object.m_classId;
-    m_classIdStr = object.m_classIdStr;
+    m_idPrefix = object.m_idPrefix;
     m_parent = NULL;
 
     // Flags
@@ -113,8 +189,7 @@ Object::Object(const Object &object) : BoundingBox(object)
     m_isReferenceObject = object.m_isReferenceObject;
 
     // Also copy attribute classes
-    m_attClasses = object.m_attClasses;
-    m_interfaces = object.m_interfaces;
+    m_registration = object.m_registration;
     // New id
     this->GenerateID();
     // For now do not copy them
@@ -151,7 +226,7 @@ Object &Object::operator=(const Object &object)
         this->ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
         m_classId = object.m_classId;
-        m_classIdStr = object.m_classIdStr;
+        m_idPrefix = object.m_idPrefix;
         m_parent = NULL;
         // Flags
         m_isAttribute = object.m_isAttribute;
@@ -159,8 +234,7 @@ Object &Object::operator=(const Object &object)
         m_isReferenceObject = object.m_isReferenceObject;
 
         // Also copy attribute classes
-        m_attClasses = object.m_attClasses;
-        m_interfaces = object.m_interfaces;
+        m_registration = object.m_registration;
         // New id
         this->GenerateID();
         // For now do now copy them
@@ -186,6 +260,9 @@ Object &Object::operator=(const Object &object)
 
 Object::~Object()
 {
+    // Deleting an object still attached to a parent changes the tree
+    if (m_parent) this->NotifyTreeChange();
+
     ClearChildren();
 }
 
@@ -194,8 +271,9 @@ void Object::Init(ClassId classId, const std::string &classIdStr)
     assert(classIdStr.size());
 
     m_classId = classId;
-    m_classIdStr = classIdStr;
+    m_idPrefix = classIdStr.at(0);
     m_parent = NULL;
+    m_registration = ClassRegistration::GetEmpty();
     // Flags
     m_isAttribute = false;
     m_isModified = true;
@@ -245,8 +323,7 @@ void Object::Reset()
 
 void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
 {
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
+    m_registration = m_registration->AddInterface(attClasses, interfaceId);
 }
 
 bool Object::IsMilestoneElement()
@@ -337,6 +414,7 @@ void Object::InsertAfter(Object *child, Object *newChild)
 void Object::SortChildren(Object::binaryComp comp)
 {
     std::stable_sort(m_children.begin(), m_children.end(), comp);
+    this->NotifyTreeChange();
     this->Modify();
 }
 
@@ -351,6 +429,12 @@ void Object::MoveItselfTo(Object *targetParent)
     targetParent->AddChild(relinquishedObject);
 }
 
+void Object::SetID(const std::string &id)
+{
+    m_id = id;
+    this->NotifyTreeChange();
+}
+
 void Object::SwapID(Object *other)
 {
     assert(other);
@@ -361,6 +445,8 @@ void Object::SwapID(Object *other)
 
 void Object::ClearChildren()
 {
+    if (!m_children.empty()) this->NotifyTreeChange();
+
     if (m_isReferenceObject) {
         m_children.clear();
         return;
@@ -574,6 +660,7 @@ void Object::ClearRelinquishedChildren()
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end();) {
         if ((*iter)->GetParent() != this) {
+            this->NotifyTreeChange();
             iter = m_children.erase(iter);
         }
         else {
@@ -589,6 +676,16 @@ Object *Object::FindDescendantByID(const std::string &id, int deepness, bool dir
 
 const Object *Object::FindDescendantByID(const std::string &id, int deepness, bool direction) const
 {
+    // Use the id index of the document when searching without depth limit
+    if (deepness == UNLIMITED_DEPTH) {
+        const Doc *doc
+            = this->Is(DOC) ? vrv_cast<const Doc *>(this) : vrv_cast<const Doc *>(this->GetFirstAncestor(DOC));
+        const Object *element = NULL;
+        if (doc && doc->FindIndexedByID(id, element)) {
+            return (element && element->IsVisibleDescendantOf(this)) ? element : NULL;
+        }
+    }
+
     FindByIDFunctor findByID(id);
     findByID.SetDirection(direction);
     this->Process(findByID, deepness, true);
@@ -613,6 +710,26 @@ Object *Object::FindDescendantByComparison(Comparison *comparison, int deepness,
 
 const Object *Object::FindDescendantByComparison(Comparison *comparison, int deepness, bool direction) const
 {
+    // Use the class id index of the document when searching without depth limit
+    const ArrayOfConstObjects *descendants
+        = (deepness == UNLIMITED_DEPTH) ? this->GetIndexedDescendants(comparison) : NULL;
+    if (descendants) {
+        auto matches = [comparison](const Object *object) { return (*comparison)(object); };
+        if (direction == FORWARD) {
+            ArrayOfConstObjects::const_iterator iter = std::find_if(descendants->begin(), descendants->end(), matches);
+            return (iter != descendants->end()) ? *iter : NULL;
+        }
+        // Backward, the first match is the outermost matching ancestor of the last match in forward order
+        ArrayOfConstObjects::const_reverse_iterator iter
+            = std::find_if(descendants->rbegin(), descendants->rend(), matches);
+        if (iter == descendants->rend()) return NULL;
+        const Object *element = *iter;
+        for (const Object *ancestor = element->GetParent(); ancestor != this; ancestor = ancestor->GetParent()) {
+            if (matches(ancestor)) element = ancestor;
+        }
+        return element;
+    }
+
     FindByComparisonFunctor findByComparison(comparison);
     findByComparison.SetDirection(direction);
     this->Process(findByComparison, deepness, true);
@@ -637,6 +754,15 @@ ListOfObjects Object::FindAllDescendantsByType(ClassId classId, bool continueDep
 {
     ListOfObjects descendants;
     ClassIdComparison comparison(classId);
+    // Use the class id index of the document when searching without depth limit
+    const ArrayOfConstObjects *indexedDescendants = (continueDepthSearchForMatches && (deepness == UNLIMITED_DEPTH))
+        ? this->GetIndexedDescendants(&comparison)
+        : NULL;
+    if (indexedDescendants) {
+        std::transform(indexedDescendants->begin(), indexedDescendants->end(), std::back_inserter(descendants),
+            [](const Object *object) { return const_cast<Object *>(object); });
+        return descendants;
+    }
     FindAllByComparisonFunctor findAllByComparison(&comparison, &descendants);
     findAllByComparison.SetContinueDepthSearchForMatches(continueDepthSearchForMatches);
     this->Process(findAllByComparison, deepness, true);
@@ -648,6 +774,14 @@ ListOfConstObjects Object::FindAllDescendantsByType(
 {
     ListOfConstObjects descendants;
     ClassIdComparison comparison(classId);
+    // Use the class id index of the document when searching without depth limit
+    const ArrayOfConstObjects *indexedDescendants = (continueDepthSearchForMatches && (deepness == UNLIMITED_DEPTH))
+        ? this->GetIndexedDescendants(&comparison)
+        : NULL;
+    if (indexedDescendants) {
+        descendants.assign(indexedDescendants->begin(), indexedDescendants->end());
+        return descendants;
+    }
     FindAllConstByComparisonFunctor findAllConstByComparison(&comparison, &descendants);
     findAllConstByComparison.SetContinueDepthSearchForMatches(continueDepthSearchForMatches);
     this->Process(findAllConstByComparison, deepness, true);
@@ -660,6 +794,16 @@ void Object::FindAllDescendantsByComparison(
     assert(objects);
     if (clear) objects->clear();
 
+    // Use the class id index of the document when searching forward without depth limit
+    const ArrayOfConstObjects *descendants
+        = ((deepness == UNLIMITED_DEPTH) && (direction == FORWARD)) ? this->GetIndexedDescendants(comparison) : NULL;
+    if (descendants) {
+        for (const Object *object : *descendants) {
+            if ((*comparison)(object)) objects->push_back(const_cast<Object *>(object));
+        }
+        return;
+    }
+
     FindAllByComparisonFunctor findAllByComparison(comparison, objects);
     findAllByComparison.SetDirection(direction);
     this->Process(findAllByComparison, deepness, true);
@@ -671,6 +815,15 @@ void Object::FindAllDescendantsByComparison(
     assert(objects);
     if (clear) objects->clear();
 
+    // Use the class id index of the document when searching forward without depth limit
+    const ArrayOfConstObjects *descendants
+        = ((deepness == UNLIMITED_DEPTH) && (direction == FORWARD)) ? this->GetIndexedDescendants(comparison) : NULL;
+    if (descendants) {
+        std::copy_if(descendants->begin(), descendants->end(), std::back_inserter(*objects),
+            [comparison](const Object *object) { return (*comparison)(object); });
+        return;
+    }
+
     FindAllConstByComparisonFunctor findAllConstByComparison(comparison, objects);
     findAllConstByComparison.SetDirection(direction);
     this->Process(findAllConstByComparison, deepness, true);
@@ -738,6 +891,7 @@ bool Object::DeleteChild(Object *child)
 {
     auto it = std::find(m_children.begin(), m_children.end(), child);
     if (it != m_children.end()) {
+        this->NotifyTreeChange();
         m_children.erase(it);
         if (!m_isReferenceObject) {
             delete child;
@@ -757,6 +911,7 @@ int Object::DeleteChildrenByComparison(Comparison *comparison)
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end();) {
         if ((*comparison)(*iter)) {
+            this->NotifyTreeChange();
             if (!m_isReferenceObject) delete *iter;
             iter = m_children.erase(iter);
             ++count;
@@ -771,18 +926,34 @@ int Object::DeleteChildrenByComparison(Comparison *comparison)
 
 void Object::GenerateID()
 {
-    m_id = m_classIdStr.at(0) + Object::GenerateHashID();
+    m_id = m_idPrefix + Object::GenerateHashID();
 }
 
 void Object::ResetID()
 {
     GenerateID();
+    this->NotifyTreeChange();
+}
+
+void Object::NotifyTreeChange()
+{
+    Object *root = this;
+    while (root->m_parent) root = root->m_parent;
+    if (root->Is(DOC)) vrv_cast<Doc *>(root)->IncrementTreeChangeCounter();
 }
 
 void Object::SetParent(Object *parent)
 {
     assert(!m_parent);
     m_parent = parent;
+    this->NotifyTreeChange();
+}
+
+void Object::ResetParent()
+{
+    // Notify the document before the object is detached from it
+    this->NotifyTreeChange();
+    m_parent = NULL;
 }
 
 bool Object::IsSupportedChild(Object *child)
@@ -1018,7 +1189,16 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         return;
     }
 
+    // Only the outermost processing of the functor is recorded by the profiler
+    if (FunctorProfiler::IsEnabled() && !functor.IsProfiled()) {
+        FunctorProfiler::Profile(functor, [&]() { this->Process(functor, deepness, skipFirst); });
+        return;
+    }
+
+    functor.IncrementNodeCount();
+
     if (!skipFirst) {
+        functor.IncrementAcceptCount();
         FunctorCode code = this->Accept(functor);
         functor.SetCode(code);
     }
@@ -1061,6 +1241,7 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
     }
 
     if (functor.ImplementsEndInterface() && !skipFirst) {
+        functor.IncrementAcceptCount();
         FunctorCode code = this->AcceptEnd(functor);
         functor.SetCode(code);
     }
@@ -1072,7 +1253,16 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         return;
     }
 
+    // Only the outermost processing of the functor is recorded by the profiler
+    if (FunctorProfiler::IsEnabled() && !functor.IsProfiled()) {
+        FunctorProfiler::Profile(functor, [&]() { this->Process(functor, deepness, skipFirst); });
+        return;
+    }
+
+    functor.IncrementNodeCount();
+
     if (!skipFirst) {
+        functor.IncrementAcceptCount();
         FunctorCode code = this->Accept(functor);
         functor.SetCode(code);
     }
@@ -1115,11 +1305,109 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
     }
 
     if (functor.ImplementsEndInterface() && !skipFirst) {
+        functor.IncrementAcceptCount();
         FunctorCode code = this->AcceptEnd(functor);
         functor.SetCode(code);
     }
 }
 
+void Object::Process(CompositeFunctor &functor, int deepness, bool skipFirst)
+{
+    const std::vector<Functor *> &functors = functor.GetFunctors();
+    if (functors.empty()) return;
+
+    const bool direction = functors.front()->GetDirection();
+    assert(std::all_of(functors.begin(), functors.end(),
+        [direction](const Functor *functor) { return (functor->GetDirection() == direction); }));
+    assert(functors.size() <= COMPOSITE_FUNCTOR_MAX);
+    const uint32_t allFunctors = (uint32_t)((uint64_t(1) << functors.size()) - 1);
+
+    if (FunctorProfiler::IsEnabled()) {
+        FunctorProfiler::Profile(
+            functors, [&]() { this->ProcessFunctors(functors, allFunctors, direction, deepness, skipFirst); });
+        return;
+    }
+
+    this->ProcessFunctors(functors, allFunctors, direction, deepness, skipFirst);
+}
+
+void Object::ProcessFunctors(
+    const std::vector<Functor *> &functors, uint32_t activeFunctors, bool direction, int deepness, bool skipFirst)
+{
+    // The functors for which the end interface is called and the ones going deeper, as bits of their index
+    uint32_t endFunctors = 0;
+    uint32_t childFunctors = 0;
+
+    if (this->IsEditorialElement()) {
+        // since editorial object doesn't count, we increase the deepness limit
+        ++deepness;
+    }
+
+    bool hasFilters = false;
+    for (int i = 0; i < (int)functors.size(); ++i) {
+        if (!(activeFunctors & (1u << i))) continue;
+        Functor *functor = functors[i];
+        if (functor->GetCode() == FUNCTOR_STOP) continue;
+
+        functor->IncrementNodeCount();
+
+        if (!skipFirst) {
+            functor->IncrementAcceptCount();
+            FunctorCode code = this->Accept(*functor);
+            functor->SetCode(code);
+        }
+
+        // do not go any deeper in this case
+        if (functor->GetCode() == FUNCTOR_SIBLINGS) {
+            functor->SetCode(FUNCTOR_CONTINUE);
+            continue;
+        }
+        if (deepness == 0) continue;
+
+        endFunctors |= (1u << i);
+        if (!this->SkipChildren(functor->VisibleOnly())) {
+            childFunctors |= (1u << i);
+            if (functor->GetFilters()) hasFilters = true;
+        }
+    }
+
+    if (childFunctors) {
+        --deepness;
+        auto processChild = [&](Object *child) {
+            if (!hasFilters) {
+                child->ProcessFunctors(functors, childFunctors, direction, deepness, false);
+                return;
+            }
+            // The functors matching the filters for the current child
+            uint32_t filteredFunctors = 0;
+            for (int i = 0; i < (int)functors.size(); ++i) {
+                if (!(childFunctors & (1u << i))) continue;
+                // we will end here if there is no filter at all or for the current child type
+                if (this->FiltersApply(functors[i]->GetFilters(), child)) filteredFunctors |= (1u << i);
+            }
+            if (filteredFunctors) child->ProcessFunctors(functors, filteredFunctors, direction, deepness, false);
+        };
+        if (direction == BACKWARD) {
+            std::for_each(m_children.rbegin(), m_children.rend(), processChild);
+        }
+        else {
+            std::for_each(m_children.begin(), m_children.end(), processChild);
+        }
+    }
+
+    if (skipFirst) return;
+
+    for (int i = 0; i < (int)functors.size(); ++i) {
+        if (!(endFunctors & (1u << i))) continue;
+        Functor *functor = functors[i];
+        if (functor->ImplementsEndInterface()) {
+            functor->IncrementAcceptCount();
+            FunctorCode code = this->AcceptEnd(*functor);
+            functor->SetCode(code);
+        }
+    }
+}
+
 FunctorCode Object::Accept(Functor &functor)
 {
     return functor.VisitObject(this);
@@ -1146,21 +1434,21 @@ bool Object::SkipChildren(bool visibleOnly) const
         if (this->IsEditorialElement()) {
             const EditorialElement *editorialElement = vrv_cast<const EditorialElement *>(this);
             assert(editorialElement);
-            if (editorialElement->m_visibility == Hidden) {
+            if (editorialElement->GetVisibility() == Hidden) {
                 return true;
             }
         }
         else if (this->Is(MDIV)) {
             const Mdiv *mdiv = vrv_cast<const Mdiv *>(this);
             assert(mdiv);
-            if (mdiv->m_visibility == Hidden) {
+            if (mdiv->GetVisibility() == Hidden) {
                 return true;
             }
         }
         else if (this->IsSystemElement()) {
             const SystemElement *systemElement = vrv_cast<const SystemElement *>(this);
             assert(systemElement);
-            if (systemElement->m_visibility == Hidden) {
+            if (systemElement->GetVisibility() == Hidden) {
                 return true;
             }
         }
@@ -1168,6 +1456,35 @@ bool Object::SkipChildren(bool visibleOnly) const
     return false;
 }
 
+bool Object::IsVisibleDescendantOf(const Object *ancestor) const
+{
+    const Object *current = m_parent;
+    while (current) {
+        // Children of hidden objects are not reached by the traversal
+        if (current->SkipChildren(true)) return false;
+        if (current == ancestor) return true;
+        current = current->m_parent;
+    }
+    return false;
+}
+
+const ArrayOfConstObjects *Object::GetIndexedDescendants(Comparison *comparison) const
+{
+    // Only the document and its pages are indexed
+    if (!this->Is({ DOC, PAGE })) return NULL;
+
+    // A reversed comparison or a comparison on OBJECT does not look for a type
+    ClassIdComparison *classIdComparison = dynamic_cast<ClassIdComparison *>(comparison);
+    if (!classIdComparison || classIdComparison->IsReversed() || (classIdComparison->GetType() == OBJECT)) {
+        return NULL;
+    }
+
+    const Doc *doc = this->Is(DOC) ? vrv_cast<const Doc *>(this) : vrv_cast<const Doc *>(this->GetFirstAncestor(DOC));
+    if (!doc) return NULL;
+
+    return doc->FindIndexedByType(this, classIdComparison->GetType());
+}
+
 bool Object::FiltersApply(const Filters *filters, Object *object) const
 {
     return filters ? filters->Apply(object) : true;
@@ -1217,6 +1534,14 @@ void Object::SeedID(uint32_t seed)
         // Deterministic start ID
         s_xmlIDCounter = Hash(seed);
     }
+    // Do not seed again when the first object of the thread is created
+    if (s_objectCounter == 0) s_objectCounter = 1;
+}
+
+void Object::SetIDCounter(uint32_t counter)
+{
+    s_xmlIDCounter = counter;
+    if (s_objectCounter == 0) s_objectCounter = 1;
 }
 
 std::string Object::GenerateHashID()
@@ -1552,12 +1877,9 @@ void TextListInterface::FilterList(ListOfConstObjects &childList) const
 // ObjectFactory methods
 //----------------------------------------------------------------------------
 
-thread_local MapOfStrConstructors ObjectFactory::s_ctorsRegistry;
-thread_local MapOfStrClassIds ObjectFactory::s_classIdsRegistry;
-
 ObjectFactory *ObjectFactory::GetInstance()
 {
-    static thread_local ObjectFactory factory;
+    static ObjectFactory factory;
     return &factory;
 }
 
@@ -1565,8 +1887,8 @@ Object *ObjectFactory::Create(std::string name)
 {
     Object *object = NULL;
 
-    MapOfStrConstructors::iterator it = s_ctorsRegistry.find(name);
-    if (it != s_ctorsRegistry.end()) object = it->second();
+    MapOfStrConstructors::iterator it = m_ctorsRegistry.find(name);
+    if (it != m_ctorsRegistry.end()) object = it->second();
 
     if (object) {
         return object;
@@ -1581,8 +1903,8 @@ ClassId ObjectFactory::GetClassId(std::string name)
 {
     ClassId classId = OBJECT;
 
-    MapOfStrClassIds::iterator it = s_classIdsRegistry.find(name);
-    if (it != s_classIdsRegistry.end()) {
+    MapOfStrClassIds::iterator it = m_classIdsRegistry.find(name);
+    if (it != m_classIdsRegistry.end()) {
         classId = it->second;
     }
     else {
@@ -1595,8 +1917,8 @@ ClassId ObjectFactory::GetClassId(std::string name)
 void ObjectFactory::GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds)
 {
     for (const std::string &str : classStrings) {
-        if (s_classIdsRegistry.count(str) > 0) {
-            classIds.push_back(s_classIdsRegistry.at(str));
+        if (m_classIdsRegistry.count(str) > 0) {
+            classIds.push_back(m_classIdsRegistry.at(str));
         }
         else {
             LogDebug("Class name '%s' could not be matched", str.c_str());
@@ -1604,10 +1926,17 @@ void ObjectFactory::GetClassIds(const std::vector<std::string> &classStrings, st
     }
 }
 
-void ObjectFactory::Register(std::string name, ClassId classId, std::function<Object *(void)> function)
+size_t ObjectFactory::GetClassSize(ClassId classId) const
+{
+    std::map<ClassId, size_t>::const_iterator it = m_classSizesRegistry.find(classId);
+    return (it != m_classSizesRegistry.end()) ? it->second : 0;
+}
+
+void ObjectFactory::Register(std::string name, ClassId classId, size_t size, std::function<Object *(void)> function)
 {
-    s_ctorsRegistry[name] = function;
-    s_classIdsRegistry[name] = classId;
+    m_ctorsRegistry[name] = function;
+    m_classIdsRegistry[name] = classId;
+    m_classSizesRegistry[classId] = size;
 }
 
 } // namespace vrv
@@ -1047,6 +1047,18 @@ Options::Options()
     m_landscape.Init(false);
     this->Register(&m_landscape, "landscape", &m_general);
 
+    m_layoutCache.SetInfo("Layout cache",
+        "The directory where the cast-off layouts are cached and reused when loading the same data again with the "
+        "same layout options");
+    m_layoutCache.Init("");
+    this->Register(&m_layoutCache, "layoutCache", &m_general);
+
+    m_layoutThreads.SetInfo("Layout threads",
+        "The number of threads for laying out and rendering multiple pages or for processing batches of inputs (0 for "
+        "one thread per core)");
+    m_layoutThreads.Init(1, 0, 256);
+    this->Register(&m_layoutThreads, "layoutThreads", &m_general);
+
     m_minLastJustification.SetInfo("Minimum last-system-justification width",
         "The last system is only justified if the unjustified width is greater than this percent");
     m_minLastJustification.Init(0.8, 0.0, 1.0);
@@ -1123,6 +1135,11 @@ Options::Options()
     m_preserveAnalyticalMarkup.Init(false);
     this->Register(&m_preserveAnalyticalMarkup, "preserveAnalyticalMarkup", &m_general);
 
+    m_profileFunctors.SetInfo("Show functor profile on CLI",
+        "Display the processing time and the number of nodes visited of each functor class on command-line");
+    m_profileFunctors.Init(false);
+    this->Register(&m_profileFunctors, "profileFunctors", &m_general);
+
     m_removeIds.SetInfo("Remove IDs in MEI", "Remove XML IDs in the MEI output that are not referenced");
     m_removeIds.Init(false);
     this->Register(&m_removeIds, "removeIds", &m_general);
@@ -1812,6 +1829,39 @@ Options::Options()
     m_mensuralToMeasure.Init(false);
     this->Register(&m_mensuralToMeasure, "mensuralToMeasure", &m_mensural);
 
+    /********* Layout stages *********/
+
+    // Options not listed here invalidate the horizontal layout (default)
+    // The scale changes the page size only with scaleToPageSize - see Options::GetStage
+    const std::list<std::pair<OptionsStage, std::list<Option *>>> optionStages = {
+        { OptionsStage::Prepare,
+            { &m_appXPathQuery, &m_choiceXPathQuery, &m_expand, &m_footer, &m_header, &m_adjustPageHeight, &m_humType,
+                &m_incip, &m_inputFrom, &m_loadSelectedMdivOnly, &m_mdivAll, &m_mdivXPathQuery, &m_mensuralToMeasure,
+                &m_moveScoreDefinitionToStaff, &m_openControlEvents, &m_preserveAnalyticalMarkup, &m_substXPathQuery,
+                &m_transpose, &m_transposeMdiv, &m_transposeSelectedOnly, &m_transposeToSoundingPitch, &m_useFacsimile,
+                &m_xmlIdChecksum, &m_xmlIdSeed } },
+        { OptionsStage::CastOffSystems,
+            { &m_breaks, &m_breaksNoWidow, &m_breaksSmartSb, &m_condense, &m_condenseFirstPage,
+                &m_condenseNotLastSystem, &m_condenseTempoPages, &m_landscape, &m_pageMarginLeft, &m_pageMarginRight,
+                &m_pageWidth, &m_scaleToPageSize } },
+        { OptionsStage::CastOffPages,
+            { &m_pageHeight, &m_pageMarginBottom, &m_pageMarginTop, &m_systemMaxPerPage, &m_usePgFooterForAll,
+                &m_usePgHeaderForAll } },
+        { OptionsStage::Vertical,
+            { &m_adjustPageWidth, &m_justificationBraceGroup, &m_justificationBracketGroup, &m_justificationMaxVertical,
+                &m_justificationStaff, &m_justificationSystem, &m_justifyVertically, &m_minLastJustification,
+                &m_noJustification, &m_svgBoundingBoxes } },
+        { OptionsStage::Draw,
+            { &m_allPages, &m_help, &m_layoutCache, &m_layoutThreads, &m_logLevel, &m_midiNoCue, &m_midiTempoAdjustment,
+                &m_mmOutput, &m_outfile, &m_outputFormatRaw, &m_outputIndent, &m_outputIndentTab,
+                &m_outputSmuflXmlEntities, &m_outputTo, &m_page, &m_profileFunctors, &m_removeIds, &m_resourcePath,
+                &m_scale, &m_showRuntime, &m_smuflTextFont, &m_standardOutput, &m_svgAdditionalAttribute, &m_svgCss,
+                &m_svgFormatRaw, &m_svgHtml5, &m_svgRemoveXlink, &m_svgViewBox, &m_version } }
+    };
+    for (const auto &[stage, options] : optionStages) {
+        for (Option *option : options) option->SetStage(stage);
+    }
+
     /********* Deprecated options *********/
 
     /*
@@ -1931,6 +1981,46 @@ void Options::Sync()
         [](const std::string &key) { LogError("Unsupported engraving default '%s'", key.c_str()); });
 }
 
+std::map<std::string, std::string> Options::GetStrValues(OptionsStage stage) const
+{
+    std::map<std::string, std::string> values;
+    for (const Option *option : *this->GetBaseOptions()) {
+        if (this->GetStage(option) >= stage) values[option->GetKey()] = option->GetStrValue();
+    }
+    for (const auto &[key, option] : m_items) {
+        if (this->GetStage(option) >= stage) values[key] = option->GetStrValue();
+    }
+    return values;
+}
+
+OptionsStage Options::GetChangedStage(const std::map<std::string, std::string> &values) const
+{
+    OptionsStage stage = OptionsStage::None;
+    auto updateStage = [this, &values, &stage](const Option *option) {
+        const OptionsStage optionStage = this->GetStage(option);
+        // Only the options invalidating an earlier stage need to be compared
+        if (optionStage <= stage) return;
+        const auto iter = values.find(option->GetKey());
+        if ((iter != values.end()) && (iter->second == option->GetStrValue())) return;
+        stage = optionStage;
+    };
+
+    for (const Option *option : *this->GetBaseOptions()) {
+        updateStage(option);
+    }
+    for (const auto &[key, option] : m_items) {
+        updateStage(option);
+    }
+    return stage;
+}
+
+OptionsStage Options::GetStage(const Option *option) const
+{
+    // The scale changes the page size only with scaleToPageSize
+    if ((option == &m_scale) && m_scaleToPageSize.GetValue()) return OptionsStage::CastOffSystems;
+    return option->GetStage();
+}
+
 void Options::Register(Option *option, const std::string &key, OptionGrp *grp)
 {
     assert(option);
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 
 //----------------------------------------------------------------------------
@@ -188,7 +189,7 @@ const RunningElement *Page::GetFooter() const
 
 void Page::LayOut(bool force)
 {
-    if (m_layoutDone && !force) {
+    if (m_layoutDone && !force && !this->HasLayoutDirtySystems()) {
         // We only need to reset the header - this will adjust the page number if necessary
         if (this->GetHeader()) this->GetHeader()->SetDrawingPage(this);
         if (this->GetFooter()) this->GetFooter()->SetDrawingPage(this);
@@ -196,6 +197,11 @@ void Page::LayOut(bool force)
     }
 
     this->LayOutHorizontally();
+    this->LayOutAfterHorizontally();
+}
+
+void Page::LayOutAfterHorizontally()
+{
     this->JustifyHorizontally();
     this->LayOutVertically();
     this->JustifyVertically();
@@ -211,9 +217,21 @@ void Page::LayOut(bool force)
         view.DrawCurrentPage(&bBoxDC, false);
     }
 
+    for (Object *child : this->GetChildren()) {
+        if (child->Is(SYSTEM)) vrv_cast<System *>(child)->SetLayoutDirty(false);
+    }
+
     m_layoutDone = true;
 }
 
+bool Page::HasLayoutDirtySystems() const
+{
+    const ArrayOfConstObjects children = this->GetChildren();
+    return std::any_of(children.begin(), children.end(), [](const Object *child) {
+        return (child->Is(SYSTEM) && vrv_cast<const System *>(child)->IsLayoutDirty());
+    });
+}
+
 void Page::LayOutTranscription(bool force)
 {
     if (m_layoutDone && !force) {
@@ -80,13 +80,6 @@ FunctorCode PrepareDataInitializationFunctor::VisitChord(Chord *chord)
     return FUNCTOR_CONTINUE;
 }
 
-FunctorCode PrepareDataInitializationFunctor::VisitFloatingObject(FloatingObject *floatingObject)
-{
-    floatingObject->ResetDrawingObjectIDs();
-
-    return FUNCTOR_CONTINUE;
-}
-
 FunctorCode PrepareDataInitializationFunctor::VisitKeySig(KeySig *keySig)
 {
     // Clear and regenerate attribute children
@@ -9,6 +9,8 @@
 
 //----------------------------------------------------------------------------
 
+#include <cstring>
+#include <fstream>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -19,6 +21,7 @@
 
 //----------------------------------------------------------------------------
 
+#include "crc.h"
 #include "pugixml.hpp"
 
 namespace vrv {
@@ -30,6 +33,8 @@ namespace vrv {
 thread_local std::string Resources::s_defaultPath = VRV_RESOURCE_DIR;
 const Resources::StyleAttributes Resources::k_defaultStyle{ data_FONTWEIGHT::FONTWEIGHT_normal,
     data_FONTSTYLE::FONTSTYLE_normal };
+std::map<std::string, std::shared_ptr<const Resources::FontTables>> Resources::s_fontRegistry;
+std::mutex Resources::s_fontRegistryMutex;
 
 //----------------------------------------------------------------------------
 // Function defined in toolkitdef.h
@@ -40,6 +45,104 @@ void SetDefaultResourcePath(const std::string &path)
     Resources::SetDefaultPath(path);
 }
 
+//----------------------------------------------------------------------------
+// GlyphTableReader
+//----------------------------------------------------------------------------
+
+/**
+ * This class reads a binary glyph table, which is a precompiled bounding box file generated with
+ * the ./fonts/generate.py bin script. All values are little-endian and the layout is:
+ * - header: "VRVG", uint16 version, uint16 flags (unused), int32 units per em, uint32 glyph count, uint32 CRC-32 of
+ *   the XML bounding box file it was generated from
+ * - for each glyph: uint32 code, float x, y, w, h, h-a-x, uint8 h-a-x flag, string code, string name,
+ *   uint8 anchor count and for each anchor: string name, float x, y
+ * Strings are stored as their uint8 length followed by their UTF-8 characters.
+ */
+class GlyphTableReader {
+public:
+    GlyphTableReader(const std::string &filename)
+    {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) return;
+        m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_error = false;
+    }
+
+    /**
+     * Read the header and return false if the file is missing, is not a glyph table of the current version, or was
+     * not generated from the current content of the XML file. The glyph table is used as it is without the XML file.
+     */
+    bool ReadHeader(const std::string &xmlFilename)
+    {
+        if ((m_data.size() < 4) || m_data.compare(0, 4, "VRVG")) return false;
+        m_pos = 4;
+        const int version = this->ReadUInt(2);
+        this->ReadUInt(2);
+        m_unitsPerEm = (int)this->ReadUInt(4);
+        m_glyphCount = this->ReadUInt(4);
+        const uint32_t checksum = this->ReadUInt(4);
+        if (m_error || (version != 2)) return false;
+
+        std::ifstream file(xmlFilename, std::ios::binary);
+        if (!file.is_open()) return true;
+        const std::string xml((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        // The lookup table of crcFast is initialized only once for all threads
+        [[maybe_unused]] static const bool crcTableInit = (crcInit(), true);
+        if (crcFast((const unsigned char *)xml.data(), (int)xml.size()) != checksum) {
+            LogWarning("Glyph table for '%s' is outdated, the XML file will be loaded instead", xmlFilename.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    int GetUnitsPerEm() const { return m_unitsPerEm; }
+    uint32_t GetGlyphCount() const { return m_glyphCount; }
+    bool HasError() const { return m_error; }
+
+    uint32_t ReadUInt(int bytes)
+    {
+        if (m_pos + bytes > m_data.size()) {
+            m_error = true;
+            return 0;
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= (uint32_t)(unsigned char)m_data[m_pos++] << (8 * i);
+        }
+        return value;
+    }
+
+    float ReadFloat()
+    {
+        const uint32_t bits = this->ReadUInt(4);
+        float value;
+        std::memcpy(&value, &bits, sizeof(float));
+        return value;
+    }
+
+    std::string ReadString()
+    {
+        const int length = this->ReadUInt(1);
+        if (m_pos + length > m_data.size()) {
+            m_error = true;
+            return "";
+        }
+        m_pos += length;
+        return m_data.substr(m_pos - length, length);
+    }
+
+private:
+    /** The content of the file */
+    std::string m_data;
+    /** The current reading position */
+    size_t m_pos = 0;
+    /** Values from the header */
+    int m_unitsPerEm = 0;
+    uint32_t m_glyphCount = 0;
+    /** A flag set when the file is missing or when reading beyond its end */
+    bool m_error = true;
+};
+
 //----------------------------------------------------------------------------
 // Resources
 //----------------------------------------------------------------------------
@@ -47,19 +150,32 @@ void SetDefaultResourcePath(const std::string &path)
 Resources::Resources()
 {
     m_path = s_defaultPath;
+    m_fonts = std::make_shared<const FontTables>();
     m_currentStyle = k_defaultStyle;
 }
 
 bool Resources::InitFonts()
 {
+    m_currentStyle = k_defaultStyle;
+
+    // The fonts are loaded only once for a resource path
+    const std::string key = m_path + "\nBravura\nLeipzig";
+    if (this->UseRegisteredFonts(key)) return true;
+
+    std::shared_ptr<FontTables> fonts = std::make_shared<FontTables>();
+    // Keep what could be loaded even if something fails below, but without sharing it
+    m_fonts = fonts;
+    m_fontsKey.clear();
+
     // We will need to rethink this for adding the option to add custom fonts
     // Font Bravura first since it is expected to have always all symbols
-    if (!LoadFont("Bravura", false)) LogError("Bravura font could not be loaded.");
+    if (!LoadFont(*fonts, "Bravura", false)) LogError("Bravura font could not be loaded.");
     // The Leipzig as the default font
-    if (!LoadFont("Leipzig", false)) LogError("Leipzig font could not be loaded.");
+    if (!LoadFont(*fonts, "Leipzig", false)) LogError("Leipzig font could not be loaded.");
 
-    if (m_fontGlyphTable.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, m_fontGlyphTable.size());
+    if (fonts->m_fontGlyphTable.size() < SMUFL_COUNT) {
+        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT,
+            fonts->m_fontGlyphTable.size());
         return false;
     }
 
@@ -75,35 +191,97 @@ bool Resources::InitFonts()
               { { FONTWEIGHT_normal, FONTSTYLE_italic }, "Times-italic", false } };
 
     for (const auto &textFontInfo : textFontInfos) {
-        if (!InitTextFont(textFontInfo.m_fileName, textFontInfo.m_style) && textFontInfo.m_isMandatory) {
+        if (!InitTextFont(*fonts, textFontInfo.m_fileName, textFontInfo.m_style) && textFontInfo.m_isMandatory) {
             LogError("Text font could not be initialized.");
             return false;
         }
     }
 
-    m_currentStyle = k_defaultStyle;
+    this->RegisterFonts(key, fonts);
 
     return true;
 }
 
+bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes &style)
+{
+    // Copy the glyph tables since they can be shared - they are then not shared anymore
+    std::shared_ptr<FontTables> fonts = std::make_shared<FontTables>(*m_fonts);
+    if (!this->InitTextFont(*fonts, fontName, style)) return false;
+    m_fonts = fonts;
+    m_fontsKey.clear();
+    return true;
+}
+
 bool Resources::SetFont(const std::string &fontName)
 {
-    return LoadFont(fontName);
+    std::string key;
+    if (!m_fontsKey.empty()) {
+        // Loading a font replaces all its glyphs and sets all the other ones as fallback, which means that only the
+        // last time a font is loaded matters. Previous occurrences are removed from the key to keep the registry small.
+        const std::string component = "\n+" + fontName;
+        key = m_fontsKey;
+        size_t pos = key.find(component + "\n");
+        if (pos == std::string::npos) {
+            pos = (key.size() >= component.size()) ? key.size() - component.size() : std::string::npos;
+            if ((pos != std::string::npos) && (key.compare(pos, component.size(), component) != 0)) {
+                pos = std::string::npos;
+            }
+        }
+        if (pos != std::string::npos) key.erase(pos, component.size());
+        key += component;
+        if (this->UseRegisteredFonts(key)) return true;
+    }
+
+    // Copy the glyph tables since they can be shared
+    std::shared_ptr<FontTables> fonts = std::make_shared<FontTables>(*m_fonts);
+    if (!LoadFont(*fonts, fontName)) return false;
+
+    if (key.empty()) {
+        m_fonts = fonts;
+    }
+    else {
+        this->RegisterFonts(key, fonts);
+    }
+    return true;
+}
+
+bool Resources::UseRegisteredFonts(const std::string &key)
+{
+    const std::lock_guard<std::mutex> lock(s_fontRegistryMutex);
+    auto it = s_fontRegistry.find(key);
+    if (it == s_fontRegistry.end()) return false;
+    m_fonts = it->second;
+    m_fontsKey = key;
+    return true;
+}
+
+void Resources::RegisterFonts(const std::string &key, std::shared_ptr<const FontTables> fonts)
+{
+    const std::lock_guard<std::mutex> lock(s_fontRegistryMutex);
+    // Does not replace the glyph tables if they have been registered in the meantime
+    auto it = s_fontRegistry.emplace(key, fonts).first;
+    m_fonts = it->second;
+    m_fontsKey = key;
 }
 
 const Glyph *Resources::GetGlyph(char32_t smuflCode) const
 {
-    return m_fontGlyphTable.count(smuflCode) ? &m_fontGlyphTable.at(smuflCode) : NULL;
+    const GlyphTable &fontGlyphTable = m_fonts->m_fontGlyphTable;
+    auto it = fontGlyphTable.find(smuflCode);
+    return (it != fontGlyphTable.end()) ? &it->second : NULL;
 }
 
 const Glyph *Resources::GetGlyph(const std::string &smuflName) const
 {
-    return m_glyphNameTable.count(smuflName) ? &m_fontGlyphTable.at(m_glyphNameTable.at(smuflName)) : NULL;
+    const char32_t code = this->GetGlyphCode(smuflName);
+    return (code) ? this->GetGlyph(code) : NULL;
 }
 
 char32_t Resources::GetGlyphCode(const std::string &smuflName) const
 {
-    return m_glyphNameTable.count(smuflName) ? m_glyphNameTable.at(smuflName) : 0;
+    const GlyphNameTable &glyphNameTable = m_fonts->m_glyphNameTable;
+    auto it = glyphNameTable.find(smuflName);
+    return (it != glyphNameTable.end()) ? it->second : 0;
 }
 
 bool Resources::IsSmuflFallbackNeeded(const std::u32string &text) const
@@ -126,7 +304,7 @@ void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontSt
     }
 
     m_currentStyle = { fontWeight, fontStyle };
-    if (m_textFont.count(m_currentStyle) == 0) {
+    if (m_fonts->m_textFont.count(m_currentStyle) == 0) {
         LogWarning("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
         m_currentStyle = k_defaultStyle;
     }
@@ -134,10 +312,11 @@ void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontSt
 
 const Glyph *Resources::GetTextGlyph(char32_t code) const
 {
-    const StyleAttributes style = (m_textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
-    if (m_textFont.count(style) == 0) return NULL;
+    const GlyphTextMap &textFont = m_fonts->m_textFont;
+    const StyleAttributes style = (textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
+    if (textFont.count(style) == 0) return NULL;
 
-    const GlyphTable &currentTable = m_textFont.at(style);
+    const GlyphTable &currentTable = textFont.at(style);
     if (currentTable.count(code) == 0) {
         return NULL;
     }
@@ -158,8 +337,11 @@ char32_t Resources::GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar)
     return smuflChar;
 }
 
-bool Resources::LoadFont(const std::string &fontName, bool withFallback)
+bool Resources::LoadFont(FontTables &fonts, const std::string &fontName, bool withFallback) const
 {
+    // Use the binary glyph table when there is one since it is faster to load than the XML file
+    if (this->LoadFontGlyphTable(fonts, fontName, withFallback)) return true;
+
     pugi::xml_document doc;
     const std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
     pugi::xml_parse_result parseResult = doc.load_file(filename.c_str());
@@ -175,7 +357,7 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
     }
 
     if (withFallback) {
-        for (auto &glyph : m_fontGlyphTable) {
+        for (auto &glyph : fonts.m_fontGlyphTable) {
             glyph.second.SetFallback(true);
         }
     }
@@ -212,16 +394,73 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
 
         const char32_t smuflCode = (char32_t)strtol(c_attribute.value(), NULL, 16);
         glyph.SetFallback(false);
-        m_fontGlyphTable[smuflCode] = glyph;
-        m_glyphNameTable[n_attribute.value()] = smuflCode;
+        fonts.m_fontGlyphTable[smuflCode] = glyph;
+        fonts.m_glyphNameTable[n_attribute.value()] = smuflCode;
     }
 
-    m_fontName = fontName;
+    fonts.m_fontName = fontName;
     return true;
 }
 
-bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes &style)
+bool Resources::LoadFontGlyphTable(FontTables &fonts, const std::string &fontName, bool withFallback) const
+{
+    GlyphTableReader reader(Resources::GetPath() + "/" + fontName + ".bin");
+    if (!reader.ReadHeader(Resources::GetPath() + "/" + fontName + ".xml")) return false;
+
+    if (withFallback) {
+        for (auto &glyph : fonts.m_fontGlyphTable) {
+            glyph.second.SetFallback(true);
+        }
+    }
+
+    const int unitsPerEm = reader.GetUnitsPerEm();
+
+    for (uint32_t i = 0; i < reader.GetGlyphCount(); ++i) {
+        const char32_t smuflCode = (char32_t)reader.ReadUInt(4);
+        const float x = reader.ReadFloat();
+        const float y = reader.ReadFloat();
+        const float width = reader.ReadFloat();
+        const float height = reader.ReadFloat();
+        const float horizAdvX = reader.ReadFloat();
+        const bool hasHorizAdvX = reader.ReadUInt(1);
+        const std::string codeStr = reader.ReadString();
+        const std::string name = reader.ReadString();
+
+        Glyph glyph;
+        glyph.SetUnitsPerEm(unitsPerEm * 10);
+        glyph.SetCodeStr(codeStr);
+        glyph.SetBoundingBox(x, y, width, height);
+        glyph.SetPath(Resources::GetPath() + "/" + fontName + "/" + codeStr + ".xml");
+        if (hasHorizAdvX) glyph.SetHorizAdvX(horizAdvX);
+
+        const int anchorCount = reader.ReadUInt(1);
+        for (int j = 0; j < anchorCount; ++j) {
+            const std::string anchorName = reader.ReadString();
+            const float anchorX = reader.ReadFloat();
+            const float anchorY = reader.ReadFloat();
+            glyph.SetAnchor(anchorName, anchorX, anchorY);
+        }
+
+        if (reader.HasError()) {
+            LogWarning("Glyph table for font '%s' is corrupted, the XML file will be loaded instead", fontName.c_str());
+            return false;
+        }
+        if (name.empty()) continue;
+
+        glyph.SetFallback(false);
+        fonts.m_fontGlyphTable[smuflCode] = glyph;
+        fonts.m_glyphNameTable[name] = smuflCode;
+    }
+
+    fonts.m_fontName = fontName;
+    return true;
+}
+
+bool Resources::InitTextFont(FontTables &fonts, const std::string &fontName, const StyleAttributes &style) const
 {
+    // Use the binary glyph table when there is one since it is faster to load than the XML file
+    if (this->InitTextFontGlyphTable(fonts, fontName, style)) return true;
+
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
@@ -240,10 +479,10 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
     }
     const int unitsPerEm = root.attribute("units-per-em").as_int();
     pugi::xml_node current;
-    if (m_textFont.count(style) == 0) {
-        m_textFont[style] = {};
+    if (fonts.m_textFont.count(style) == 0) {
+        fonts.m_textFont[style] = {};
     }
-    GlyphTable &currentTable = m_textFont.at(style);
+    GlyphTable &currentTable = fonts.m_textFont.at(style);
     for (current = root.child("g"); current; current = current.next_sibling("g")) {
         if (current.attribute("c")) {
             char32_t code = (char32_t)strtol(current.attribute("c").value(), NULL, 16);
@@ -268,4 +507,49 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
     return true;
 }
 
+bool Resources::InitTextFontGlyphTable(
+    FontTables &fonts, const std::string &fontName, const StyleAttributes &style) const
+{
+    GlyphTableReader reader(GetPath() + "/text/" + fontName + ".bin");
+    if (!reader.ReadHeader(GetPath() + "/text/" + fontName + ".xml")) return false;
+
+    const int unitsPerEm = reader.GetUnitsPerEm();
+    GlyphTable currentTable;
+    for (uint32_t i = 0; i < reader.GetGlyphCount(); ++i) {
+        const char32_t code = (char32_t)reader.ReadUInt(4);
+        const float x = reader.ReadFloat();
+        const float y = reader.ReadFloat();
+        const float width = reader.ReadFloat();
+        const float height = reader.ReadFloat();
+        const float horizAdvX = reader.ReadFloat();
+        const bool hasHorizAdvX = reader.ReadUInt(1);
+        // Code string, name and anchors are not used for the text font
+        reader.ReadString();
+        reader.ReadString();
+        const int anchorCount = reader.ReadUInt(1);
+        for (int j = 0; j < anchorCount; ++j) {
+            reader.ReadString();
+            reader.ReadFloat();
+            reader.ReadFloat();
+        }
+
+        Glyph glyph(unitsPerEm);
+        glyph.SetBoundingBox(x, y, width, height);
+        if (hasHorizAdvX) glyph.SetHorizAdvX(horizAdvX);
+        currentTable[code] = glyph;
+    }
+
+    if (reader.HasError()) {
+        LogWarning("Glyph table for text font '%s' is corrupted, the XML file will be loaded instead", fontName.c_str());
+        return false;
+    }
+
+    // Merge with the glyphs already loaded for the style (if any), as done with the XML file
+    GlyphTable &styleTable = fonts.m_textFont[style];
+    for (auto &entry : currentTable) {
+        styleTable[entry.first] = entry.second;
+    }
+    return true;
+}
+
 } // namespace vrv
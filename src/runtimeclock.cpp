@@ -7,12 +7,25 @@
 
 #include "runtimeclock.h"
 
-#ifndef NO_RUNTIME
+//----------------------------------------------------------------------------
+
+#include <typeinfo>
+
+#ifdef __GNUG__
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "functor.h"
 
 //----------------------------------------------------------------------------
 
 namespace vrv {
 
+#ifndef NO_RUNTIME
+
 //----------------------------------------------------------------------------
 // RuntimeClock
 //----------------------------------------------------------------------------
@@ -34,6 +47,100 @@ double RuntimeClock::GetSeconds() const
     return duration<double, seconds::period>(timeDiff).count();
 }
 
-} // namespace vrv
-
 #endif // NO_RUNTIME
+
+//----------------------------------------------------------------------------
+// FunctorProfiler
+//----------------------------------------------------------------------------
+
+std::atomic<bool> FunctorProfiler::s_enabled(false);
+std::map<std::string, FunctorProfiler::Entry> FunctorProfiler::s_entries;
+std::mutex FunctorProfiler::s_mutex;
+
+void FunctorProfiler::Reset()
+{
+    const std::lock_guard<std::mutex> lock(s_mutex);
+    s_entries.clear();
+}
+
+std::map<std::string, FunctorProfiler::Entry> FunctorProfiler::GetEntries()
+{
+    const std::lock_guard<std::mutex> lock(s_mutex);
+    return s_entries;
+}
+
+void FunctorProfiler::Profile(FunctorBase &functor, const std::function<void()> &process)
+{
+    const long nodeCount = functor.GetNodeCount();
+    const long acceptCount = functor.GetAcceptCount();
+    const auto start = std::chrono::steady_clock::now();
+
+    functor.SetProfiled(true);
+    process();
+    functor.SetProfiled(false);
+
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    Record(GetName(functor), duration.count(), functor.GetNodeCount() - nodeCount,
+        functor.GetAcceptCount() - acceptCount);
+}
+
+void FunctorProfiler::Profile(const std::vector<Functor *> &functors, const std::function<void()> &process)
+{
+    // The functors processed together are recorded as one entry since the time cannot be split
+    std::string name;
+    long nodeCount = 0;
+    long acceptCount = 0;
+    for (Functor *functor : functors) {
+        if (!name.empty()) name += " + ";
+        name += GetName(*functor);
+        nodeCount -= functor->GetNodeCount();
+        acceptCount -= functor->GetAcceptCount();
+        functor->SetProfiled(true);
+    }
+    const auto start = std::chrono::steady_clock::now();
+
+    process();
+
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    for (Functor *functor : functors) {
+        nodeCount += functor->GetNodeCount();
+        acceptCount += functor->GetAcceptCount();
+        functor->SetProfiled(false);
+    }
+    Record(name, duration.count(), nodeCount, acceptCount);
+}
+
+std::string FunctorProfiler::GetName(const FunctorBase &functor)
+{
+    const char *typeName = typeid(functor).name();
+    std::string name = typeName;
+#ifdef __GNUG__
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(typeName, NULL, NULL, &status);
+    if (demangled) {
+        if (status == 0) name = demangled;
+        std::free(demangled);
+    }
+#endif
+    // Remove the "class " prefix (MSVC) and the namespace
+    const size_t pos = name.rfind("::");
+    if (pos != std::string::npos) {
+        name = name.substr(pos + 2);
+    }
+    else if (name.rfind("class ", 0) == 0) {
+        name = name.substr(6);
+    }
+    return name;
+}
+
+void FunctorProfiler::Record(const std::string &name, double seconds, long nodeCount, long acceptCount)
+{
+    const std::lock_guard<std::mutex> lock(s_mutex);
+    Entry &entry = s_entries[name];
+    ++entry.m_processCount;
+    entry.m_seconds += seconds;
+    entry.m_nodeCount += nodeCount;
+    entry.m_acceptCount += acceptCount;
+}
+
+} // namespace vrv
@@ -44,7 +44,7 @@ FunctorCode SaveFunctor::VisitDotsEnd(Dots *dots)
 FunctorCode SaveFunctor::VisitEditorialElement(EditorialElement *editorialElement)
 {
     // When writing MEI basic, only visible elements within editorial markup are saved
-    if (m_basic && (editorialElement->m_visibility == Hidden)) {
+    if (m_basic && (editorialElement->GetVisibility() == Hidden)) {
         return FUNCTOR_SIBLINGS;
     }
     else {
@@ -55,7 +55,7 @@ FunctorCode SaveFunctor::VisitEditorialElement(EditorialElement *editorialElemen
 FunctorCode SaveFunctor::VisitEditorialElementEnd(EditorialElement *editorialElement)
 {
     // Same as above
-    if (m_basic && (editorialElement->m_visibility == Hidden)) {
+    if (m_basic && (editorialElement->GetVisibility() == Hidden)) {
         return FUNCTOR_SIBLINGS;
     }
     else {
@@ -77,7 +77,7 @@ FunctorCode SaveFunctor::VisitFlagEnd(Flag *flag)
 FunctorCode SaveFunctor::VisitMdiv(Mdiv *mdiv)
 {
     MEIOutput *meiOutput = dynamic_cast<MEIOutput *>(m_output);
-    if ((mdiv->m_visibility == Hidden) && meiOutput) {
+    if ((mdiv->GetVisibility() == Hidden) && meiOutput) {
         // Do not output hidden mdivs in page-based MEI or when saving score-based MEI with filter
         if (!meiOutput->GetScoreBasedMEI() || meiOutput->HasFilter()) return FUNCTOR_SIBLINGS;
     }
@@ -87,7 +87,7 @@ FunctorCode SaveFunctor::VisitMdiv(Mdiv *mdiv)
 FunctorCode SaveFunctor::VisitMdivEnd(Mdiv *mdiv)
 {
     MEIOutput *meiOutput = dynamic_cast<MEIOutput *>(m_output);
-    if ((mdiv->m_visibility == Hidden) && meiOutput) {
+    if ((mdiv->GetVisibility() == Hidden) && meiOutput) {
         // Do not output hidden mdivs in page-based MEI or when saving score-based MEI with filter
         if (!meiOutput->GetScoreBasedMEI() || meiOutput->HasFilter()) return FUNCTOR_SIBLINGS;
     }
@@ -29,7 +29,7 @@ namespace vrv {
 // Stem
 //----------------------------------------------------------------------------
 
-static const ClassRegistrar<Note> s_factory("stem", STEM);
+static const ClassRegistrar<Stem> s_factory("stem", STEM);
 
 Stem::Stem() : LayerElement(STEM, "stem-"), AttGraced(), AttStemVis(), AttVisibility()
 {
@@ -9,16 +9,19 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 
 //----------------------------------------------------------------------------
 
+#include "comparison.h"
 #include "doc.h"
 #include "floatingobject.h"
 #include "glyph.h"
 #include "layerelement.h"
 #include "staff.h"
 #include "staffdef.h"
+#include "timeinterface.h"
 #include "view.h"
 #include "vrv.h"
 
@@ -29,6 +32,31 @@ namespace vrv {
 #define space " "
 #define semicolon ";"
 
+//----------------------------------------------------------------------------
+// Static members
+//----------------------------------------------------------------------------
+
+std::map<std::string, std::unique_ptr<pugi::xml_document>> SvgDeviceContext::s_glyphDefs;
+std::mutex SvgDeviceContext::s_glyphDefsMutex;
+
+//----------------------------------------------------------------------------
+// SvgStringWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class saves a pugixml document or node directly into a string.
+ */
+class SvgStringWriter : public pugi::xml_writer {
+public:
+    SvgStringWriter(std::string &output) : m_output(output) {}
+
+    void write(const void *data, size_t size) override { m_output.append(static_cast<const char *>(data), size); }
+
+private:
+    /** The string the output is appended to */
+    std::string &m_output;
+};
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -69,9 +97,14 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     m_svgNodeStack.push_back(m_svgNode);
     m_currentNode = m_svgNode;
 
-    m_outdata.clear();
+    m_outputFlags = pugi::format_default;
 
     m_glyphPostfixId = Object::GenerateHashID();
+
+    m_flushSystems = false;
+    m_flushPlaceholder = "systems-" + m_glyphPostfixId;
+    m_flushChecked = false;
+    m_canFlushSystems = false;
 }
 
 SvgDeviceContext::~SvgDeviceContext() {}
@@ -168,19 +201,17 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     if (m_smuflGlyphs.size() > 0) {
 
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
 
         // for each needed glyph
         for (const Glyph *smuflGlyph : m_smuflGlyphs) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source(smuflGlyph->GetPath());
-            sourceDoc.load(source);
+            // get the content of the XML file that contains it
+            const pugi::xml_document *sourceDoc = SvgDeviceContext::GetGlyphDefs(smuflGlyph);
 
             // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+            for (pugi::xml_node child = sourceDoc->first_child(); child; child = child.next_sibling()) {
                 std::string id = StringFormat("%s-%s", child.attribute("id").value(), m_glyphPostfixId.c_str());
-                child.attribute("id").set_value(id.c_str());
-                defs.append_copy(child);
+                pugi::xml_node copy = defs.append_copy(child);
+                copy.attribute("id").set_value(id.c_str());
             }
         }
     }
@@ -203,10 +234,7 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     pugi::xml_node desc = m_svgNode.prepend_child("desc");
     desc.text().set(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
 
-    // save the glyph data to m_outdata
-    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-    m_svgDoc.save(m_outdata, indent.c_str(), output_flags);
-
+    m_outputFlags = output_flags;
     m_committed = true;
 }
 
@@ -395,8 +423,12 @@ void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
 void SvgDeviceContext::EndGraphic(Object *object, View *view)
 {
     this->DrawSvgBoundingBox(object, view);
+    pugi::xml_node node = m_svgNodeStack.back();
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+
+    // Nothing is added to the group of a system once it is ended
+    if (m_flushSystems && object->Is(SYSTEM) && (node.parent() == m_pageNode)) this->FlushSystem(object, node);
 }
 
 void SvgDeviceContext::EndCustomGraphic()
@@ -1112,6 +1144,21 @@ void SvgDeviceContext::AppendAdditionalAttributes(Object *object)
     }
 }
 
+const pugi::xml_document *SvgDeviceContext::GetGlyphDefs(const Glyph *glyph)
+{
+    assert(glyph);
+
+    const std::lock_guard<std::mutex> lock(s_glyphDefsMutex);
+    std::unique_ptr<pugi::xml_document> &glyphDefs = s_glyphDefs[glyph->GetPath()];
+    if (!glyphDefs) {
+        // load the XML file that contains it as a pugi::xml_document
+        glyphDefs = std::make_unique<pugi::xml_document>();
+        std::ifstream source(glyph->GetPath());
+        glyphDefs->load(source);
+    }
+    return glyphDefs.get();
+}
+
 std::string SvgDeviceContext::GetColor(int color)
 {
     std::ostringstream ss;
@@ -1141,7 +1188,92 @@ std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
     if (!m_committed) Commit(xml_declaration);
 
-    return m_outdata.str();
+    // save the document directly into the string returned
+    std::string output;
+    SvgStringWriter writer(output);
+    this->SaveDocument(writer);
+
+    return output;
+}
+
+void SvgDeviceContext::SaveSVG(std::ostream &output, bool xml_declaration)
+{
+    if (!m_committed) Commit(xml_declaration);
+
+    pugi::xml_writer_stream writer(output);
+    this->SaveDocument(writer);
+}
+
+void SvgDeviceContext::FlushSystem(const Object *system, pugi::xml_node node)
+{
+    if (!m_flushChecked) {
+        m_canFlushSystems = this->CanFlushSystems(system->GetParent());
+        m_flushChecked = true;
+    }
+    if (!m_canFlushSystems) return;
+
+    pugi::xml_node previous = node.previous_sibling();
+    if ((previous.type() != pugi::node_comment) || (m_flushPlaceholder != previous.value())) {
+        m_pageNode.insert_child_before(pugi::node_comment, node).set_value(m_flushPlaceholder.c_str());
+        m_flushedSystems.push_back("");
+    }
+
+    // The system is printed as it would be when saving the document
+    unsigned int depth = 0;
+    for (pugi::xml_node parent = node.parent(); parent.type() == pugi::node_element; parent = parent.parent()) {
+        ++depth;
+    }
+    const unsigned int flags = (m_formatRaw) ? (pugi::format_default | pugi::format_raw) : pugi::format_default;
+    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    SvgStringWriter writer(m_flushedSystems.back());
+    node.print(writer, indent.c_str(), flags, pugi::encoding_auto, depth);
+
+    m_pageNode.remove_child(node);
+}
+
+bool SvgDeviceContext::CanFlushSystems(const Object *page) const
+{
+    ListOfConstObjects timeSpanningElements;
+    InterfaceComparison comparison(INTERFACE_TIME_SPANNING);
+    page->FindAllDescendantsByComparison(&timeSpanningElements, &comparison);
+
+    return std::none_of(timeSpanningElements.begin(), timeSpanningElements.end(), [](const Object *element) {
+        const LayerElement *start = element->GetTimeSpanningInterface()->GetStart();
+        return (start && (start->GetFirstAncestor(SYSTEM) != element->GetFirstAncestor(SYSTEM)));
+    });
+}
+
+void SvgDeviceContext::SaveDocument(pugi::xml_writer &writer)
+{
+    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    if (m_flushedSystems.empty()) {
+        m_svgDoc.save(writer, indent.c_str(), m_outputFlags);
+        return;
+    }
+
+    std::string document;
+    SvgStringWriter documentWriter(document);
+    m_svgDoc.save(documentWriter, indent.c_str(), m_outputFlags);
+
+    // Each placeholder is on its own line and indented like the systems it replaces, which include the indentation
+    // and the line break
+    unsigned int depth = 1;
+    for (pugi::xml_node parent = m_pageNode.parent(); parent.type() == pugi::node_element; parent = parent.parent()) {
+        ++depth;
+    }
+    const bool formatRaw = (m_outputFlags & pugi::format_raw);
+    const size_t indentLength = (formatRaw) ? 0 : depth * indent.size();
+    const std::string placeholder = "<!--" + m_flushPlaceholder + "-->";
+
+    size_t pos = 0;
+    for (const std::string &systems : m_flushedSystems) {
+        const size_t found = document.find(placeholder, pos);
+        assert((found != std::string::npos) && (found >= pos + indentLength));
+        writer.write(document.data() + pos, found - indentLength - pos);
+        writer.write(systems.data(), systems.size());
+        pos = found + placeholder.size() + ((formatRaw) ? 0 : 1);
+    }
+    writer.write(document.data() + pos, document.size() - pos);
 }
 
 void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int height)
@@ -82,8 +82,11 @@ void System::Reset()
     m_drawingJustifiableWidth = 0;
     m_castOffTotalWidth = 0;
     m_castOffJustifiableWidth = 0;
+    m_castOffYRel = VRV_UNSET;
+    m_castOffHeight = VRV_UNSET;
     m_drawingAbbrLabelsWidth = 0;
     m_drawingIsOptimized = false;
+    m_layoutDirty = false;
 }
 
 bool System::IsSupportedChild(Object *child)
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 
 //----------------------------------------------------------------------------
@@ -94,4 +95,54 @@ void Timemap::ToJson(std::string &output, bool includeRests, bool includeMeasure
     output = timemap.json();
 }
 
+//----------------------------------------------------------------------------
+// TimeIntervalIndex
+//----------------------------------------------------------------------------
+
+TimeIntervalIndex::TimeIntervalIndex()
+{
+    this->Reset();
+}
+
+TimeIntervalIndex::~TimeIntervalIndex() {}
+
+void TimeIntervalIndex::Reset()
+{
+    m_intervals.clear();
+    m_maxDuration = 0.0;
+}
+
+void TimeIntervalIndex::AddInterval(const TimeInterval &interval)
+{
+    m_intervals.push_back(interval);
+    m_maxDuration = std::max(m_maxDuration, interval.offset - interval.onset);
+}
+
+void TimeIntervalIndex::Sort()
+{
+    std::stable_sort(m_intervals.begin(), m_intervals.end(),
+        [](const TimeInterval &left, const TimeInterval &right) { return (left.onset < right.onset); });
+}
+
+std::vector<const TimeInterval *> TimeIntervalIndex::FindIntervalsBetween(double start, double end) const
+{
+    std::vector<const TimeInterval *> intervals;
+
+    // The first interval starting after the end
+    std::vector<TimeInterval>::const_iterator iter = std::upper_bound(m_intervals.begin(), m_intervals.end(), end,
+        [](double time, const TimeInterval &interval) { return (time < interval.onset); });
+    // Look back until the intervals cannot reach the start anymore
+    while (iter != m_intervals.begin()) {
+        --iter;
+        if (iter->onset + m_maxDuration < start) break;
+        if (iter->offset >= start) intervals.push_back(&(*iter));
+    }
+
+    std::sort(intervals.begin(), intervals.end(), [](const TimeInterval *left, const TimeInterval *right) {
+        return (left->order != right->order) ? (left->order < right->order) : (left->repeat < right->repeat);
+    });
+
+    return intervals;
+}
+
 } // namespace vrv
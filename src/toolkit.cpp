@@ -9,10 +9,24 @@
 
 //----------------------------------------------------------------------------
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <codecvt>
+#include <cstdio>
 #include <locale>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <regex>
+#include <sys/stat.h>
+#include <thread>
+
+#ifndef _WIN32
+#include <dirent.h>
+#else
+#include "win_dirent.h"
+#endif
 
 //----------------------------------------------------------------------------
 
@@ -21,6 +35,7 @@
 #include "editortoolkit_cmn.h"
 #include "editortoolkit_mensural.h"
 #include "editortoolkit_neume.h"
+#include "featureextractor.h"
 #include "findfunctor.h"
 #include "ioabc.h"
 #include "iodarms.h"
@@ -33,13 +48,16 @@
 #include "nc.h"
 #include "neume.h"
 #include "note.h"
+#include "num.h"
 #include "options.h"
 #include "page.h"
 #include "runtimeclock.h"
 #include "score.h"
 #include "slur.h"
 #include "staff.h"
+#include "staffdef.h"
 #include "svgdevicecontext.h"
+#include "system.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -57,12 +75,78 @@ namespace vrv {
 const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 const char *ZIP_SIGNATURE = "\x50\x4B\x03\x04";
+const char *LAYOUT_CACHE_HEADER = "verovio-layout-cache";
+const char *LAYOUT_CACHE_SEEN = "verovio-layout-cache-seen";
+// The range of the IDs generated for all the pages by Toolkit::ProcessPages
+const uint32_t LAYOUT_PAGES_ID_RANGE = 1u << 31;
 
 //----------------------------------------------------------------------------
-// Toolkit
+// LayoutCacheDir
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
+bool LayoutCacheDir::Get(const std::string &key, std::string &data)
+{
+    std::ifstream input(m_dir + "/" + key + ".vlc", std::ios::binary);
+    if (!input.is_open()) return false;
+
+    std::stringstream stream;
+    stream << input.rdbuf();
+    data = stream.str();
+    return true;
+}
+
+void LayoutCacheDir::Put(const std::string &key, const std::string &data)
+{
+    // The file is written under a temporary name and renamed, so other processes never read it partially written
+    const std::string filename = m_dir + "/" + key + ".vlc";
+    const std::string tmpFilename = StringFormat("%s.%llx-%zx.tmp", filename.c_str(),
+        (unsigned long long)std::chrono::steady_clock::now().time_since_epoch().count(),
+        std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    std::ofstream output(tmpFilename, std::ios::binary);
+    if (!output.is_open()) {
+        LogWarning("Unable to write the layout cache file '%s'", filename.c_str());
+        return;
+    }
+    output << data;
+    output.close();
+    // Renaming fails on some systems if the file was written by another process in the meantime
+    if (!output || (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)) {
+        std::remove(tmpFilename.c_str());
+        return;
+    }
+
+    if (m_maxFiles > 0) this->Evict();
+}
+
+void LayoutCacheDir::Evict()
+{
+    ::DIR *dirp = opendir(m_dir.c_str());
+    if (!dirp) return;
+    // The cache files with their modification time
+    std::vector<std::pair<time_t, std::string>> files;
+    while (struct dirent *entry = readdir(dirp)) {
+        const std::string filename = m_dir + "/" + entry->d_name;
+        struct stat st;
+        if ((filename.size() > 4) && (filename.compare(filename.size() - 4, 4, ".vlc") == 0)
+            && (stat(filename.c_str(), &st) == 0)) {
+            files.push_back({ st.st_mtime, filename });
+        }
+    }
+    closedir(dirp);
+    if ((int)files.size() <= m_maxFiles) return;
+
+    // Remove a tenth more than needed so that files are not removed each time one is written
+    const int removeCount = (int)files.size() - (m_maxFiles - m_maxFiles / 10);
+    std::partial_sort(files.begin(), files.begin() + removeCount, files.end());
+    for (int i = 0; i < removeCount; ++i) {
+        std::remove(files.at(i).second.c_str());
+    }
+}
+
+//----------------------------------------------------------------------------
+// Toolkit
+//----------------------------------------------------------------------------
 
 Toolkit::Toolkit(bool initFont)
 {
@@ -70,7 +154,9 @@ Toolkit::Toolkit(bool initFont)
     m_outputTo = UNKNOWN;
 
     m_humdrumBuffer = NULL;
+    m_humdrumFiles = NULL;
     m_cString = NULL;
+    m_isWorker = false;
 
     if (initFont) {
         Resources &resources = m_doc.GetResourcesForModification();
@@ -80,6 +166,8 @@ Toolkit::Toolkit(bool initFont)
     m_options = m_doc.GetOptions();
 
     m_editorToolkit = NULL;
+    m_featureIndex = NULL;
+    m_layoutCache = NULL;
 
 #ifndef NO_RUNTIME
     m_runtimeClock = NULL;
@@ -92,6 +180,7 @@ Toolkit::~Toolkit()
         free(m_humdrumBuffer);
         m_humdrumBuffer = NULL;
     }
+    this->ClearHumdrumBuffer();
     if (m_cString) {
         free(m_cString);
         m_cString = NULL;
@@ -100,6 +189,10 @@ Toolkit::~Toolkit()
         delete m_editorToolkit;
         m_editorToolkit = NULL;
     }
+    if (m_featureIndex) {
+        delete m_featureIndex;
+        m_featureIndex = NULL;
+    }
 #ifndef NO_RUNTIME
     if (m_runtimeClock) {
         delete m_runtimeClock;
@@ -164,6 +257,9 @@ bool Toolkit::SetOutputTo(std::string const &outputTo)
     else if (outputTo == "expansionmap") {
         m_outputTo = EXPANSIONMAP;
     }
+    else if ((outputTo == "features") || (outputTo == "feature-index")) {
+        m_outputTo = FEATURES;
+    }
     else if (outputTo == "pae") {
         m_outputTo = PAE;
     }
@@ -484,6 +580,20 @@ bool Toolkit::LoadData(const std::string &data)
     if (inputFormat == AUTO) {
         inputFormat = IdentifyInputFrom(data);
     }
+
+    // Load the cached layout if the same data was already cast off with the same options
+    // Only the data loaded a second time is cached - the first time, only the key is stored
+    std::string layoutCacheKey;
+    bool layoutCacheSeen = false;
+    LayoutCache *layoutCache = this->GetLayoutCache(data, inputFormat, layoutCacheKey);
+    if (layoutCache) {
+        std::string cacheData;
+        if (layoutCache->Get(layoutCacheKey, cacheData)) {
+            if ((cacheData != LAYOUT_CACHE_SEEN) && this->LoadLayoutCacheData(cacheData)) return true;
+            layoutCacheSeen = true;
+        }
+    }
+
     if (inputFormat == ABC) {
 #ifndef NO_ABC_SUPPORT
         input = new ABCInput(&m_doc);
@@ -523,16 +633,17 @@ bool Toolkit::LoadData(const std::string &data)
             delete input;
             return false;
         }
-        this->SetHumdrumBuffer(((HumdrumInput *)input)->GetHumdrumString().c_str());
         if (this->GetOutputTo() == HUMDRUM) {
             // Humdrum data will be output (post-filtering data),
             // So not continuing converting to SVG.
+            this->SetHumdrumFiles((HumdrumInput *)input);
             delete input;
             return true;
         }
 
         // Read embedded options from input Humdrum file:
         ((HumdrumInput *)input)->parseEmbeddedOptions(&m_doc);
+        this->SetHumdrumFiles((HumdrumInput *)input);
     }
     else if (inputFormat == HUMMEI) {
         // convert first to MEI and then load MEI data via MEIInput.  This
@@ -551,9 +662,8 @@ bool Toolkit::LoadData(const std::string &data)
             return false;
         }
 
-        this->SetHumdrumBuffer(tempinput->GetHumdrumString().c_str());
-
         if (this->GetOutputTo() == HUMDRUM) {
+            this->SetHumdrumFiles(tempinput);
             delete tempinput;
             return true;
         }
@@ -564,6 +674,7 @@ bool Toolkit::LoadData(const std::string &data)
 
         // Read embedded options from input Humdrum file:
         tempinput->parseEmbeddedOptions(&m_doc);
+        this->SetHumdrumFiles(tempinput);
         delete tempinput;
 
         input = new MEIInput(&m_doc);
@@ -588,14 +699,14 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting MusicXML data");
             return false;
         }
-        std::string buffer = conversion.str();
+        const std::string buffer = conversion.str();
         this->SetHumdrumBuffer(buffer.c_str());
 
         // Now convert Humdrum into MEI:
         Doc tempdoc;
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
+        if (!tempinput->Import(buffer)) {
             LogError("Error importing Humdrum data (2)");
             delete tempinput;
             return false;
@@ -608,10 +719,9 @@ bool Toolkit::LoadData(const std::string &data)
     }
 
     else if (inputFormat == MEIHUM) {
-        ConvertMEIToHumdrum(data);
+        const std::string conversion = this->ConvertMEIToHumdrum(data);
 
         // Now convert Humdrum into MEI:
-        std::string conversion = this->GetHumdrumBuffer();
         Doc tempdoc;
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
@@ -636,14 +746,14 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting MuseData data");
             return false;
         }
-        std::string buffer = conversion.str();
+        const std::string buffer = conversion.str();
         this->SetHumdrumBuffer(buffer.c_str());
 
         // Now convert Humdrum into MEI:
         Doc tempdoc;
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
+        if (!tempinput->Import(buffer)) {
             LogError("Error importing Humdrum data (4)");
             delete tempinput;
             return false;
@@ -664,14 +774,14 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting EsAC data");
             return false;
         }
-        std::string buffer = conversion.str();
+        const std::string buffer = conversion.str();
         this->SetHumdrumBuffer(buffer.c_str());
 
         // Now convert Humdrum into MEI:
         Doc tempdoc;
         tempdoc.SetOptions(m_doc.GetOptions());
         Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
+        if (!tempinput->Import(buffer)) {
             LogError("Error importing Humdrum data (5)");
             delete tempinput;
             return false;
@@ -782,6 +892,7 @@ bool Toolkit::LoadData(const std::string &data)
             m_doc.CastOffDoc();
             // LogElapsedTimeEnd("cast-off");
         }
+        m_castOffOptions = m_options->GetStrValues();
     }
 
     delete input;
@@ -802,6 +913,13 @@ bool Toolkit::LoadData(const std::string &data)
     }
 #endif
 
+    // Cache the layout with the same restrictions as for the layout workers
+    // Endings are not preserved when reloading the page-based MEI and are not cached
+    if (layoutCache && m_doc.IsCastOff() && !m_doc.HasSelection() && (m_doc.GetType() == Raw)
+        && !m_doc.IsMensuralMusicOnly() && !m_doc.FindDescendantByType(ENDING)) {
+        layoutCache->Put(layoutCacheKey, (layoutCacheSeen) ? this->GetLayoutCacheData() : LAYOUT_CACHE_SEEN);
+    }
+
     return true;
 }
 
@@ -1361,6 +1479,7 @@ std::string Toolkit::EditInfo()
 
 std::string Toolkit::GetLog()
 {
+    const std::lock_guard<std::mutex> lock(logBufferMutex);
     std::string str;
     for (const std::string &logStr : logBuffer) {
         str += logStr;
@@ -1381,12 +1500,17 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
+    // Worker toolkits share the log buffer and must not clear the messages of the toolkit driving them
+    if (m_isWorker) return;
+
+    const std::lock_guard<std::mutex> lock(logBufferMutex);
     logBuffer.clear();
 }
 
 void Toolkit::RedoLayout(const std::string &jsonOptions)
 {
     bool resetCache = true;
+    bool hasResetCache = false;
 
     jsonxx::Object json;
 
@@ -1396,7 +1520,10 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
             LogWarning("Cannot parse JSON std::string. Using default options.");
         }
         else {
-            if (json.has<jsonxx::Boolean>("resetCache")) resetCache = json.get<jsonxx::Boolean>("resetCache");
+            if (json.has<jsonxx::Boolean>("resetCache")) {
+                resetCache = json.get<jsonxx::Boolean>("resetCache");
+                hasResetCache = true;
+            }
         }
     }
 
@@ -1407,6 +1534,35 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
         return;
     }
 
+    // The earliest layout stage invalidated by the options changed since the last cast-off
+    const OptionsStage stage = m_options->GetChangedStage(m_castOffOptions);
+
+    // After editing, the document is cast off again only if the size of an edited system changed or if resetting the
+    // cache was requested
+    if (!m_docSelection.m_isPending && m_doc.IsCastOff() && (stage == OptionsStage::None)
+        && !(hasResetCache && resetCache) && m_doc.LayOutDirtySystems()) {
+        return;
+    }
+
+    // When only options were changed, the stages before the one they invalidate are kept
+    if (!m_docSelection.m_isPending && (stage != OptionsStage::None) && !(hasResetCache && resetCache)
+        && !m_doc.HasLayoutDirtySystems()) {
+        if (stage <= OptionsStage::Vertical) {
+            // The pages are laid out again when rendered
+            if (stage == OptionsStage::Vertical) m_doc.ResetPageLayouts();
+            m_castOffOptions = m_options->GetStrValues();
+            return;
+        }
+        // Only the breaking of the systems into pages is redone
+        if ((stage == OptionsStage::CastOffPages) && m_doc.CastOffPagesDoc()) {
+            m_castOffOptions = m_options->GetStrValues();
+            return;
+        }
+        // The horizontal layout cached for the cast-off is kept unless it is invalidated
+        // Laying out the pages changes the alignments, which are not cached, so the cache is then not exact anymore
+        if (!hasResetCache) resetCache = (stage >= OptionsStage::Horizontal) || m_doc.HasLaidOutPages();
+    }
+
     if (m_docSelection.m_isPending) {
         m_doc.InitSelectionDoc(m_docSelection, resetCache);
     }
@@ -1426,6 +1582,7 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
     else if (m_options->m_breaks.GetValue() != BREAKS_none) {
         m_doc.CastOffDoc();
     }
+    m_castOffOptions = m_options->GetStrValues();
 }
 
 void Toolkit::RedoPagePitchPosLayout()
@@ -1499,68 +1656,486 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
     return true;
 }
 
-std::string Toolkit::RenderData(const std::string &data, const std::string &jsonOptions)
+bool Toolkit::ProcessPages(const std::vector<int> &pageNos, const std::function<bool(Toolkit &, int)> &process,
+    const std::function<bool(int)> &output)
 {
-    if (this->SetOptions(jsonOptions) && this->LoadData(data)) return this->RenderToSVG(1);
+    int threadCount = m_options->m_layoutThreads.GetValue();
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+#ifdef __EMSCRIPTEN__
+    threadCount = 1;
+#endif
+    threadCount = std::min(threadCount, (int)pageNos.size());
 
-    // Otherwise just return an empty string.
-    return "";
+    // The workers get the document as page-based MEI with all the IDs, so encoded elements keep their IDs in the output
+    std::string pageBasedMEI;
+    if ((threadCount > 1) && this->CanUseLayoutWorkers()) {
+        pageBasedMEI = this->GetMEI("{\"scoreBased\": false, \"removeIds\": false}");
+    }
+
+    if (pageBasedMEI.empty()) {
+        bool success = true;
+        for (int pageNo : pageNos) {
+            if (!process(*this, pageNo)) success = false;
+            if (output && !output(pageNo)) return false;
+        }
+        return success;
+    }
+
+    // The scoreDefs are set as when laying out the first page, but before the IDs generated for the pages
+    m_doc.ScoreDefSetCurrentDoc();
+
+    // The IDs generated for a page start from a counter given by the page number, whichever toolkit processes it.
+    // The pages share half of the counter values, the other half being left for the IDs generated before and after.
+    const int pageCount = m_doc.GetPageCount();
+    const uint32_t idRange = LAYOUT_PAGES_ID_RANGE / (uint32_t)(pageCount + 1);
+    const uint32_t idCounter = Object::GetIDCounter();
+    const uint32_t nextIDCounter = idCounter + (uint32_t)(pageCount + 1) * idRange;
+    auto processPage = [&](Toolkit &toolkit, int pageNo) {
+        const uint32_t pageIDCounter = idCounter + (uint32_t)pageNo * idRange;
+        Object::SetIDCounter(pageIDCounter);
+        const bool success = process(toolkit, pageNo);
+        if (Object::GetIDCounter() - pageIDCounter >= idRange) {
+            LogError("Too many IDs generated for page %d, they can be duplicated in the next page", pageNo);
+            return false;
+        }
+        return success;
+    };
+
+    // The cast-off system widths are not stored in the MEI but they are used for the horizontal spacing
+    std::vector<std::pair<int, int>> castOffWidths;
+    for (Object *object : m_doc.FindAllDescendantsByType(SYSTEM, false)) {
+        System *system = vrv_cast<System *>(object);
+        assert(system);
+        castOffWidths.push_back({ system->m_castOffTotalWidth, system->m_castOffJustifiableWidth });
+    }
+    const bool isCastOff = m_doc.IsCastOff();
+
+    // The IDs generated when loading the document are replaced in the workers by the ones of this document
+    ArrayOfObjectIDTuples objectIDs;
+    Toolkit::GetObjectIDs(&m_doc, objectIDs);
+
+    // The workers are set up before this toolkit draws any page and the document of this toolkit is not read by them
+    std::vector<std::unique_ptr<Toolkit>> workers;
+    for (int i = 1; i < threadCount; ++i) {
+        workers.push_back(std::make_unique<Toolkit>(false));
+        this->InitLayoutWorker(*workers.back());
+    }
+
+    // Each toolkit takes the next page until all of them are processed or the output is stopped
+    std::atomic<int> nextPage = 0;
+    std::atomic<bool> success = true;
+    std::atomic<bool> isStopped = false;
+    // The pages are output in order by the thread processing the one the next output waits for
+    std::mutex outputMutex;
+    std::vector<char> isProcessed(pageNos.size(), false);
+    int nextOutput = 0;
+    auto processNext = [&](Toolkit &toolkit) {
+        for (int index = nextPage++; !isStopped && (index < (int)pageNos.size()); index = nextPage++) {
+            if (!processPage(toolkit, pageNos.at(index))) success = false;
+            if (!output) continue;
+            std::lock_guard<std::mutex> lock(outputMutex);
+            isProcessed.at(index) = true;
+            while (!isStopped && (nextOutput < (int)pageNos.size()) && isProcessed.at(nextOutput)) {
+                if (!output(pageNos.at(nextOutput))) {
+                    isStopped = true;
+                    success = false;
+                }
+                ++nextOutput;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::unique_ptr<Toolkit> &worker : workers) {
+        threads.emplace_back([&, toolkit = worker.get()]() {
+            Object::SetIDCounter(nextIDCounter);
+            if (!toolkit->LoadCastOffMEI(pageBasedMEI, castOffWidths, isCastOff)
+                || (toolkit->GetPageCount() != pageCount)) {
+                LogWarning("The document could not be loaded by the layout worker");
+                return;
+            }
+            toolkit->m_doc.ScoreDefSetCurrentDoc();
+#if defined(DEBUG)
+            // The IDs are mapped by position, which requires loading the document again to give the same sequence
+            Toolkit check(false);
+            this->InitLayoutWorker(check);
+            Object::SetIDCounter(nextIDCounter);
+            check.LoadCastOffMEI(pageBasedMEI, castOffWidths, isCastOff);
+            check.m_doc.ScoreDefSetCurrentDoc();
+            ArrayOfObjectIDTuples workerIDs;
+            ArrayOfObjectIDTuples checkIDs;
+            Toolkit::GetObjectIDs(&toolkit->m_doc, workerIDs);
+            Toolkit::GetObjectIDs(&check.m_doc, checkIDs);
+            // The ID of the document itself is generated when creating the toolkit
+            assert(workerIDs.size() == checkIDs.size());
+            assert(std::equal(workerIDs.begin() + 1, workerIDs.end(), checkIDs.begin() + 1));
+#endif
+            // A worker with a different document would not give the same output and leaves the pages to the others
+            int index = 0;
+            if (!Toolkit::SetObjectIDs(&toolkit->m_doc, objectIDs, index) || (index != (int)objectIDs.size())) {
+                LogWarning("The document loaded by the layout worker does not match, its pages are laid out by the "
+                           "other threads");
+                return;
+            }
+            processNext(*toolkit);
+        });
+    }
+
+    // This toolkit processes pages while the workers are loading, without clearing the log buffer they share
+    const bool isWorker = m_isWorker;
+    m_isWorker = true;
+    processNext(*this);
+    m_isWorker = isWorker;
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    Object::SetIDCounter(nextIDCounter);
+    return success;
 }
 
-std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
+bool Toolkit::ProcessInputs(const std::vector<std::string> &inputs, const std::function<bool(Toolkit &, int)> &process)
 {
-    this->ResetLogBuffer();
+    int threadCount = m_options->m_layoutThreads.GetValue();
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+#ifdef __EMSCRIPTEN__
+    threadCount = 1;
+#endif
+    threadCount = std::max(1, std::min(threadCount, (int)inputs.size()));
+
+    // Unlike the pages, the inputs are always processed by workers so the document of this toolkit is not replaced
+    std::atomic<int> nextInput = 0;
+    std::atomic<bool> success = true;
+    auto processNext = [&]() {
+        Toolkit worker(false);
+        this->InitInputWorker(worker);
+        for (int index = nextInput++; index < (int)inputs.size(); index = nextInput++) {
+            // Seed the IDs for each input so they do not depend on the inputs processed before by the worker
+            Object::SeedID(m_options->m_xmlIdSeed.GetValue());
+            if (!process(worker, index)) success = false;
+        }
+    };
 
-    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
-    // Create the SVG object, h & w come from the system
-    // We will need to set the size of the page after having drawn it depending on the options
-    SvgDeviceContext svg;
-    svg.SetResources(&m_doc.GetResources());
+    if (threadCount == 1) {
+        // The inputs are processed in this thread - keep the ID counter for the IDs generated later in the document
+        const uint32_t idCounter = Object::GetIDCounter();
+        processNext();
+        Object::SetIDCounter(idCounter);
+        return success;
+    }
 
-    int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
-    svg.SetIndent(indent);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back(processNext);
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    return success;
+}
 
-    if (m_options->m_mmOutput.GetValue()) {
-        svg.SetMMOutput(true);
+void Toolkit::InitInputWorker(Toolkit &worker) const
+{
+    worker.m_isWorker = true;
+
+    // The resources are only read and can be copied without reloading the fonts
+    worker.m_doc.GetResourcesForModification() = m_doc.GetResources();
+
+    *worker.m_options = *m_options;
+    m_options->m_scale.CopyTo(&worker.m_options->m_scale);
+    m_options->m_xmlIdSeed.CopyTo(&worker.m_options->m_xmlIdSeed);
+    // The inputs are only loaded and do not need to be laid out
+    worker.m_options->m_breaks.SetValue(BREAKS_none);
+    worker.m_options->m_header.SetValue(HEADER_none);
+    worker.m_options->m_footer.SetValue(FOOTER_none);
+
+    worker.m_inputFrom = m_inputFrom;
+}
+
+bool Toolkit::CanUseLayoutWorkers() const
+{
+    // Page-based MEI cannot be written with a selection and it is not used for transcription and facsimile rendering
+    if (m_doc.HasSelection() || (m_doc.GetType() != Raw)) return false;
+    // Mensural documents are cast off differently
+    if (m_doc.IsMensuralMusicOnly()) return false;
+
+    return (m_doc.GetPageCount() > 1);
+}
+
+void Toolkit::InitLayoutWorker(Toolkit &worker) const
+{
+    worker.m_isWorker = true;
+
+    // The resources are only read during the layout and can be copied without reloading the fonts
+    worker.m_doc.GetResourcesForModification() = m_doc.GetResources();
+
+    *worker.m_options = *m_options;
+    m_options->m_scale.CopyTo(&worker.m_options->m_scale);
+    m_options->m_xmlIdSeed.CopyTo(&worker.m_options->m_xmlIdSeed);
+}
+
+void Toolkit::GetObjectIDs(const Object *object, ArrayOfObjectIDTuples &objectIDs)
+{
+    const ArrayOfConstObjects members = Toolkit::GetDrawnMembers(object);
+    objectIDs.push_back({ object->GetClassId(), object->GetChildCount() + (int)members.size(), object->GetID() });
+    for (const Object *member : members) {
+        Toolkit::GetObjectIDs(member, objectIDs);
+    }
+    for (int i = 0; i < object->GetChildCount(); ++i) {
+        Toolkit::GetObjectIDs(object->GetChild(i), objectIDs);
     }
+}
 
-    if (m_doc.GetType() == Facs) {
-        svg.SetFacsimile(true);
+bool Toolkit::SetObjectIDs(Object *object, const ArrayOfObjectIDTuples &objectIDs, int &index)
+{
+    if (index >= (int)objectIDs.size()) return false;
+    const ArrayOfConstObjects members = Toolkit::GetDrawnMembers(object);
+    const auto &[classId, childCount, id] = objectIDs.at(index++);
+    if ((object->GetClassId() != classId) || (object->GetChildCount() + (int)members.size() != childCount)) {
+        return false;
     }
+    if (object->GetID() != id) object->SetID(id);
 
-    // set the option to use viewbox on svg root
-    if (m_options->m_svgBoundingBoxes.GetValue()) {
-        svg.SetSvgBoundingBoxes(true);
+    for (const Object *member : members) {
+        if (!Toolkit::SetObjectIDs(const_cast<Object *>(member), objectIDs, index)) return false;
     }
+    for (Object *child : object->GetChildren()) {
+        if (!Toolkit::SetObjectIDs(child, objectIDs, index)) return false;
+    }
+    return true;
+}
 
-    // set the additional CSS if any
-    if (!m_options->m_svgCss.GetValue().empty()) {
-        svg.SetCss(m_options->m_svgCss.GetValue());
+ArrayOfConstObjects Toolkit::GetDrawnMembers(const Object *object)
+{
+    ArrayOfConstObjects members;
+    if (object->Is(SCORE)) {
+        const Score *score = vrv_cast<const Score *>(object);
+        assert(score);
+        members = { score->GetScoreDef() };
+    }
+    else if (object->Is(PAGE)) {
+        const Page *page = vrv_cast<const Page *>(object);
+        assert(page);
+        members = { &page->m_drawingScoreDef };
+    }
+    else if (object->Is(SYSTEM)) {
+        const System *system = vrv_cast<const System *>(object);
+        assert(system);
+        members = { system->GetDrawingScoreDef() };
+    }
+    else if (object->Is(MEASURE)) {
+        const Measure *measure = vrv_cast<const Measure *>(object);
+        assert(measure);
+        members = { measure->GetLeftBarLine(), measure->GetRightBarLine(), measure->GetDrawingScoreDef() };
+    }
+    else if (object->Is(STAFFDEF)) {
+        const StaffDef *staffDef = vrv_cast<const StaffDef *>(object);
+        assert(staffDef);
+        members = { staffDef->GetCurrentClef(), staffDef->GetCurrentKeySig(), staffDef->GetCurrentMensur(),
+            staffDef->GetCurrentMeterSig(), staffDef->GetCurrentMeterSigGrp() };
+    }
+    else if (object->Is(LAYER)) {
+        const Layer *layer = vrv_cast<const Layer *>(object);
+        assert(layer);
+        members = { layer->GetStaffDefClef(), layer->GetStaffDefKeySig(), layer->GetStaffDefMensur(),
+            layer->GetStaffDefMeterSig(), layer->GetStaffDefMeterSigGrp(), layer->GetCautionStaffDefClef(),
+            layer->GetCautionStaffDefKeySig(), layer->GetCautionStaffDefMensur(), layer->GetCautionStaffDefMeterSig() };
+    }
+    else if (object->Is(NUM)) {
+        const Num *num = vrv_cast<const Num *>(object);
+        assert(num);
+        members = { num->GetCurrentText() };
+    }
+    // The members not set are skipped
+    members.erase(std::remove(members.begin(), members.end(), (const Object *)NULL), members.end());
+    return members;
+}
+
+bool Toolkit::LoadCastOffMEI(
+    const std::string &pageBasedMEI, const std::vector<std::pair<int, int>> &castOffWidths, bool isCastOff)
+{
+    // The options are restored once the page-based MEI is loaded
+    Options options;
+    options = *m_options;
+    const FileFormat inputFrom = m_inputFrom;
+    LayoutCache *layoutCache = m_layoutCache;
+
+    // The page-based MEI is already expanded, transposed and limited to the selected mdiv
+    m_options->m_expand.Reset();
+    m_options->m_loadSelectedMdivOnly.Reset();
+    m_options->m_mdivXPathQuery.Reset();
+    m_options->m_transpose.Reset();
+    m_options->m_transposeMdiv.Reset();
+    m_options->m_transposeToSoundingPitch.Reset();
+    m_options->m_xmlIdChecksum.Reset();
+    m_options->m_layoutCache.Reset();
+    // The page-based MEI is loaded with the layout, any breaks option other than none would trigger a warning
+    if (m_options->m_breaks.GetValue() != BREAKS_none) m_options->m_breaks.SetValue(BREAKS_auto);
+    m_inputFrom = MEI;
+    m_layoutCache = NULL;
+
+    const bool success = this->LoadData(pageBasedMEI);
+
+    *m_options = options;
+    m_inputFrom = inputFrom;
+    m_layoutCache = layoutCache;
+    if (!success) return false;
+
+    ListOfObjects systems = m_doc.FindAllDescendantsByType(SYSTEM, false);
+    if (systems.size() != castOffWidths.size()) {
+        LogError("The page-based MEI does not match the cast-off document");
+        return false;
+    }
+    auto castOffWidth = castOffWidths.begin();
+    for (Object *object : systems) {
+        System *system = vrv_cast<System *>(object);
+        assert(system);
+        system->m_castOffTotalWidth = castOffWidth->first;
+        system->m_castOffJustifiableWidth = castOffWidth->second;
+        ++castOffWidth;
+    }
+
+    // Optimize the scoreDefs as it was done at the end of the cast-off
+    if (isCastOff) {
+        m_doc.ScoreDefSetCurrentDoc(true);
+        for (Score *score : m_doc.GetVisibleScores()) {
+            if (score->ScoreDefNeedsOptimization(m_options->m_condense.GetValue())) {
+                m_doc.ScoreDefOptimizeDoc();
+                break;
+            }
+        }
+        m_doc.MarkCastOff();
+        m_castOffOptions = m_options->GetStrValues();
     }
 
-    if (m_options->m_svgViewBox.GetValue()) {
-        svg.SetSvgViewBox(true);
+    return true;
+}
+
+LayoutCache *Toolkit::GetLayoutCache(const std::string &data, FileFormat inputFormat, std::string &key)
+{
+    LayoutCache *layoutCache = m_layoutCache;
+    if (!layoutCache && !m_options->m_layoutCache.GetValue().empty()) {
+        m_layoutCacheDir.SetDir(m_options->m_layoutCache.GetValue());
+        layoutCache = &m_layoutCacheDir;
     }
+    if (!layoutCache || m_isWorker) return NULL;
 
-    svg.SetHtml5(m_options->m_svgHtml5.GetValue());
-    svg.SetFormatRaw(m_options->m_svgFormatRaw.GetValue());
-    svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
-    svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
-    svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+    // Without cast-off there is nothing to cache
+    if (m_options->m_breaks.GetValue() == BREAKS_none) return NULL;
+    // The expansion map and the Humdrum buffer are not restored from the page-based MEI
+    if (m_options->m_expand.IsSet() || (m_outputTo == HUMDRUM)) return NULL;
+    switch (inputFormat) {
+        case HUMDRUM:
+        case MUSICXMLHUM:
+        case MEIHUM:
+        case MUSEDATAHUM:
+        case ESAC: return NULL;
+        default: break;
+    }
 
-    // render the page
-    this->RenderToDeviceContext(pageNo, &svg);
+    // The key is a FNV-1a hash of the version, the input format, the options used up to the cast-off and the data
+    uint64_t hash = 14695981039346656037ull;
+    auto addToHash = [&hash](const std::string &value) {
+        for (const char c : value) {
+            hash ^= (unsigned char)c;
+            hash *= 1099511628211ull;
+        }
+        // Separate the values
+        hash *= 1099511628211ull;
+    };
+    addToHash(this->GetVersion());
+    addToHash(StringFormat("%d", inputFormat));
+    for (const auto &[optionKey, value] : m_options->GetStrValues(OptionsStage::CastOffPages)) {
+        addToHash(optionKey);
+        addToHash(value);
+    }
+    addToHash(data);
+    key = StringFormat("%016llx", (unsigned long long)hash);
+
+    return layoutCache;
+}
+
+std::string Toolkit::GetLayoutCacheData()
+{
+    // The header has the number of systems and the cast-off widths, which are not stored in the MEI
+    ListOfObjects systems = m_doc.FindAllDescendantsByType(SYSTEM, false);
+    std::string cacheData = StringFormat("%s %d\n", LAYOUT_CACHE_HEADER, (int)systems.size());
+    for (Object *object : systems) {
+        System *system = vrv_cast<System *>(object);
+        assert(system);
+        cacheData += StringFormat("%d %d\n", system->m_castOffTotalWidth, system->m_castOffJustifiableWidth);
+    }
+    return cacheData + this->GetMEI("{\"scoreBased\": false, \"removeIds\": false}");
+}
+
+bool Toolkit::LoadLayoutCacheData(const std::string &cacheData)
+{
+    std::istringstream stream(cacheData);
+    std::string header;
+    int systemCount = 0;
+    if (!(stream >> header >> systemCount) || (header != LAYOUT_CACHE_HEADER) || (systemCount < 0)) return false;
+
+    std::vector<std::pair<int, int>> castOffWidths(systemCount);
+    for (auto &[totalWidth, justifiableWidth] : castOffWidths) {
+        if (!(stream >> totalWidth >> justifiableWidth)) return false;
+    }
+    stream.ignore();
+    if (!stream) return false;
+
+    return this->LoadCastOffMEI(cacheData.substr(stream.tellg()), castOffWidths, true);
+}
+
+std::string Toolkit::RenderData(const std::string &data, const std::string &jsonOptions)
+{
+    if (this->SetOptions(jsonOptions) && this->LoadData(data)) return this->RenderToSVG(1);
+
+    // Otherwise just return an empty string.
+    return "";
+}
+
+std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
+{
+    this->ResetLogBuffer();
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+    // Create the SVG object, h & w come from the system
+    // We will need to set the size of the page after having drawn it depending on the options
+    SvgDeviceContext svg;
+    this->RenderToSvgDeviceContext(pageNo, &svg);
 
     std::string out_str = svg.GetStringSVG(xmlDeclaration);
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
     return out_str;
 }
 
-bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
+std::vector<std::string> Toolkit::RenderToSVGPages(int firstPage, int lastPage, bool xmlDeclaration)
 {
     this->ResetLogBuffer();
 
-    std::string output = this->RenderToSVG(pageNo, true);
+    const int pageCount = this->GetPageCount();
+    if (lastPage == 0) lastPage = pageCount;
+    if ((firstPage < 1) || (lastPage > pageCount) || (firstPage > lastPage)) {
+        LogError("Page range %d-%d is not valid (the document has %d pages)", firstPage, lastPage, pageCount);
+        return {};
+    }
+
+    std::vector<int> pageNos(lastPage - firstPage + 1);
+    std::iota(pageNos.begin(), pageNos.end(), firstPage);
+
+    // Each page gets its own SvgDeviceContext in the toolkit rendering it
+    std::vector<std::string> svgs(pageNos.size());
+    this->ProcessPages(pageNos, [&svgs, firstPage, xmlDeclaration](Toolkit &toolkit, int pageNo) {
+        svgs.at(pageNo - firstPage) = toolkit.RenderToSVG(pageNo, xmlDeclaration);
+        return true;
+    });
+
+    return svgs;
+}
+
+bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
+{
+    this->ResetLogBuffer();
 
     std::ofstream outfile;
     outfile.open(filename.c_str());
@@ -1570,11 +2145,61 @@ bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
         return false;
     }
 
-    outfile << output;
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+    SvgDeviceContext svg;
+    this->RenderToSvgDeviceContext(pageNo, &svg);
+
+    // The SVG document is saved to the file without the copy into a string
+    svg.SaveSVG(outfile, true);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
     outfile.close();
     return true;
 }
 
+void Toolkit::RenderToSvgDeviceContext(int pageNo, SvgDeviceContext *svg)
+{
+    assert(svg);
+
+    svg->SetResources(&m_doc.GetResources());
+
+    int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
+    svg->SetIndent(indent);
+
+    if (m_options->m_mmOutput.GetValue()) {
+        svg->SetMMOutput(true);
+    }
+
+    if (m_doc.GetType() == Facs) {
+        svg->SetFacsimile(true);
+    }
+
+    // set the option to use viewbox on svg root
+    if (m_options->m_svgBoundingBoxes.GetValue()) {
+        svg->SetSvgBoundingBoxes(true);
+    }
+
+    // set the additional CSS if any
+    if (!m_options->m_svgCss.GetValue().empty()) {
+        svg->SetCss(m_options->m_svgCss.GetValue());
+    }
+
+    if (m_options->m_svgViewBox.GetValue()) {
+        svg->SetSvgViewBox(true);
+    }
+
+    svg->SetHtml5(m_options->m_svgHtml5.GetValue());
+    svg->SetFormatRaw(m_options->m_svgFormatRaw.GetValue());
+    svg->SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
+    svg->SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
+    svg->SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+    // The systems are serialized as they are drawn, so the page is not kept entirely as an SVG document
+    svg->SetFlushSystems(true);
+
+    // render the page
+    this->RenderToDeviceContext(pageNo, svg);
+}
+
 std::string Toolkit::GetHumdrum()
 {
     return this->GetHumdrumBuffer();
@@ -1689,9 +2314,6 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     this->ResetLogBuffer();
 
     jsonxx::Object o;
-    jsonxx::Array noteArray;
-    jsonxx::Array chordArray;
-    jsonxx::Array restArray;
 
     // Here we need to check that the midi timemap is done
     if (!m_doc.HasTimemap()) {
@@ -1699,27 +2321,75 @@ std::string Toolkit::GetElementsAtTime(int millisec)
         m_doc.CalculateTimemap();
     }
 
-    MeasureOnsetOffsetComparison matchMeasureTime(millisec);
-    Measure *measure = dynamic_cast<Measure *>(m_doc.FindDescendantByComparison(&matchMeasureTime));
+    ListOfObjects notesOrRests;
+    Measure *measure = m_doc.FindElementsAtTime(millisec, notesOrRests);
 
     if (!measure) {
         return o.json();
     }
 
-    int repeat = measure->EnclosesTime(millisec);
-    int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(repeat);
+    this->ElementsAtTimeToJson(measure, notesOrRests, o);
+
+    return o.json();
+}
+
+std::string Toolkit::GetElementChangesInTimeRange(int startMillisec, int endMillisec)
+{
+    this->ResetLogBuffer();
+
+    jsonxx::Array changes;
+
+    if (endMillisec < startMillisec) {
+        LogWarning("The end time cannot be before the start time");
+        return changes.json();
+    }
+
+    // Here we need to check that the midi timemap is done
+    if (!m_doc.HasTimemap()) {
+        // generate MIDI timemap before progressing
+        m_doc.CalculateTimemap();
+    }
+
+    std::vector<int> times = m_doc.GetTimemapChangeTimes(startMillisec, endMillisec);
+    times.insert(times.begin(), startMillisec);
+
+    Measure *previousMeasure = NULL;
+    ListOfObjects previousNotesOrRests;
+    for (int time : times) {
+        ListOfObjects notesOrRests;
+        Measure *measure = m_doc.FindElementsAtTime(time, notesOrRests);
+        // Only the times at which something changes are given (but always the start time)
+        if ((time != startMillisec) && (measure == previousMeasure) && (notesOrRests == previousNotesOrRests)) {
+            continue;
+        }
+
+        jsonxx::Object o;
+        o << "time" << time;
+        if (measure) this->ElementsAtTimeToJson(measure, notesOrRests, o);
+        changes << o;
+
+        previousMeasure = measure;
+        previousNotesOrRests = notesOrRests;
+    }
+
+    return changes.json();
+}
+
+void Toolkit::ElementsAtTimeToJson(Measure *measure, const ListOfObjects &notesOrRests, jsonxx::Object &o) const
+{
+    assert(measure);
+
+    jsonxx::Array noteArray;
+    jsonxx::Array chordArray;
+    jsonxx::Array restArray;
 
     // Get the pageNo from the first note (if any)
     int pageNo = -1;
     Page *page = vrv_cast<Page *>(measure->GetFirstAncestor(PAGE));
     if (page) pageNo = page->GetIdx() + 1;
 
-    NoteOrRestOnsetOffsetComparison matchTime(millisec - measureTimeOffset);
-    ListOfObjects notesOrRests;
     ListOfObjects chords;
 
-    measure->FindAllDescendantsByComparison(&notesOrRests, &matchTime);
-
     // Fill the JSON object
     for (Object *object : notesOrRests) {
         if (object->Is(NOTE)) {
@@ -1743,8 +2413,6 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     o << "rests" << restArray;
     o << "page" << pageNo;
     o << "measure" << measure->GetID();
-
-    return o.json();
 }
 
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
@@ -1799,6 +2467,144 @@ std::string Toolkit::GetDescriptiveFeatures(const std::string &options)
     return output;
 }
 
+std::vector<std::string> Toolkit::GetDescriptiveFeaturesBatch(
+    const std::vector<std::string> &inputs, const std::string &options)
+{
+    std::vector<std::string> outputs(inputs.size());
+    this->ProcessInputs(inputs, [&inputs, &outputs, &options](Toolkit &worker, int index) {
+        if (!worker.LoadData(inputs.at(index))) return false;
+        return worker.m_doc.ExportFeatures(outputs.at(index), options, true);
+    });
+    return outputs;
+}
+
+bool Toolkit::AddToFeatureIndex(const std::vector<std::string> &inputs, const std::vector<std::string> &docIds)
+{
+    if (!docIds.empty() && (docIds.size() != inputs.size())) {
+        LogError("The number of document IDs does not match the number of inputs");
+        return false;
+    }
+
+    // Each worker only sets the extractors of the inputs it loaded
+    std::vector<std::unique_ptr<FeatureExtractor>> extractors(inputs.size());
+    const bool success = this->ProcessInputs(inputs, [&inputs, &extractors](Toolkit &worker, int index) {
+        if (!worker.LoadData(inputs.at(index))) return false;
+        auto extractor = std::make_unique<FeatureExtractor>("");
+        if (!worker.m_doc.ExtractFeatures(*extractor)) return false;
+        // The notes belong to the worker document
+        extractor->m_previousNotes.clear();
+        extractors.at(index) = std::move(extractor);
+        return true;
+    });
+
+    // The documents are added in the order of the inputs once they are all processed
+    if (!m_featureIndex) m_featureIndex = new FeatureIndex();
+    for (int i = 0; i < (int)inputs.size(); ++i) {
+        if (!extractors.at(i)) continue;
+        const std::string docId
+            = docIds.empty() ? StringFormat("%d", m_featureIndex->GetDocumentCount()) : docIds.at(i);
+        if (!m_featureIndex->AddDocument(docId, *extractors.at(i))) return false;
+    }
+    return success;
+}
+
+bool Toolkit::SaveFeatureIndex(const std::string &filename)
+{
+    if (!m_featureIndex) m_featureIndex = new FeatureIndex();
+    return m_featureIndex->Write(filename);
+}
+
+bool Toolkit::LoadFeatureIndex(const std::string &filename)
+{
+    if (!m_featureIndex) m_featureIndex = new FeatureIndex();
+    return m_featureIndex->Read(filename);
+}
+
+std::string Toolkit::QueryFeatureIndex(const std::string &jsonQuery)
+{
+    if (!m_featureIndex) m_featureIndex = new FeatureIndex();
+    return m_featureIndex->Query(jsonQuery);
+}
+
+std::string Toolkit::GetFunctorProfile() const
+{
+    std::vector<std::pair<std::string, FunctorProfiler::Entry>> entries;
+    for (const auto &entry : FunctorProfiler::GetEntries()) entries.push_back(entry);
+    std::stable_sort(entries.begin(), entries.end(),
+        [](const auto &entry1, const auto &entry2) { return (entry1.second.m_seconds > entry2.second.m_seconds); });
+
+    jsonxx::Array functors;
+    for (const auto &[name, entry] : entries) {
+        jsonxx::Object o;
+        o << "functor" << name;
+        o << "calls" << entry.m_processCount;
+        o << "time" << entry.m_seconds * 1000.0;
+        o << "nodes" << entry.m_nodeCount;
+        o << "accepts" << entry.m_acceptCount;
+        functors << o;
+    }
+    return functors.json();
+}
+
+void Toolkit::ResetFunctorProfile()
+{
+    FunctorProfiler::Reset();
+}
+
+std::string Toolkit::GetMemoryReport() const
+{
+    CollectClassIdsFunctor collectClassIds;
+    collectClassIds.SetVisibleOnly(false);
+    m_doc.Process(collectClassIds);
+
+    // The size of the classes is known for the ones created from MEI elements
+    struct ClassEntry {
+        std::string m_name;
+        int m_count;
+        size_t m_size;
+    };
+    std::vector<ClassEntry> entries;
+    int objectCount = 0;
+    size_t objectBytes = 0;
+    for (const auto &[classId, entry] : collectClassIds.GetClassIds()) {
+        const size_t size = ObjectFactory::GetInstance()->GetClassSize(classId);
+        entries.push_back({ entry.first, entry.second, size });
+        objectCount += entry.second;
+        objectBytes += entry.second * size;
+    }
+    // The classes taking the most memory first, and the classes of unknown size by number of objects
+    std::stable_sort(entries.begin(), entries.end(), [](const ClassEntry &entry1, const ClassEntry &entry2) {
+        const size_t bytes1 = entry1.m_count * entry1.m_size;
+        const size_t bytes2 = entry2.m_count * entry2.m_size;
+        return (bytes1 != bytes2) ? (bytes1 > bytes2) : (entry1.m_count > entry2.m_count);
+    });
+
+    jsonxx::Array classes;
+    for (const ClassEntry &entry : entries) {
+        jsonxx::Object o;
+        o << "class" << entry.m_name;
+        o << "count" << entry.m_count;
+        if (entry.m_size > 0) {
+            o << "size" << (int)entry.m_size;
+            o << "bytes" << (double)(entry.m_count * entry.m_size);
+        }
+        classes << o;
+    }
+
+    int registrationCount = 0;
+    size_t registrationBytes = 0;
+    ClassRegistration::GetStatistics(registrationCount, registrationBytes);
+
+    jsonxx::Object report;
+    report << "objects" << objectCount;
+    report << "objectSize" << (int)sizeof(Object);
+    report << "objectBytes" << (double)objectBytes;
+    report << "classes" << classes;
+    report << "registrations" << registrationCount;
+    report << "registrationBytes" << (int)registrationBytes;
+    return report.json();
+}
+
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
     Object *element = m_doc.FindDescendantByID(xmlId);
@@ -1960,11 +2766,31 @@ void Toolkit::SetHumdrumBuffer(const char *data)
     }
     strcpy(m_humdrumBuffer, data);
 }
+void Toolkit::SetHumdrumFiles(HumdrumInput *input)
+{
+#ifndef NO_HUMDRUM_SUPPORT
+    this->ClearHumdrumBuffer();
+    m_humdrumFiles = new hum::HumdrumFileSet();
+    input->MoveHumdrumFiles(*m_humdrumFiles);
+#endif
+}
+
 const char *Toolkit::GetHumdrumBuffer()
 {
     if (m_humdrumBuffer) {
         return m_humdrumBuffer;
     }
+#ifndef NO_HUMDRUM_SUPPORT
+    else if (m_humdrumFiles) {
+        // Serialize the Humdrum files kept when loading the data
+        std::stringstream out;
+        for (int i = 0; i < m_humdrumFiles->getCount(); ++i) {
+            out << (*m_humdrumFiles)[i];
+        }
+        this->SetHumdrumBuffer(out.str().c_str());
+        return m_humdrumBuffer ? m_humdrumBuffer : "[empty]";
+    }
+#endif
     else {
 #ifndef NO_HUMDRUM_SUPPORT
         // Convert from MEI to Humdrum
@@ -2020,6 +2846,10 @@ void Toolkit::ClearHumdrumBuffer()
         free(m_humdrumBuffer);
         m_humdrumBuffer = NULL;
     }
+    if (m_humdrumFiles) {
+        delete m_humdrumFiles;
+        m_humdrumFiles = NULL;
+    }
 #endif
 }
 
@@ -2040,8 +2870,9 @@ std::string Toolkit::ConvertMEIToHumdrum(const std::string &meiData)
     if (!status) {
         LogError("Error converting MEI data to Humdrum: %s", conversion.str().c_str());
     }
-    this->SetHumdrumBuffer(conversion.str().c_str());
-    return conversion.str();
+    const std::string buffer = conversion.str();
+    this->SetHumdrumBuffer(buffer.c_str());
+    return buffer;
 #else
     return "";
 #endif
@@ -1829,7 +1829,7 @@ void View::DrawSystemEditorialElement(DeviceContext *dc, EditorialElement *eleme
 
     dc->StartGraphic(element, elementStart, element->GetID());
     // EditorialElements at the system level that are visible have no children
-    // if (element->m_visibility == Visible) {
+    // if (element->GetVisibility() == Visible) {
     //    DrawSystemChildren(dc, element, system);
     //}
     dc->EndGraphic(element, this);
@@ -1850,7 +1850,7 @@ void View::DrawMeasureEditorialElement(DeviceContext *dc, EditorialElement *elem
     }
 
     dc->StartGraphic(element, "", element->GetID());
-    if (element->m_visibility == Visible) {
+    if (element->GetVisibility() == Visible) {
         this->DrawMeasureChildren(dc, element, measure, system);
     }
     dc->EndGraphic(element, this);
@@ -1871,7 +1871,7 @@ void View::DrawStaffEditorialElement(DeviceContext *dc, EditorialElement *elemen
     }
 
     dc->StartGraphic(element, "", element->GetID());
-    if (element->m_visibility == Visible) {
+    if (element->GetVisibility() == Visible) {
         this->DrawStaffChildren(dc, element, staff, measure);
     }
     dc->EndGraphic(element, this);
@@ -1893,7 +1893,7 @@ void View::DrawLayerEditorialElement(
     }
 
     dc->StartGraphic(element, "", element->GetID());
-    if (element->m_visibility == Visible) {
+    if (element->GetVisibility() == Visible) {
         this->DrawLayerChildren(dc, element, layer, staff, measure);
     }
     dc->EndGraphic(element, this);
@@ -1914,7 +1914,7 @@ void View::DrawTextEditorialElement(DeviceContext *dc, EditorialElement *element
     }
 
     dc->StartTextGraphic(element, "", element->GetID());
-    if (element->m_visibility == Visible) {
+    if (element->GetVisibility() == Visible) {
         this->DrawTextChildren(dc, element, params);
     }
     dc->EndTextGraphic(element, this);
@@ -1935,7 +1935,7 @@ void View::DrawFbEditorialElement(DeviceContext *dc, EditorialElement *element,
     }
 
     dc->StartTextGraphic(element, "", element->GetID());
-    if (element->m_visibility == Visible) {
+    if (element->GetVisibility() == Visible) {
         this->DrawFbChildren(dc, element, params);
     }
     dc->EndTextGraphic(element, this);
@@ -1956,7 +1956,7 @@ void View::DrawRunningEditorialElement(DeviceContext *dc, EditorialElement *elem
     }
 
     dc->StartGraphic(element, "", element->GetID());
-    if (element->m_visibility == Visible) {
+    if (element->GetVisibility() == Visible) {
         this->DrawRunningChildren(dc, element, params);
     }
     dc->EndGraphic(element, this);
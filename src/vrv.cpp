@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <locale>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <vector>
@@ -39,6 +40,7 @@
 #define GIT_COMMIT "[undefined]"
 #endif
 
+#include "runtimeclock.h"
 #include "vrvdef.h"
 
 //----------------------------------------------------------------------------
@@ -71,6 +73,9 @@ bool loggingToBuffer = false;
 
 std::vector<std::string> logBuffer;
 
+/** For guarding the log buffer when logging from worker threads */
+std::mutex logBufferMutex;
+
 void LogElapsedTimeStart()
 {
     gettimeofday(&start, NULL);
@@ -139,6 +144,7 @@ void LogWarning(const char *fmt, ...)
 void LogString(std::string message, LogLevel level)
 {
     if (loggingToBuffer) {
+        const std::lock_guard<std::mutex> lock(logBufferMutex);
         if (LogBufferContains(message)) return;
         logBuffer.push_back(message);
     }
@@ -205,6 +211,11 @@ void EnableLogToBuffer(bool value)
     loggingToBuffer = value;
 }
 
+void EnableFunctorProfiler(bool value)
+{
+    FunctorProfiler::SetEnabled(value);
+}
+
 //----------------------------------------------------------------------------
 // Various helpers
 //----------------------------------------------------------------------------
@@ -24,6 +24,11 @@ void enableLogToBuffer(bool value)
     EnableLogToBuffer(value);
 }
 
+void enableFunctorProfiler(bool value)
+{
+    EnableFunctorProfiler(value);
+}
+
 /****************************************************************
  * Methods exported to use the Toolkit class
  ****************************************************************/
@@ -101,6 +106,13 @@ const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementChangesInTimeRange(void *tkPtr, int startMillisec, int endMillisec)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetElementChangesInTimeRange(startMillisec, endMillisec));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -108,6 +120,13 @@ const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getFunctorProfile(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetFunctorProfile());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getHumdrum(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -152,6 +171,13 @@ const char *vrvToolkit_getMEI(void *tkPtr, const char *options)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getMemoryReport(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetMemoryReport());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -284,6 +310,12 @@ const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options)
     return tk->GetCString();
 }
 
+void vrvToolkit_resetFunctorProfile(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->ResetFunctorProfile();
+}
+
 void vrvToolkit_resetOptions(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -15,6 +15,7 @@ extern "C" {
 
 void enableLog(bool value);
 void enableLogToBuffer(bool value);
+void enableFunctorProfiler(bool value);
 
 void *vrvToolkit_constructor();
 void *vrvToolkit_constructorResourcePath(const char *resourcePath);
@@ -26,13 +27,16 @@ const char *vrvToolkit_getDefaultOptions(void *tkPtr);
 const char *vrvToolkit_getDescriptiveFeatures(void *tkPtr, const char *options);
 const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec);
+const char *vrvToolkit_getElementChangesInTimeRange(void *tkPtr, int startMillisec, int endMillisec);
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getFunctorProfile(void *tkPtr);
 const char *vrvToolkit_getHumdrum(void *tkPtr);
 const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumData);
 const char *vrvToolkit_convertHumdrumToMIDI(void *tkPtr, const char *humdrumData);
 const char *vrvToolkit_convertMEIToHumdrum(void *tkPtr, const char *meiData);
 const char *vrvToolkit_getLog(void *tkPtr);
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options);
+const char *vrvToolkit_getMemoryReport(void *tkPtr);
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getOptions(void *tkPtr);
@@ -52,6 +56,7 @@ const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options);
 const char *vrvToolkit_renderToPAE(void *tkPtr);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
+void vrvToolkit_resetFunctorProfile(void *tkPtr);
 void vrvToolkit_resetOptions(void *tkPtr);
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed);
 bool vrvToolkit_select(void *tkPtr, const char *selection);
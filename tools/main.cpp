@@ -5,17 +5,23 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
+#include <vector>
 
 #ifndef _WIN32
+#include <dirent.h>
 #include <getopt.h>
 #else
+#include "win_dirent.h"
 #include "win_getopt.h"
 #endif
 
@@ -63,6 +69,116 @@ void display_version()
     std::cout << "Verovio " << vrv::GetVersion() << std::endl;
 }
 
+std::vector<std::string> list_files(const std::string &dir)
+{
+    std::vector<std::string> files;
+    DIR *dirp = opendir(dir.c_str());
+    if (!dirp) return files;
+    while (struct dirent *entry = readdir(dirp)) {
+        const std::string path = dir + "/" + entry->d_name;
+        struct stat st;
+        if ((stat(path.c_str(), &st) == 0) && (((st.st_mode) & S_IFMT) == S_IFREG)) {
+            files.push_back(path);
+        }
+    }
+    closedir(dirp);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+std::string json_string(const std::string &value)
+{
+    std::string quoted = "\"";
+    for (char ch : value) {
+        if ((ch == '"') || (ch == '\\')) {
+            quoted += '\\';
+            quoted += ch;
+        }
+        else if ((unsigned char)ch < 0x20) {
+            quoted += vrv::StringFormat("\\u%04x", (unsigned char)ch);
+        }
+        else {
+            quoted += ch;
+        }
+    }
+    return quoted + "\"";
+}
+
+// Pass the files of a directory or the lines of a file to the process function in chunks, with their names
+bool process_batch(const std::string &infile,
+    const std::function<void(const std::vector<std::string> &, const std::vector<std::string> &)> &process)
+{
+    // The inputs are passed in chunks to limit the memory used for large corpora
+    const int chunkSize = 10000;
+
+    std::vector<std::string> names;
+    std::vector<std::string> inputs;
+    std::vector<std::string> files;
+    std::ifstream lines;
+    if (dir_exists(infile)) {
+        files = list_files(infile);
+    }
+    else {
+        lines.open(infile);
+        if (!lines.is_open()) return false;
+    }
+
+    int lineNo = 0;
+    auto nextChunk = [&]() {
+        names.clear();
+        inputs.clear();
+        if (!lines.is_open()) {
+            for (int i = 0; (i < chunkSize) && (lineNo < (int)files.size()); ++i, ++lineNo) {
+                std::ifstream file(files.at(lineNo));
+                std::stringstream data;
+                data << file.rdbuf();
+                names.push_back(basename(files.at(lineNo)));
+                inputs.push_back(data.str());
+            }
+            return;
+        }
+        for (std::string line; ((int)inputs.size() < chunkSize) && getline(lines, line);) {
+            ++lineNo;
+            if (line.empty()) continue;
+            names.push_back(std::to_string(lineNo));
+            inputs.push_back(line);
+        }
+    };
+
+    for (nextChunk(); !inputs.empty(); nextChunk()) {
+        process(names, inputs);
+    }
+    return true;
+}
+
+// Extract the features of each input of the batch and write them as JSON lines
+bool extract_features_batch(vrv::Toolkit &toolkit, const std::string &infile, std::ostream &output)
+{
+    return process_batch(infile, [&toolkit, &output](const auto &names, const auto &inputs) {
+        std::vector<std::string> features = toolkit.GetDescriptiveFeaturesBatch(inputs, "{}");
+        for (int i = 0; i < (int)names.size(); ++i) {
+            output << "{\"input\":" << json_string(names.at(i));
+            if (features.at(i).empty()) {
+                output << ",\"error\":\"The input could not be loaded\"}\n";
+            }
+            else {
+                output << ",\"features\":" << features.at(i) << "}\n";
+            }
+        }
+    });
+}
+
+// Build the feature index of the inputs of the batch, with their names as document IDs
+bool build_feature_index_batch(vrv::Toolkit &toolkit, const std::string &infile, const std::string &outfile)
+{
+    const bool success = process_batch(infile, [&toolkit](const auto &names, const auto &inputs) {
+        if (!toolkit.AddToFeatureIndex(inputs, names)) {
+            vrv::LogWarning("Some inputs could not be loaded and are not in the feature index");
+        }
+    });
+    return success && toolkit.SaveFeatureIndex(outfile);
+}
+
 bool optionExists(const std::string &option, int argc, char **argv, std::string &badOption)
 {
     for (int i = 0; i < argc; ++i) {
@@ -79,6 +195,7 @@ int main(int argc, char **argv)
     std::string outfile;
     std::string outformat = "svg";
     bool std_output = false;
+    bool batch = false;
 
     int all_pages = 0;
     int page = 1;
@@ -103,6 +220,8 @@ int main(int argc, char **argv)
         { "xml-id-seed", required_argument, 0, 'x' }, //
         // standard input - long options only or - as filename
         { "stdin", no_argument, 0, 'z' }, //
+        // batch feature extraction - long options only
+        { "batch", no_argument, 0, 'z' }, //
         { 0, 0, 0, 0 }
     };
 
@@ -221,6 +340,9 @@ int main(int argc, char **argv)
                 if (!strcmp(long_options[option_index].name, "stdin")) {
                     infile = "-";
                 }
+                else if (!strcmp(long_options[option_index].name, "batch")) {
+                    batch = true;
+                }
                 break;
 
             case 'h':
@@ -248,6 +370,11 @@ int main(int argc, char **argv)
         toolkit.InitClock();
     }
 
+    // Start the functor profiler if desired
+    if (options->m_profileFunctors.GetValue()) {
+        vrv::EnableFunctorProfiler(true);
+    }
+
     std::cerr << infile;
     if (optind <= argc - 1) {
         infile = std::string(argv[optind]);
@@ -280,14 +407,27 @@ int main(int argc, char **argv)
 
     if ((outformat != "svg") && (outformat != "mei") && (outformat != "mei-basic") && (outformat != "mei-pb")
         && (outformat != "midi") && (outformat != "timemap") && (outformat != "expansionmap")
-        && (outformat != "humdrum") && (outformat != "hum") && (outformat != "pae")) {
+        && (outformat != "humdrum") && (outformat != "hum") && (outformat != "pae") && (outformat != "features")
+        && (outformat != "feature-index")) {
         std::cerr << "Output format (" << outformat
-                  << ") can only be 'mei', 'mei-basic', 'mei-pb', 'svg', 'midi', 'timemap', 'expansionmap', 'humdrum' "
-                     "or 'pae'."
+                  << ") can only be 'mei', 'mei-basic', 'mei-pb', 'svg', 'midi', 'timemap', 'expansionmap', 'humdrum', "
+                     "'pae', 'features' or 'feature-index'."
                   << std::endl;
         exit(1);
     }
 
+    // Batch processing is only available for the features, the feature index is only built in batch
+    if (batch && (((outformat != "features") && (outformat != "feature-index")) || (infile == "-"))) {
+        std::cerr << "Batch processing can only be used with a file or a directory and 'features' or "
+                     "'feature-index' output."
+                  << std::endl;
+        exit(1);
+    }
+    if (!batch && (outformat == "feature-index")) {
+        std::cerr << "The feature index can only be built in batch." << std::endl;
+        exit(1);
+    }
+
     // Make sure we provide a file name or output to std output with std input
     if ((infile == "-") && (outfile.empty())) {
         std::cerr << "Standard input can be used only with standard output or output filename." << std::endl;
@@ -296,7 +436,8 @@ int main(int argc, char **argv)
 
     // Hardcode svg ext for now
     if (outfile.empty()) {
-        outfile = removeExtension(infile);
+        outfile = (batch && dir_exists(infile)) ? infile.substr(0, infile.find_last_not_of("/\\") + 1)
+                                                : removeExtension(infile);
     }
     else if (outfile == "-") {
         // vrv::EnableLog(false);
@@ -306,11 +447,37 @@ int main(int argc, char **argv)
         outfile = removeExtension(outfile);
     }
 
-    // Skip the layout for MIDI and timemap output by setting --breaks to none
-    if ((outformat == "midi") || (outformat == "timemap") || (outformat == "expansionmap")) {
+    // Skip the layout for MIDI, timemap and features output by setting --breaks to none
+    if ((outformat == "midi") || (outformat == "timemap") || (outformat == "expansionmap")
+        || (outformat == "features") || (outformat == "feature-index")) {
         toolkit.SetOptions("{'breaks': 'none'}");
     }
 
+    // Extract the features of all the inputs without loading them in the toolkit
+    if (batch) {
+        bool success = false;
+        if (outformat == "feature-index") {
+            outfile += ".fidx";
+            success = !std_output && build_feature_index_batch(toolkit, infile, outfile);
+            if (success) std::cerr << "Output written to " << outfile << "." << std::endl;
+        }
+        else if (std_output) {
+            success = extract_features_batch(toolkit, infile, std::cout);
+        }
+        else {
+            outfile += ".ndjson";
+            std::ofstream output(outfile);
+            success = output.is_open() && extract_features_batch(toolkit, infile, output);
+            if (success) std::cerr << "Output written to " << outfile << "." << std::endl;
+        }
+        if (!success) {
+            std::cerr << "Unable to extract the features of '" << infile << "'." << std::endl;
+            exit(1);
+        }
+        free(long_options);
+        return 0;
+    }
+
     // Load the std input or load the file
     if (!((toolkit.GetOutputTo() == vrv::HUMDRUM) && (toolkit.GetInputFrom() == vrv::MEI))) {
         if (infile == "-") {
@@ -351,23 +518,52 @@ int main(int argc, char **argv)
     }
 
     if (outformat == "svg") {
-        int p;
-        for (p = from; p < to; ++p) {
-            std::string cur_outfile = outfile;
-            if (all_pages) {
-                cur_outfile += vrv::StringFormat("_%03d", p);
-            }
-            cur_outfile += ".svg";
-            if (std_output) {
-                std::cout << toolkit.RenderToSVG(p);
+        // Pages are rendered with the layout threads (if any) and output in page order as soon as they are rendered
+        std::vector<int> pageNos(to - from);
+        std::iota(pageNos.begin(), pageNos.end(), from);
+        if (std_output) {
+            std::vector<std::string> svgs(pageNos.size());
+            toolkit.ProcessPages(
+                pageNos,
+                [&](vrv::Toolkit &pageToolkit, int p) {
+                    svgs.at(p - from) = pageToolkit.RenderToSVG(p);
+                    return true;
+                },
+                [&](int p) {
+                    std::cout << svgs.at(p - from);
+                    std::string().swap(svgs.at(p - from));
+                    return true;
+                });
+        }
+        else {
+            std::vector<std::string> outfiles;
+            for (int p = from; p < to; ++p) {
+                std::string cur_outfile = outfile;
+                if (all_pages) {
+                    cur_outfile += vrv::StringFormat("_%03d", p);
+                }
+                cur_outfile += ".svg";
+                outfiles.push_back(cur_outfile);
             }
-            else if (!toolkit.RenderToSVGFile(cur_outfile, p)) {
-                std::cerr << "Unable to write SVG to " << cur_outfile << "." << std::endl;
+            // Not a std::vector<bool> since the flags are set from different threads
+            std::vector<char> written(pageNos.size(), false);
+            const bool success = toolkit.ProcessPages(
+                pageNos,
+                [&](vrv::Toolkit &pageToolkit, int p) {
+                    written.at(p - from) = pageToolkit.RenderToSVGFile(outfiles.at(p - from), p);
+                    return true;
+                },
+                [&](int p) {
+                    if (!written.at(p - from)) {
+                        std::cerr << "Unable to write SVG to " << outfiles.at(p - from) << "." << std::endl;
+                        return false;
+                    }
+                    std::cerr << "Output written to " << outfiles.at(p - from) << "." << std::endl;
+                    return true;
+                });
+            if (!success) {
                 exit(1);
             }
-            else {
-                std::cerr << "Output written to " << cur_outfile << "." << std::endl;
-            }
         }
     }
 
@@ -454,6 +650,21 @@ int main(int argc, char **argv)
             std::cerr << "Output written to " << outfile << "." << std::endl;
         }
     }
+    else if (outformat == "features") {
+        outfile += ".json";
+        if (std_output) {
+            std::cout << toolkit.GetDescriptiveFeatures("{}");
+        }
+        else {
+            std::ofstream output(outfile);
+            if (!output.is_open()) {
+                std::cerr << "Unable to write features to " << outfile << "." << std::endl;
+                exit(1);
+            }
+            output << toolkit.GetDescriptiveFeatures("{}");
+            std::cerr << "Output written to " << outfile << "." << std::endl;
+        }
+    }
     else if (outformat == "humdrum" || outformat == "hum") {
         if (toolkit.GetInputFrom() == vrv::MEI) {
             std::string meidata;
@@ -589,6 +800,11 @@ int main(int argc, char **argv)
         toolkit.LogRuntime();
     }
 
+    // Display the functor profile if desired
+    if (options->m_profileFunctors.GetValue()) {
+        std::cerr << toolkit.GetFunctorProfile() << std::endl;
+    }
+
     free(long_options);
     return 0;
 }